@@ -1,5 +1,10 @@
 #pragma once
 
+// Animation
+#include "Atom/Animation/PoseEvaluator.h"
+#include "Atom/Animation/AnimationLOD.h"
+#include "Atom/Animation/BakedAnimation.h"
+
 // Asset
 #include "Atom/Asset/Asset.h"
 #include "Atom/Asset/AssetManager.h"
@@ -0,0 +1,99 @@
+#include "atompch.h"
+#include "AnimationLOD.h"
+
+namespace Atom
+{
+    AnimationLODTierSettings AnimationLOD::ms_TierSettings[(u32)AnimationLODTier::Count] =
+    {
+        { 0.3f,  1, 0 }, // Full
+        { 0.1f,  2, 0 }, // Reduced
+        { 0.0f,  4, 2 }, // Minimal
+        { 0.0f,  0, 0 }  // Frozen
+    };
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    AnimationLOD::ViewInfo AnimationLOD::CreateViewInfo(const glm::mat4& projection, const glm::mat4& cameraTransform)
+    {
+        ViewInfo view;
+        view.ViewProjection = projection * glm::inverse(cameraTransform);
+        view.ProjectionScale = glm::abs(projection[1][1]);
+        view.IsPerspective = projection[2][3] != 0.0f;
+
+        // Extract the planes from the rows of the view projection matrix. Their normals point inside the frustum.
+        const glm::mat4& m = view.ViewProjection;
+        glm::vec4 rows[4] =
+        {
+            glm::vec4(m[0][0], m[1][0], m[2][0], m[3][0]),
+            glm::vec4(m[0][1], m[1][1], m[2][1], m[3][1]),
+            glm::vec4(m[0][2], m[1][2], m[2][2], m[3][2]),
+            glm::vec4(m[0][3], m[1][3], m[2][3], m[3][3])
+        };
+
+        for (u32 i = 0; i < 3; i++)
+        {
+            view.FrustumPlanes[i * 2 + 0] = rows[3] + rows[i];
+            view.FrustumPlanes[i * 2 + 1] = rows[3] - rows[i];
+        }
+
+        for (glm::vec4& plane : view.FrustumPlanes)
+            plane /= glm::length(glm::vec3(plane));
+
+        return view;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    AnimationLODTier AnimationLOD::SelectTier(const ViewInfo& view, const glm::vec3& center, f32 radius)
+    {
+        for (const glm::vec4& plane : view.FrustumPlanes)
+        {
+            if (glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+                return AnimationLODTier::Frozen;
+        }
+
+        // For perspective projections w is the view depth. Entities that contain the camera are always fully updated.
+        f32 depth = 1.0f;
+        if (view.IsPerspective)
+        {
+            depth = (view.ViewProjection * glm::vec4(center, 1.0f)).w;
+
+            if (depth <= radius)
+                return AnimationLODTier::Full;
+        }
+
+        f32 screenSize = radius * view.ProjectionScale / depth;
+
+        for (u32 tier = 0; tier < (u32)AnimationLODTier::Frozen; tier++)
+        {
+            if (screenSize >= ms_TierSettings[tier].MinScreenSize)
+                return (AnimationLODTier)tier;
+        }
+
+        return AnimationLODTier::Minimal;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool AnimationLOD::ShouldUpdate(u32 frameIndex, u32 entityIndex, u32 framesSinceUpdate, AnimationLODTier tier)
+    {
+        if (tier == AnimationLODTier::Frozen)
+            return false;
+
+        u32 interval = glm::max(ms_TierSettings[(u32)tier].UpdateInterval, 1u);
+
+        // Entities that just moved to a tier with a shorter interval might otherwise wait for their slot for too long
+        return (frameIndex + entityIndex) % interval == 0 || framesSinceUpdate >= interval;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AnimationLOD::SetTierSettings(AnimationLODTier tier, const AnimationLODTierSettings& settings)
+    {
+        ATOM_ENGINE_ASSERT(tier < AnimationLODTier::Count);
+        ms_TierSettings[(u32)tier] = settings;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    const AnimationLODTierSettings& AnimationLOD::GetTierSettings(AnimationLODTier tier)
+    {
+        ATOM_ENGINE_ASSERT(tier < AnimationLODTier::Count);
+        return ms_TierSettings[(u32)tier];
+    }
+}
\ No newline at end of file
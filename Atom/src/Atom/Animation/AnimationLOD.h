@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Atom/Core/Core.h"
+
+#include <glm/glm.hpp>
+
+namespace Atom
+{
+    enum class AnimationLODTier : u8
+    {
+        Full = 0,
+        Reduced,
+        Minimal,
+        Frozen,
+
+        Count
+    };
+
+    struct AnimationLODTierSettings
+    {
+        f32 MinScreenSize = 0.0f;     // Fraction of the viewport height covered by the entity bounds
+        u32 UpdateInterval = 1;       // In frames. Poses in between are interpolated.
+        u32 SkippedBoneHeight = 0;    // Bones with fewer levels of children below them than this keep their last sampled transform
+    };
+
+    // Selects how often and how detailed animated entities are updated based on how large they are on screen. Entities outside of
+    // the camera frustum are frozen and only accumulate their playback time.
+    class AnimationLOD
+    {
+    public:
+        struct ViewInfo
+        {
+            glm::vec4 FrustumPlanes[6];
+            glm::mat4 ViewProjection;
+            f32       ProjectionScale = 1.0f;
+            bool      IsPerspective = true;
+        };
+    public:
+        static ViewInfo CreateViewInfo(const glm::mat4& projection, const glm::mat4& cameraTransform);
+        static AnimationLODTier SelectTier(const ViewInfo& view, const glm::vec3& center, f32 radius);
+
+        // Updates of entities in the same tier are spread over the frames of the interval based on the entity index
+        static bool ShouldUpdate(u32 frameIndex, u32 entityIndex, u32 framesSinceUpdate, AnimationLODTier tier);
+
+        static void SetTierSettings(AnimationLODTier tier, const AnimationLODTierSettings& settings);
+        static const AnimationLODTierSettings& GetTierSettings(AnimationLODTier tier);
+    private:
+        static AnimationLODTierSettings ms_TierSettings[(u32)AnimationLODTier::Count];
+    };
+}
\ No newline at end of file
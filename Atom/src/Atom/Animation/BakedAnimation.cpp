@@ -0,0 +1,147 @@
+#include "atompch.h"
+#include "BakedAnimation.h"
+
+#include "Atom/Animation/PoseEvaluator.h"
+
+namespace Atom
+{
+    // ------------------------------------------------------- BakedAnimation ------------------------------------------------------
+    // -----------------------------------------------------------------------------------------------------------------------------
+    BakedAnimation::BakedAnimation(const Animation& animation, const Skeleton& skeleton, u32 sampleRate)
+        : m_Animation(&animation), m_Skeleton(&skeleton), m_AnimationRevision(animation.GetRevision()), m_SkeletonRevision(skeleton.GetRevision()), m_SampleRate(glm::max(sampleRate, 1u)), m_BoneCount(skeleton.GetBoneCount())
+    {
+        f32 durationInSeconds = animation.GetTicksPerSecond() > 0.0f ? animation.GetDuration() / animation.GetTicksPerSecond() : 0.0f;
+        m_FrameCount = glm::max((u32)glm::ceil(durationInSeconds * m_SampleRate), 1u);
+        m_Palettes.resize(m_FrameCount * m_BoneCount);
+
+        // Frames are spread evenly over the clip. The last frame interpolates back to the first one since clips are looped.
+        Vector<Animation::TrackCursor> cursors(animation.GetTrackCount());
+        Vector<glm::mat4> palette;
+        LocalPose pose;
+
+        for (u32 frameIdx = 0; frameIdx < m_FrameCount; frameIdx++)
+        {
+            f32 timeStamp = (f32)frameIdx / m_FrameCount * animation.GetDuration();
+
+            PoseEvaluator::SamplePose(animation, skeleton, timeStamp, cursors.data(), pose);
+            PoseEvaluator::BuildSkinningPalette(skeleton, pose, palette);
+
+            memcpy(m_Palettes.data() + frameIdx * m_BoneCount, palette.data(), m_BoneCount * sizeof(glm::mat4));
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void BakedAnimation::GetPalette(f32 normalizedTime, bool interpolate, Vector<glm::mat4>& palette) const
+    {
+        palette.resize(m_BoneCount);
+
+        f32 framePosition = glm::fract(normalizedTime) * m_FrameCount;
+
+        if (!interpolate)
+        {
+            u32 frameIdx = (u32)glm::round(framePosition) % m_FrameCount;
+            memcpy(palette.data(), GetFrame(frameIdx), m_BoneCount * sizeof(glm::mat4));
+            return;
+        }
+
+        // Blending the matrices directly is not exact for rotations but close enough between neighbouring frames
+        u32 fromFrameIdx = (u32)framePosition % m_FrameCount;
+        u32 toFrameIdx = (fromFrameIdx + 1) % m_FrameCount;
+        f32 factor = framePosition - glm::floor(framePosition);
+
+        const glm::mat4* fromFrame = GetFrame(fromFrameIdx);
+        const glm::mat4* toFrame = GetFrame(toFrameIdx);
+
+        for (u32 boneID = 0; boneID < m_BoneCount; boneID++)
+        {
+            for (u32 col = 0; col < 4; col++)
+                palette[boneID][col] = glm::mix(fromFrame[boneID][col], toFrame[boneID][col], factor);
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool BakedAnimation::IsBakedFrom(const Animation& animation, const Skeleton& skeleton, u32 sampleRate) const
+    {
+        return m_Animation == &animation && m_Skeleton == &skeleton && m_SampleRate == sampleRate &&
+               m_AnimationRevision == animation.GetRevision() && m_SkeletonRevision == skeleton.GetRevision();
+    }
+
+    // ---------------------------------------------------- BakedAnimationCache ----------------------------------------------------
+    // -----------------------------------------------------------------------------------------------------------------------------
+    Ref<BakedAnimation> BakedAnimationCache::GetBakedAnimation(const Ref<Animation>& animation, const Ref<Skeleton>& skeleton, u32 sampleRate)
+    {
+        if (!animation || !skeleton)
+            return nullptr;
+
+        std::promise<Ref<BakedAnimation>> bakedAnimationPromise;
+        std::shared_future<Ref<BakedAnimation>> cachedBakedAnimation;
+
+        {
+            std::lock_guard<std::mutex> lock(ms_CacheMutex);
+
+            // Entries whose assets are gone or were reloaded are reused instead of adding a new one
+            CacheEntry* freeEntry = nullptr;
+
+            for (auto& entry : ms_CacheEntries)
+            {
+                if (entry.Animation.lock() == animation && entry.Skeleton.lock() == skeleton && entry.SampleRate == sampleRate)
+                {
+                    // Entries baked before the animation or skeleton was reloaded are baked again
+                    if (entry.AnimationRevision == animation->GetRevision() && entry.SkeletonRevision == skeleton->GetRevision())
+                        cachedBakedAnimation = entry.BakedAnimation;
+
+                    freeEntry = &entry;
+                    break;
+                }
+
+                if (!freeEntry && (entry.Animation.expired() || entry.Skeleton.expired()))
+                    freeEntry = &entry;
+            }
+
+            if (!cachedBakedAnimation.valid())
+            {
+                CacheEntry& entry = freeEntry ? *freeEntry : ms_CacheEntries.emplace_back();
+                entry.Animation = animation;
+                entry.Skeleton = skeleton;
+                entry.SampleRate = sampleRate;
+                entry.AnimationRevision = animation->GetRevision();
+                entry.SkeletonRevision = skeleton->GetRevision();
+                entry.BakedAnimation = bakedAnimationPromise.get_future().share();
+            }
+        }
+
+        // Waits outside the lock in case another thread is still baking the entry
+        if (cachedBakedAnimation.valid())
+            return cachedBakedAnimation.get();
+
+        Ref<BakedAnimation> bakedAnimation = CreateRef<BakedAnimation>(*animation, *skeleton, sampleRate);
+        bakedAnimationPromise.set_value(bakedAnimation);
+
+        ATOM_INFO("Baked animation {} for skeleton {}: {} frames, {} KB", animation->GetUUID(), skeleton->GetUUID(), bakedAnimation->GetFrameCount(), bakedAnimation->GetMemorySize() / 1024);
+
+        return bakedAnimation;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void BakedAnimationCache::Clear()
+    {
+        std::lock_guard<std::mutex> lock(ms_CacheMutex);
+        ms_CacheEntries.clear();
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    u32 BakedAnimationCache::GetMemoryUsage()
+    {
+        std::lock_guard<std::mutex> lock(ms_CacheMutex);
+
+        // Entries that are still being baked do not use any memory yet
+        u32 memoryUsage = 0;
+        for (auto& entry : ms_CacheEntries)
+        {
+            if (entry.BakedAnimation.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+                memoryUsage += entry.BakedAnimation.get()->GetMemorySize();
+        }
+
+        return memoryUsage;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Atom/Core/Core.h"
+#include "Atom/Asset/AnimationAsset.h"
+#include "Atom/Asset/SkeletonAsset.h"
+
+#include <glm/glm.hpp>
+#include <future>
+
+namespace Atom
+{
+    // Skinning palettes of an animation played on a skeleton, pre-sampled at a fixed rate and stored frame after frame in one table.
+    // Instances only pick a frame so thousands of them can share the same table.
+    class BakedAnimation
+    {
+    public:
+        BakedAnimation(const Animation& animation, const Skeleton& skeleton, u32 sampleRate);
+
+        // Writes the palette at the normalized time of the clip. Without interpolation the closest frame is used.
+        void GetPalette(f32 normalizedTime, bool interpolate, Vector<glm::mat4>& palette) const;
+
+        // Whether the table was baked from the current contents of the animation and skeleton
+        bool IsBakedFrom(const Animation& animation, const Skeleton& skeleton, u32 sampleRate) const;
+
+        inline const glm::mat4* GetFrame(u32 frameIdx) const { return m_Palettes.data() + frameIdx * m_BoneCount; }
+        inline const Animation* GetAnimation() const { return m_Animation; }
+        inline const Skeleton* GetSkeleton() const { return m_Skeleton; }
+        inline u32 GetSampleRate() const { return m_SampleRate; }
+        inline u32 GetFrameCount() const { return m_FrameCount; }
+        inline u32 GetBoneCount() const { return m_BoneCount; }
+        inline u32 GetMemorySize() const { return m_Palettes.size() * sizeof(glm::mat4); }
+    private:
+        const Animation*  m_Animation;
+        const Skeleton*   m_Skeleton;
+        u32               m_AnimationRevision;
+        u32               m_SkeletonRevision;
+        u32               m_SampleRate;
+        u32               m_FrameCount;
+        u32               m_BoneCount;
+        Vector<glm::mat4> m_Palettes;
+    };
+
+    // Shares baked animations between everything that plays the same clip on the same skeleton. Entries are rebaked when their
+    // animation or skeleton asset was released or reloaded. Baking happens outside the cache lock, threads asking for a clip that is being baked
+    // wait for that clip only.
+    class BakedAnimationCache
+    {
+    public:
+        static Ref<BakedAnimation> GetBakedAnimation(const Ref<Animation>& animation, const Ref<Skeleton>& skeleton, u32 sampleRate);
+        static void Clear();
+        static u32 GetMemoryUsage();
+    private:
+        struct CacheEntry
+        {
+            std::weak_ptr<Atom::Animation>                  Animation;
+            std::weak_ptr<Atom::Skeleton>                   Skeleton;
+            u32                                             SampleRate = 0;
+            u32                                             AnimationRevision = 0;
+            u32                                             SkeletonRevision = 0;
+            std::shared_future<Ref<Atom::BakedAnimation>>   BakedAnimation;
+        };
+
+        inline static std::mutex         ms_CacheMutex;
+        inline static Vector<CacheEntry> ms_CacheEntries;
+    };
+}
\ No newline at end of file
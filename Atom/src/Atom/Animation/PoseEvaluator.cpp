@@ -0,0 +1,543 @@
+#include "atompch.h"
+#include "PoseEvaluator.h"
+
+#include "Atom/Core/Timer.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtx/quaternion.hpp>
+#include <xmmintrin.h>
+
+namespace Atom
+{
+    namespace Utils
+    {
+        // Keys of a batch of bones in structure of arrays form
+        struct KeyBatch
+        {
+            alignas(16) f32 FromPosition[3][PoseEvaluator::SIMDWidth];
+            alignas(16) f32 ToPosition[3][PoseEvaluator::SIMDWidth];
+            alignas(16) f32 PositionFactor[PoseEvaluator::SIMDWidth];
+            alignas(16) f32 FromRotation[4][PoseEvaluator::SIMDWidth];
+            alignas(16) f32 ToRotation[4][PoseEvaluator::SIMDWidth];
+            alignas(16) f32 RotationFactor[PoseEvaluator::SIMDWidth];
+            alignas(16) f32 FromScale[3][PoseEvaluator::SIMDWidth];
+            alignas(16) f32 ToScale[3][PoseEvaluator::SIMDWidth];
+            alignas(16) f32 ScaleFactor[PoseEvaluator::SIMDWidth];
+        };
+
+        static void StoreKeys(KeyBatch& batch, u32 lane, const Animation::BoneKeys& keys)
+        {
+            for (u32 i = 0; i < 3; i++)
+            {
+                batch.FromPosition[i][lane] = keys.From.Position[i];
+                batch.ToPosition[i][lane] = keys.To.Position[i];
+                batch.FromScale[i][lane] = keys.From.Scale[i];
+                batch.ToScale[i][lane] = keys.To.Scale[i];
+            }
+
+            for (u32 i = 0; i < 4; i++)
+            {
+                batch.FromRotation[i][lane] = keys.From.Rotation[i];
+                batch.ToRotation[i][lane] = keys.To.Rotation[i];
+            }
+
+            batch.PositionFactor[lane] = keys.PositionFactor;
+            batch.RotationFactor[lane] = keys.RotationFactor;
+            batch.ScaleFactor[lane] = keys.ScaleFactor;
+        }
+
+        static __m128 Lerp(__m128 a, __m128 b, __m128 t)
+        {
+            return _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), t));
+        }
+
+        static __m128 Dot4(const __m128 a[4], const __m128 b[4])
+        {
+            return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a[0], b[0]), _mm_mul_ps(a[1], b[1])), _mm_add_ps(_mm_mul_ps(a[2], b[2]), _mm_mul_ps(a[3], b[3])));
+        }
+
+        static void Normalize4(__m128 v[4])
+        {
+            __m128 invLength = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(Dot4(v, v)));
+
+            for (u32 i = 0; i < 4; i++)
+                v[i] = _mm_mul_ps(v[i], invLength);
+        }
+
+        // Negates the quaternions of "v" that are in the opposite hemisphere of the ones in "reference"
+        static void AlignHemisphere(__m128 v[4], const __m128 reference[4])
+        {
+            __m128 flip = _mm_and_ps(_mm_cmplt_ps(Dot4(v, reference), _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+
+            for (u32 i = 0; i < 4; i++)
+                v[i] = _mm_xor_ps(v[i], flip);
+        }
+
+        static void InterpolateKeys(const KeyBatch& batch, __m128 position[3], __m128 rotation[4], __m128 scale[3])
+        {
+            __m128 positionFactor = _mm_load_ps(batch.PositionFactor);
+            __m128 scaleFactor = _mm_load_ps(batch.ScaleFactor);
+
+            for (u32 i = 0; i < 3; i++)
+            {
+                position[i] = Lerp(_mm_load_ps(batch.FromPosition[i]), _mm_load_ps(batch.ToPosition[i]), positionFactor);
+                scale[i] = Lerp(_mm_load_ps(batch.FromScale[i]), _mm_load_ps(batch.ToScale[i]), scaleFactor);
+            }
+
+            // Flip the target quaternion when needed so that the blend takes the shortest path
+            __m128 from[4], to[4];
+            for (u32 i = 0; i < 4; i++)
+            {
+                from[i] = _mm_load_ps(batch.FromRotation[i]);
+                to[i] = _mm_load_ps(batch.ToRotation[i]);
+            }
+
+            AlignHemisphere(to, from);
+
+            __m128 rotationFactor = _mm_load_ps(batch.RotationFactor);
+            for (u32 i = 0; i < 4; i++)
+                rotation[i] = Lerp(from[i], to[i], rotationFactor);
+
+            Normalize4(rotation);
+        }
+
+        // result = a * b. The result may alias either of the operands.
+        static void MultiplyMat4(const glm::mat4& a, const glm::mat4& b, glm::mat4& result)
+        {
+            __m128 a0 = _mm_loadu_ps(&a[0][0]);
+            __m128 a1 = _mm_loadu_ps(&a[1][0]);
+            __m128 a2 = _mm_loadu_ps(&a[2][0]);
+            __m128 a3 = _mm_loadu_ps(&a[3][0]);
+
+            for (u32 col = 0; col < 4; col++)
+            {
+                __m128 b0 = _mm_set1_ps(b[col][0]);
+                __m128 b1 = _mm_set1_ps(b[col][1]);
+                __m128 b2 = _mm_set1_ps(b[col][2]);
+                __m128 b3 = _mm_set1_ps(b[col][3]);
+
+                __m128 column = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a0, b0), _mm_mul_ps(a1, b1)), _mm_add_ps(_mm_mul_ps(a2, b2), _mm_mul_ps(a3, b3)));
+                _mm_storeu_ps(&result[col][0], column);
+            }
+        }
+    }
+
+    // ---------------------------------------------------------- LocalPose --------------------------------------------------------
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void LocalPose::Resize(u32 boneCount)
+    {
+        BoneCount = boneCount;
+
+        u32 paddedCount = (boneCount + PoseEvaluator::SIMDWidth - 1) / PoseEvaluator::SIMDWidth * PoseEvaluator::SIMDWidth;
+
+        for (Vector<f32>* component : { &PositionX, &PositionY, &PositionZ, &RotationX, &RotationY, &RotationZ, &ScaleX, &ScaleY, &ScaleZ })
+            component->resize(paddedCount, 0.0f);
+
+        RotationW.resize(paddedCount, 1.0f);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void LocalPose::SetBoneTransform(u32 boneID, const Animation::BoneTransform& transform)
+    {
+        PositionX[boneID] = transform.Position.x;
+        PositionY[boneID] = transform.Position.y;
+        PositionZ[boneID] = transform.Position.z;
+        RotationX[boneID] = transform.Rotation.x;
+        RotationY[boneID] = transform.Rotation.y;
+        RotationZ[boneID] = transform.Rotation.z;
+        RotationW[boneID] = transform.Rotation.w;
+        ScaleX[boneID] = transform.Scale.x;
+        ScaleY[boneID] = transform.Scale.y;
+        ScaleZ[boneID] = transform.Scale.z;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    Animation::BoneTransform LocalPose::GetBoneTransform(u32 boneID) const
+    {
+        Animation::BoneTransform transform;
+        transform.Position = glm::vec3(PositionX[boneID], PositionY[boneID], PositionZ[boneID]);
+        transform.Rotation = glm::quat(RotationW[boneID], RotationX[boneID], RotationY[boneID], RotationZ[boneID]);
+        transform.Scale = glm::vec3(ScaleX[boneID], ScaleY[boneID], ScaleZ[boneID]);
+        return transform;
+    }
+
+    // -------------------------------------------------------- PoseEvaluator ------------------------------------------------------
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void PoseEvaluator::SamplePose(const Animation& animation, const Skeleton& skeleton, f32 timeStamp, Animation::TrackCursor* cursors, LocalPose& pose)
+    {
+        PoseLayer layer;
+        layer.Animation = &animation;
+        layer.TimeStamp = timeStamp;
+        layer.Cursors = cursors;
+
+        SampleBlendedPose(&layer, 1, skeleton, pose);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void PoseEvaluator::SampleBlendedPose(const PoseLayer* layers, u32 layerCount, const Skeleton& skeleton, LocalPose& pose, u32 skippedBoneHeight)
+    {
+        u32 boneCount = skeleton.GetBoneCount();
+
+        // A new pose has no previous transforms to keep
+        if (pose.BoneCount != boneCount)
+            skippedBoneHeight = 0;
+
+        pose.Resize(boneCount);
+
+        static thread_local Vector<PoseLayer> activeLayers;
+        activeLayers.clear();
+
+        f32 totalWeight = 0.0f;
+        for (u32 i = 0; i < layerCount; i++)
+        {
+            if (layers[i].Animation && layers[i].Weight >= MinLayerWeight)
+            {
+                activeLayers.push_back(layers[i]);
+                totalWeight += layers[i].Weight;
+            }
+        }
+
+        if (activeLayers.empty())
+        {
+            for (u32 boneID = 0; boneID < boneCount; boneID++)
+                pose.SetBoneTransform(boneID, Animation::BoneTransform());
+
+            return;
+        }
+
+        Utils::KeyBatch batch;
+        Animation::BoneKeys keys;
+        const Vector<u32>& boneHeights = skeleton.GetBoneHeights();
+
+        for (u32 firstBone = 0; firstBone < boneCount; firstBone += SIMDWidth)
+        {
+            bool skippedLanes[SIMDWidth];
+            u32 skippedLaneCount = 0;
+
+            for (u32 lane = 0; lane < SIMDWidth; lane++)
+            {
+                skippedLanes[lane] = firstBone + lane >= boneCount || boneHeights[firstBone + lane] < skippedBoneHeight;
+                skippedLaneCount += skippedLanes[lane];
+            }
+
+            if (skippedLaneCount == SIMDWidth)
+                continue;
+
+            __m128 accumulatedPosition[3] = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+            __m128 accumulatedRotation[4] = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+            __m128 accumulatedScale[3] = { _mm_setzero_ps(), _mm_setzero_ps(), _mm_setzero_ps() };
+            __m128 referenceRotation[4];
+
+            for (u32 layerIdx = 0; layerIdx < activeLayers.size(); layerIdx++)
+            {
+                const PoseLayer& layer = activeLayers[layerIdx];
+
+                // Gather the keys of the batch. Skipped lanes use their current transform as both keys so the store leaves them unchanged.
+                for (u32 lane = 0; lane < SIMDWidth; lane++)
+                {
+                    if (!skippedLanes[lane])
+                    {
+                        layer.Animation->GetKeysAtTimeStamp(layer.TimeStamp, firstBone + lane, keys, layer.Cursors);
+                    }
+                    else
+                    {
+                        keys.From = firstBone + lane < boneCount ? pose.GetBoneTransform(firstBone + lane) : Animation::BoneTransform();
+                        keys.To = keys.From;
+                    }
+
+                    Utils::StoreKeys(batch, lane, keys);
+                }
+
+                __m128 position[3], rotation[4], scale[3];
+                Utils::InterpolateKeys(batch, position, rotation, scale);
+
+                // Rotations of all layers have to be in the same hemisphere before they are summed up
+                if (layerIdx == 0)
+                {
+                    for (u32 i = 0; i < 4; i++)
+                        referenceRotation[i] = rotation[i];
+                }
+                else
+                {
+                    Utils::AlignHemisphere(rotation, referenceRotation);
+                }
+
+                __m128 weight = _mm_set1_ps(layer.Weight / totalWeight);
+
+                for (u32 i = 0; i < 3; i++)
+                {
+                    accumulatedPosition[i] = _mm_add_ps(accumulatedPosition[i], _mm_mul_ps(position[i], weight));
+                    accumulatedScale[i] = _mm_add_ps(accumulatedScale[i], _mm_mul_ps(scale[i], weight));
+                }
+
+                for (u32 i = 0; i < 4; i++)
+                    accumulatedRotation[i] = _mm_add_ps(accumulatedRotation[i], _mm_mul_ps(rotation[i], weight));
+            }
+
+            Utils::Normalize4(accumulatedRotation);
+
+            f32* positions[3] = { pose.PositionX.data(), pose.PositionY.data(), pose.PositionZ.data() };
+            f32* rotations[4] = { pose.RotationX.data(), pose.RotationY.data(), pose.RotationZ.data(), pose.RotationW.data() };
+            f32* scales[3] = { pose.ScaleX.data(), pose.ScaleY.data(), pose.ScaleZ.data() };
+
+            for (u32 i = 0; i < 3; i++)
+            {
+                _mm_storeu_ps(positions[i] + firstBone, accumulatedPosition[i]);
+                _mm_storeu_ps(scales[i] + firstBone, accumulatedScale[i]);
+            }
+
+            for (u32 i = 0; i < 4; i++)
+                _mm_storeu_ps(rotations[i] + firstBone, accumulatedRotation[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void PoseEvaluator::BlendPoses(const LocalPose& from, const LocalPose& to, f32 factor, LocalPose& result)
+    {
+        ATOM_ENGINE_ASSERT(from.BoneCount == to.BoneCount);
+        result.Resize(to.BoneCount);
+
+        const f32* fromComponents[10] = { from.PositionX.data(), from.PositionY.data(), from.PositionZ.data(), from.ScaleX.data(), from.ScaleY.data(), from.ScaleZ.data(),
+                                          from.RotationX.data(), from.RotationY.data(), from.RotationZ.data(), from.RotationW.data() };
+        const f32* toComponents[10] = { to.PositionX.data(), to.PositionY.data(), to.PositionZ.data(), to.ScaleX.data(), to.ScaleY.data(), to.ScaleZ.data(),
+                                        to.RotationX.data(), to.RotationY.data(), to.RotationZ.data(), to.RotationW.data() };
+        f32* resultComponents[10] = { result.PositionX.data(), result.PositionY.data(), result.PositionZ.data(), result.ScaleX.data(), result.ScaleY.data(), result.ScaleZ.data(),
+                                      result.RotationX.data(), result.RotationY.data(), result.RotationZ.data(), result.RotationW.data() };
+
+        __m128 t = _mm_set1_ps(factor);
+
+        // The arrays are padded so every batch is full
+        for (u32 firstBone = 0; firstBone < to.BoneCount; firstBone += SIMDWidth)
+        {
+            for (u32 i = 0; i < 6; i++)
+                _mm_storeu_ps(resultComponents[i] + firstBone, Utils::Lerp(_mm_loadu_ps(fromComponents[i] + firstBone), _mm_loadu_ps(toComponents[i] + firstBone), t));
+
+            __m128 fromRotation[4], toRotation[4], rotation[4];
+            for (u32 i = 0; i < 4; i++)
+            {
+                fromRotation[i] = _mm_loadu_ps(fromComponents[6 + i] + firstBone);
+                toRotation[i] = _mm_loadu_ps(toComponents[6 + i] + firstBone);
+            }
+
+            Utils::AlignHemisphere(toRotation, fromRotation);
+
+            for (u32 i = 0; i < 4; i++)
+                rotation[i] = Utils::Lerp(fromRotation[i], toRotation[i], t);
+
+            Utils::Normalize4(rotation);
+
+            for (u32 i = 0; i < 4; i++)
+                _mm_storeu_ps(resultComponents[6 + i] + firstBone, rotation[i]);
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void PoseEvaluator::BuildSkinningPalette(const Skeleton& skeleton, const LocalPose& pose, Vector<glm::mat4>& palette)
+    {
+        const Vector<Skeleton::Bone>& bones = skeleton.GetBones();
+        u32 boneCount = bones.size();
+        palette.resize(boneCount);
+
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 two = _mm_set1_ps(2.0f);
+
+        // Build the local matrices (translation * rotation * scale) for 4 bones at a time
+        for (u32 firstBone = 0; firstBone < boneCount; firstBone += SIMDWidth)
+        {
+            __m128 x = _mm_loadu_ps(pose.RotationX.data() + firstBone);
+            __m128 y = _mm_loadu_ps(pose.RotationY.data() + firstBone);
+            __m128 z = _mm_loadu_ps(pose.RotationZ.data() + firstBone);
+            __m128 w = _mm_loadu_ps(pose.RotationW.data() + firstBone);
+
+            __m128 xx = _mm_mul_ps(x, x), yy = _mm_mul_ps(y, y), zz = _mm_mul_ps(z, z);
+            __m128 xy = _mm_mul_ps(x, y), xz = _mm_mul_ps(x, z), yz = _mm_mul_ps(y, z);
+            __m128 wx = _mm_mul_ps(w, x), wy = _mm_mul_ps(w, y), wz = _mm_mul_ps(w, z);
+
+            __m128 scaleX = _mm_loadu_ps(pose.ScaleX.data() + firstBone);
+            __m128 scaleY = _mm_loadu_ps(pose.ScaleY.data() + firstBone);
+            __m128 scaleZ = _mm_loadu_ps(pose.ScaleZ.data() + firstBone);
+
+            // Every register holds the same matrix element of 4 bones
+            __m128 columns[4][4] =
+            {
+                {
+                    _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), scaleX),
+                    _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), scaleX),
+                    _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), scaleX),
+                    _mm_setzero_ps()
+                },
+                {
+                    _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), scaleY),
+                    _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), scaleY),
+                    _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), scaleY),
+                    _mm_setzero_ps()
+                },
+                {
+                    _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), scaleZ),
+                    _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), scaleZ),
+                    _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), scaleZ),
+                    _mm_setzero_ps()
+                },
+                {
+                    _mm_loadu_ps(pose.PositionX.data() + firstBone),
+                    _mm_loadu_ps(pose.PositionY.data() + firstBone),
+                    _mm_loadu_ps(pose.PositionZ.data() + firstBone),
+                    one
+                }
+            };
+
+            // Transpose each column from SoA to one register per bone and write it to the palette
+            u32 laneCount = glm::min(SIMDWidth, boneCount - firstBone);
+            for (u32 col = 0; col < 4; col++)
+            {
+                _MM_TRANSPOSE4_PS(columns[col][0], columns[col][1], columns[col][2], columns[col][3]);
+
+                for (u32 lane = 0; lane < laneCount; lane++)
+                    _mm_storeu_ps(&palette[firstBone + lane][col][0], columns[col][lane]);
+            }
+        }
+
+        // Concatenate with the parent transforms. Bones are ordered so that parents are always processed before their children.
+        const Vector<u32>& parentIDs = skeleton.GetParentIDs();
+        for (u32 boneID = 0; boneID < boneCount; boneID++)
+        {
+            u32 parentID = parentIDs[boneID];
+
+            if (parentID != UINT32_MAX)
+                Utils::MultiplyMat4(palette[parentID], palette[boneID], palette[boneID]);
+        }
+
+        for (u32 boneID = 0; boneID < boneCount; boneID++)
+            Utils::MultiplyMat4(palette[boneID], bones[boneID].InverseBindTransform, palette[boneID]);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool PoseEvaluator::ComputeSkinnedBounds(const Skeleton& skeleton, const Vector<glm::mat4>& palette, glm::vec3& boundsMin, glm::vec3& boundsMax)
+    {
+        const Vector<Skeleton::BoneBounds>& boneBounds = skeleton.GetBoneBounds();
+
+        if (boneBounds.empty() || palette.size() != skeleton.GetBoneCount())
+            return false;
+
+        boundsMin = glm::vec3(FLT_MAX);
+        boundsMax = glm::vec3(-FLT_MAX);
+
+        // The palette maps from bind pose to the current pose so the oriented boxes only need one transform
+        for (const Skeleton::BoneBounds& bounds : boneBounds)
+        {
+            const glm::mat4& transform = palette[bounds.BoneID];
+            glm::mat3 rotationScale = glm::mat3(transform);
+            glm::vec3 center = transform * glm::vec4(bounds.Center, 1.0f);
+            glm::vec3 extent = glm::vec3(0.0f);
+
+            for (u32 axis = 0; axis < 3; axis++)
+                extent += glm::abs(rotationScale * bounds.HalfAxes[axis]);
+
+            boundsMin = glm::min(boundsMin, center - extent);
+            boundsMax = glm::max(boundsMax, center + extent);
+        }
+
+        return true;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void PoseEvaluator::EvaluatePoseScalar(const Animation& animation, const Skeleton& skeleton, f32 timeStamp, Animation::TrackCursor* cursors, Vector<glm::mat4>& palette)
+    {
+        const Vector<Skeleton::Bone>& bones = skeleton.GetBones();
+        palette.resize(bones.size());
+
+        for (u32 boneID = 0; boneID < bones.size(); boneID++)
+        {
+            const Skeleton::Bone& bone = bones[boneID];
+            glm::mat4 localTransform = animation.GetTransformAtTimeStamp(timeStamp, boneID, cursors);
+            palette[boneID] = bone.ParentID != UINT32_MAX ? palette[bone.ParentID] * localTransform : localTransform;
+        }
+
+        for (auto& bone : bones)
+            palette[bone.ID] = palette[bone.ID] * bone.InverseBindTransform;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    PoseBenchmarkResult PoseEvaluator::RunBenchmark(u32 boneCount, u32 iterationCount)
+    {
+        PoseBenchmarkResult result;
+        result.BoneCount = boneCount;
+        result.IterationCount = iterationCount;
+
+        if (boneCount == 0 || iterationCount == 0)
+            return result;
+
+        // Generate a binary tree rig where every bone is animated with 30 keys
+        const u32 keyCount = 30;
+        const f32 duration = (f32)(keyCount - 1);
+
+        Vector<Skeleton::Bone> bones(boneCount);
+        Vector<Animation::BoneTrack> tracks(boneCount);
+
+        for (u32 boneID = 0; boneID < boneCount; boneID++)
+        {
+            Skeleton::Bone& bone = bones[boneID];
+            bone.ID = boneID;
+            bone.InverseBindTransform = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, -0.1f * boneID, 0.0f));
+
+            if (boneID > 0)
+                bone.ParentID = (boneID - 1) / 2;
+
+            Animation::BoneTrack& track = tracks[boneID];
+            track.BoneID = boneID;
+
+            for (u32 keyIdx = 0; keyIdx < keyCount; keyIdx++)
+            {
+                f32 phase = keyIdx * 0.2f + boneID * 0.1f;
+
+                track.PositionTimeStamps.push_back((f32)keyIdx);
+                track.Positions.emplace_back(glm::sin(phase) * 0.05f, 0.1f, glm::cos(phase) * 0.05f);
+                track.RotationTimeStamps.push_back((f32)keyIdx);
+                track.Rotations.push_back(glm::angleAxis(glm::sin(phase), glm::normalize(glm::vec3(1.0f, glm::cos(phase), 0.5f))));
+            }
+
+            track.ScaleTimeStamps.push_back(0.0f);
+            track.Scales.emplace_back(1.0f);
+        }
+
+        Skeleton skeleton(bones);
+        Animation animation(duration, 30.0f, tracks);
+
+        Vector<Animation::TrackCursor> scalarCursors(animation.GetTrackCount());
+        Vector<Animation::TrackCursor> simdCursors(animation.GetTrackCount());
+        Vector<glm::mat4> scalarPalette;
+        Vector<glm::mat4> simdPalette;
+        LocalPose pose;
+
+        Timer timer;
+
+        timer.Reset();
+        for (u32 i = 0; i < iterationCount; i++)
+            EvaluatePoseScalar(animation, skeleton, std::fmod(i * 0.37f, duration), scalarCursors.data(), scalarPalette);
+        timer.Stop();
+        result.ScalarTime = timer.GetElapsedTime().GetMilliseconds() / iterationCount;
+
+        timer.Reset();
+        for (u32 i = 0; i < iterationCount; i++)
+        {
+            SamplePose(animation, skeleton, std::fmod(i * 0.37f, duration), simdCursors.data(), pose);
+            BuildSkinningPalette(skeleton, pose, simdPalette);
+        }
+        timer.Stop();
+        result.SIMDTime = timer.GetElapsedTime().GetMilliseconds() / iterationCount;
+
+        for (u32 boneID = 0; boneID < boneCount; boneID++)
+        {
+            for (u32 col = 0; col < 4; col++)
+            {
+                for (u32 row = 0; row < 4; row++)
+                    result.MaxError = glm::max(result.MaxError, glm::abs(scalarPalette[boneID][col][row] - simdPalette[boneID][col][row]));
+            }
+        }
+
+        ATOM_INFO("Pose evaluation benchmark ({} bones, {} iterations): scalar {:.4f} ms, SIMD {:.4f} ms, speedup {:.2f}x, max error {}",
+            boneCount, iterationCount, result.ScalarTime, result.SIMDTime, result.SIMDTime > 0.0f ? result.ScalarTime / result.SIMDTime : 0.0f, result.MaxError);
+
+        return result;
+    }
+}
\ No newline at end of file
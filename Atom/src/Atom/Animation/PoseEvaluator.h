@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Atom/Core/Core.h"
+#include "Atom/Asset/AnimationAsset.h"
+#include "Atom/Asset/SkeletonAsset.h"
+
+#include <glm/glm.hpp>
+
+namespace Atom
+{
+    // Local bone transforms indexed by bone ID and stored as structure of arrays. Every array is padded to a multiple of the SIMD width
+    // so that the kernels can always work on full batches.
+    struct LocalPose
+    {
+        Vector<f32> PositionX, PositionY, PositionZ;
+        Vector<f32> RotationX, RotationY, RotationZ, RotationW;
+        Vector<f32> ScaleX, ScaleY, ScaleZ;
+        u32         BoneCount = 0;
+
+        void Resize(u32 boneCount);
+        void SetBoneTransform(u32 boneID, const Animation::BoneTransform& transform);
+        Animation::BoneTransform GetBoneTransform(u32 boneID) const;
+    };
+
+    struct PoseLayer
+    {
+        const Atom::Animation*        Animation = nullptr;
+        f32                           TimeStamp = 0.0f;
+        f32                           Weight = 1.0f;
+        Atom::Animation::TrackCursor* Cursors = nullptr; // One entry per track of the animation. Can be null.
+    };
+
+    struct PoseBenchmarkResult
+    {
+        u32 BoneCount = 0;
+        u32 IterationCount = 0;
+        f32 ScalarTime = 0.0f; // In milliseconds per evaluation
+        f32 SIMDTime = 0.0f;   // In milliseconds per evaluation
+        f32 MaxError = 0.0f;   // Largest difference between the palette entries of both paths
+    };
+
+    class PoseEvaluator
+    {
+    public:
+        static constexpr u32 SIMDWidth = 4;
+        static constexpr f32 MinLayerWeight = 0.001f;
+
+        // Samples the local transforms of all bones 4 at a time. Rotations are blended with normalized lerp.
+        static void SamplePose(const Animation& animation, const Skeleton& skeleton, f32 timeStamp, Animation::TrackCursor* cursors, LocalPose& pose);
+
+        // Samples all layers in a single pass over the bones and accumulates them weighted into the pose. Layers with a weight below
+        // MinLayerWeight are not sampled at all and the weights of the remaining ones are normalized. Bones with a height below
+        // skippedBoneHeight keep the transform that is already in the pose.
+        static void SampleBlendedPose(const PoseLayer* layers, u32 layerCount, const Skeleton& skeleton, LocalPose& pose, u32 skippedBoneHeight = 0);
+
+        // Interpolates between two poses of the same skeleton. Rotations are blended with normalized lerp.
+        static void BlendPoses(const LocalPose& from, const LocalPose& to, f32 factor, LocalPose& result);
+
+        // Builds the local matrices, concatenates them in parent before child order and applies the inverse bind transforms
+        static void BuildSkinningPalette(const Skeleton& skeleton, const LocalPose& pose, Vector<glm::mat4>& palette);
+
+        // Poses the bone bounds of the skeleton with the palette and returns their axis aligned bounds in mesh space. Returns false
+        // if the skeleton has no bone bounds.
+        static bool ComputeSkinnedBounds(const Skeleton& skeleton, const Vector<glm::mat4>& palette, glm::vec3& boundsMin, glm::vec3& boundsMax);
+
+        // Reference implementation evaluating one bone at a time with slerp and glm matrices
+        static void EvaluatePoseScalar(const Animation& animation, const Skeleton& skeleton, f32 timeStamp, Animation::TrackCursor* cursors, Vector<glm::mat4>& palette);
+
+        // Evaluates a generated rig with both paths and compares their timings and results
+        static PoseBenchmarkResult RunBenchmark(u32 boneCount = 100, u32 iterationCount = 1000);
+    };
+}
\ No newline at end of file
@@ -2,63 +2,327 @@
 #include "AnimationAsset.h"
 
 #include <glm\gtx\quaternion.hpp>
+#include <glm\gtc\constants.hpp>
 
 namespace Atom
 {
+    namespace Utils
+    {
+        // Returns the index of the last key with a time stamp less than or equal to the given one
+        static u32 FindKey(const Vector<f32>& timeStamps, f32 timeStamp, u32& cachedKey)
+        {
+            u32 keyCount = timeStamps.size();
+
+            if (keyCount < 2 || timeStamp <= timeStamps[0])
+                return cachedKey = 0;
+
+            // Check the cached key and its successor first since playback is mostly monotonic
+            if (cachedKey < keyCount && timeStamps[cachedKey] <= timeStamp)
+            {
+                if (cachedKey + 1 == keyCount || timeStamp < timeStamps[cachedKey + 1])
+                    return cachedKey;
+
+                if (cachedKey + 2 == keyCount || timeStamp < timeStamps[cachedKey + 2])
+                    return ++cachedKey;
+            }
+
+            auto it = std::upper_bound(timeStamps.begin(), timeStamps.end(), timeStamp);
+            return cachedKey = (u32)(it - timeStamps.begin()) - 1;
+        }
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        // Channels without keys leave "from" and "to" untouched
+        template<typename T, typename QuantizedT, typename DecodeFn>
+        static void FindChannelKeys(const Vector<f32>& timeStamps, const Vector<QuantizedT>& values, f32 timeStamp, u32& cachedKey, T& from, T& to, f32& interpolationFactor, DecodeFn decode)
+        {
+            interpolationFactor = 0.0f;
+
+            if (values.empty())
+                return;
+
+            u32 key = FindKey(timeStamps, timeStamp, cachedKey);
+            from = decode(values[key]);
+
+            if (key + 1 >= values.size() || timeStamp <= timeStamps[key])
+            {
+                to = from;
+                return;
+            }
+
+            to = decode(values[key + 1]);
+            interpolationFactor = (timeStamp - timeStamps[key]) / (timeStamps[key + 1] - timeStamps[key]);
+        }
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        static Animation::QuantizedQuat QuantizeRotation(const glm::quat& rotation)
+        {
+            glm::quat q = glm::normalize(rotation);
+            f32 components[4] = { q.x, q.y, q.z, q.w };
+
+            u32 largestIdx = 0;
+            for (u32 i = 1; i < 4; i++)
+            {
+                if (glm::abs(components[i]) > glm::abs(components[largestIdx]))
+                    largestIdx = i;
+            }
+
+            // q and -q represent the same rotation so flip the sign to make the dropped component positive
+            f32 sign = components[largestIdx] < 0.0f ? -1.0f : 1.0f;
+
+            // The remaining components are in the [-1/sqrt(2), 1/sqrt(2)] range
+            u64 packed = largestIdx;
+            for (u32 i = 0; i < 4; i++)
+            {
+                if (i == largestIdx)
+                    continue;
+
+                f32 normalized = glm::clamp((components[i] * sign * glm::root_two<f32>() + 1.0f) * 0.5f, 0.0f, 1.0f);
+                packed = (packed << 15) | (u64)(normalized * 32767.0f + 0.5f);
+            }
+
+            Animation::QuantizedQuat result;
+            result.Data[0] = (u16)(packed >> 32);
+            result.Data[1] = (u16)(packed >> 16);
+            result.Data[2] = (u16)packed;
+            return result;
+        }
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        static glm::quat DequantizeRotation(const Animation::QuantizedQuat& rotation)
+        {
+            u64 packed = ((u64)rotation.Data[0] << 32) | ((u64)rotation.Data[1] << 16) | (u64)rotation.Data[2];
+            u32 largestIdx = (u32)(packed >> 45) & 0x3;
+
+            f32 components[4];
+            f32 sumOfSquares = 0.0f;
+            u32 shift = 30;
+            for (u32 i = 0; i < 4; i++)
+            {
+                if (i == largestIdx)
+                    continue;
+
+                f32 normalized = (f32)((packed >> shift) & 0x7FFF) / 32767.0f;
+                components[i] = (normalized * 2.0f - 1.0f) * glm::one_over_root_two<f32>();
+                sumOfSquares += components[i] * components[i];
+                shift -= 15;
+            }
+
+            components[largestIdx] = glm::sqrt(glm::max(0.0f, 1.0f - sumOfSquares));
+            return glm::quat(components[3], components[0], components[1], components[2]);
+        }
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        static Animation::QuantizedVec3 QuantizeVec3(const glm::vec3& value, const glm::vec3& rangeMin, const glm::vec3& rangeExtent)
+        {
+            Animation::QuantizedVec3 result;
+            for (u32 i = 0; i < 3; i++)
+            {
+                f32 normalized = rangeExtent[i] > 0.0f ? glm::clamp((value[i] - rangeMin[i]) / rangeExtent[i], 0.0f, 1.0f) : 0.0f;
+                result.Data[i] = (u16)(normalized * 65535.0f + 0.5f);
+            }
+
+            return result;
+        }
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        static glm::vec3 DequantizeVec3(const Animation::QuantizedVec3& value, const glm::vec3& rangeMin, const glm::vec3& rangeExtent)
+        {
+            return rangeMin + glm::vec3(value.Data[0], value.Data[1], value.Data[2]) / 65535.0f * rangeExtent;
+        }
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        static void QuantizeVec3Channel(const Vector<glm::vec3>& values, Vector<Animation::QuantizedVec3>& quantizedValues, glm::vec3& rangeMin, glm::vec3& rangeExtent)
+        {
+            if (values.empty())
+                return;
+
+            glm::vec3 rangeMax = values[0];
+            rangeMin = values[0];
+
+            for (auto& value : values)
+            {
+                rangeMin = glm::min(rangeMin, value);
+                rangeMax = glm::max(rangeMax, value);
+            }
+
+            rangeExtent = rangeMax - rangeMin;
+
+            quantizedValues.reserve(values.size());
+            for (auto& value : values)
+                quantizedValues.push_back(QuantizeVec3(value, rangeMin, rangeExtent));
+        }
+    }
+
     // ---------------------------------------------------------- Animation --------------------------------------------------------
     // -----------------------------------------------------------------------------------------------------------------------------
-    Animation::Animation(f32 duration, f32 ticksPerSecond, const Set<KeyFrame>& keyFrames)
-        : Asset(AssetType::Animation), m_Duration(duration), m_TicksPerSecond(ticksPerSecond), m_KeyFrames(keyFrames)
+    Animation::Animation(f32 duration, f32 ticksPerSecond, const Vector<BoneTrack>& tracks, bool quantize)
+        : Asset(AssetType::Animation), m_Duration(duration), m_TicksPerSecond(ticksPerSecond), m_IsQuantized(quantize)
+    {
+        if (!m_IsQuantized)
+        {
+            m_UncompressedTracks = tracks;
+            BuildTrackIndices();
+            return;
+        }
+
+        m_Tracks.reserve(tracks.size());
+
+        for (auto& track : tracks)
+        {
+            CompressedBoneTrack& compressedTrack = m_Tracks.emplace_back();
+            compressedTrack.BoneID = track.BoneID;
+
+            compressedTrack.PositionTimeStamps = track.PositionTimeStamps;
+            Utils::QuantizeVec3Channel(track.Positions, compressedTrack.Positions, compressedTrack.PositionRangeMin, compressedTrack.PositionRangeExtent);
+
+            compressedTrack.RotationTimeStamps = track.RotationTimeStamps;
+            compressedTrack.Rotations.reserve(track.Rotations.size());
+            for (auto& rotation : track.Rotations)
+                compressedTrack.Rotations.push_back(Utils::QuantizeRotation(rotation));
+
+            compressedTrack.ScaleTimeStamps = track.ScaleTimeStamps;
+            Utils::QuantizeVec3Channel(track.Scales, compressedTrack.Scales, compressedTrack.ScaleRangeMin, compressedTrack.ScaleRangeExtent);
+        }
+
+        BuildTrackIndices();
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    Animation::Animation(f32 duration, f32 ticksPerSecond, const Vector<CompressedBoneTrack>& tracks)
+        : Asset(AssetType::Animation), m_Duration(duration), m_TicksPerSecond(ticksPerSecond), m_IsQuantized(true), m_Tracks(tracks)
     {
+        BuildTrackIndices();
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    glm::mat4 Animation::GetTransformAtTimeStamp(f32 timeStamp, u32 boneID)
+    void Animation::GetKeysAtTimeStamp(f32 timeStamp, u32 boneID, BoneKeys& keys, TrackCursor* cursors) const
     {
-        const KeyFrame* prevKeyFrame = nullptr;
-        const KeyFrame* nextKeyFrame = nullptr;
+        keys = BoneKeys();
+
+        u32 trackIdx = GetTrackIndex(boneID);
+        if (trackIdx == UINT32_MAX)
+            return;
+
+        TrackCursor localCursor;
+        TrackCursor& cursor = cursors ? cursors[trackIdx] : localCursor;
 
-        for (auto& keyFrame : m_KeyFrames)
+        if (!m_IsQuantized)
         {
-            if (keyFrame.TimeStamp > timeStamp)
-                break;
+            const BoneTrack& track = m_UncompressedTracks[trackIdx];
+            auto identity = [](const auto& value) { return value; };
 
-            if (keyFrame.BoneTransforms.find(boneID) != keyFrame.BoneTransforms.end())
-                prevKeyFrame = &keyFrame;
+            Utils::FindChannelKeys(track.PositionTimeStamps, track.Positions, timeStamp, cursor.PositionKey, keys.From.Position, keys.To.Position, keys.PositionFactor, identity);
+            Utils::FindChannelKeys(track.RotationTimeStamps, track.Rotations, timeStamp, cursor.RotationKey, keys.From.Rotation, keys.To.Rotation, keys.RotationFactor, identity);
+            Utils::FindChannelKeys(track.ScaleTimeStamps, track.Scales, timeStamp, cursor.ScaleKey, keys.From.Scale, keys.To.Scale, keys.ScaleFactor, identity);
+            return;
         }
 
-        for (auto& keyFrame : m_KeyFrames)
+        const CompressedBoneTrack& track = m_Tracks[trackIdx];
+
+        Utils::FindChannelKeys(track.PositionTimeStamps, track.Positions, timeStamp, cursor.PositionKey, keys.From.Position, keys.To.Position, keys.PositionFactor,
+            [&track](const QuantizedVec3& value) { return Utils::DequantizeVec3(value, track.PositionRangeMin, track.PositionRangeExtent); });
+
+        Utils::FindChannelKeys(track.RotationTimeStamps, track.Rotations, timeStamp, cursor.RotationKey, keys.From.Rotation, keys.To.Rotation, keys.RotationFactor,
+            [](const QuantizedQuat& value) { return Utils::DequantizeRotation(value); });
+
+        Utils::FindChannelKeys(track.ScaleTimeStamps, track.Scales, timeStamp, cursor.ScaleKey, keys.From.Scale, keys.To.Scale, keys.ScaleFactor,
+            [&track](const QuantizedVec3& value) { return Utils::DequantizeVec3(value, track.ScaleRangeMin, track.ScaleRangeExtent); });
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    Animation::BoneTransform Animation::SampleBoneTransform(f32 timeStamp, u32 boneID, TrackCursor* cursors) const
+    {
+        BoneKeys keys;
+        GetKeysAtTimeStamp(timeStamp, boneID, keys, cursors);
+
+        BoneTransform result;
+        result.Position = glm::mix(keys.From.Position, keys.To.Position, keys.PositionFactor);
+        result.Rotation = glm::slerp(keys.From.Rotation, keys.To.Rotation, keys.RotationFactor);
+        result.Scale = glm::mix(keys.From.Scale, keys.To.Scale, keys.ScaleFactor);
+
+        return result;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    glm::mat4 Animation::GetTransformAtTimeStamp(f32 timeStamp, u32 boneID, TrackCursor* cursors) const
+    {
+        BoneTransform transform = SampleBoneTransform(timeStamp, boneID, cursors);
+        return glm::translate(glm::mat4(1.0f), transform.Position) * glm::toMat4(transform.Rotation) * glm::scale(glm::mat4(1.0f), transform.Scale);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    u32 Animation::GetUncompressedDataSize(const Vector<BoneTrack>& tracks)
+    {
+        u32 size = 0;
+
+        for (auto& track : tracks)
         {
-            if (keyFrame.TimeStamp > timeStamp && keyFrame.BoneTransforms.find(boneID) != keyFrame.BoneTransforms.end())
-            {
-                nextKeyFrame = &keyFrame;
-                break;
-            }
+            size += sizeof(u32);
+            size += track.PositionTimeStamps.size() * sizeof(f32) + track.Positions.size() * sizeof(glm::vec3);
+            size += track.RotationTimeStamps.size() * sizeof(f32) + track.Rotations.size() * sizeof(glm::quat);
+            size += track.ScaleTimeStamps.size() * sizeof(f32) + track.Scales.size() * sizeof(glm::vec3);
         }
 
-        ATOM_ENGINE_ASSERT(prevKeyFrame || nextKeyFrame);
-        
-        BoneTransform interpolatedTransform;
-        if (prevKeyFrame && !nextKeyFrame)
+        return size;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    u32 Animation::GetCompressedDataSize(const Vector<BoneTrack>& tracks)
+    {
+        u32 size = 0;
+
+        for (auto& track : tracks)
         {
-            interpolatedTransform.Position = prevKeyFrame->BoneTransforms.at(boneID).Position;
-            interpolatedTransform.Rotation = prevKeyFrame->BoneTransforms.at(boneID).Rotation;
-            interpolatedTransform.Scale = prevKeyFrame->BoneTransforms.at(boneID).Scale;
+            size += sizeof(u32) + 4 * sizeof(glm::vec3);
+            size += track.PositionTimeStamps.size() * sizeof(f32) + track.Positions.size() * sizeof(QuantizedVec3);
+            size += track.RotationTimeStamps.size() * sizeof(f32) + track.Rotations.size() * sizeof(QuantizedQuat);
+            size += track.ScaleTimeStamps.size() * sizeof(f32) + track.Scales.size() * sizeof(QuantizedVec3);
         }
-        else if (!prevKeyFrame && nextKeyFrame)
+
+        return size;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    f32 Animation::GetQuantizationError(const Vector<glm::vec3>& values)
+    {
+        if (values.empty())
+            return 0.0f;
+
+        glm::vec3 rangeMin = values[0];
+        glm::vec3 rangeMax = values[0];
+
+        for (auto& value : values)
         {
-            interpolatedTransform.Position = nextKeyFrame->BoneTransforms.at(boneID).Position;
-            interpolatedTransform.Rotation = nextKeyFrame->BoneTransforms.at(boneID).Rotation;
-            interpolatedTransform.Scale = nextKeyFrame->BoneTransforms.at(boneID).Scale;
+            rangeMin = glm::min(rangeMin, value);
+            rangeMax = glm::max(rangeMax, value);
         }
-        else
+
+        // Every component is rounded to the nearest of 65536 steps over the range of the channel
+        return glm::length(rangeMax - rangeMin) / (2.0f * 65535.0f);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    f32 Animation::GetRotationQuantizationError()
+    {
+        // Each of the three stored components is off by at most half a 15 bit step over [-1/sqrt(2), 1/sqrt(2)]. The reconstructed largest
+        // component is at least 1/2, so its error is at most 3 times that, which bounds the angle between the quaternions by 4 * sqrt(3) steps.
+        f32 componentError = glm::root_two<f32>() / (2.0f * 32767.0f);
+        return 4.0f * glm::root_three<f32>() * componentError;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void Animation::BuildTrackIndices()
+    {
+        m_TrackIndices.clear();
+
+        for (u32 trackIdx = 0; trackIdx < GetTrackCount(); trackIdx++)
         {
-            f32 interpolationFactor = (timeStamp - prevKeyFrame->TimeStamp) / (nextKeyFrame->TimeStamp - prevKeyFrame->TimeStamp);
-            interpolatedTransform.Position = glm::mix(prevKeyFrame->BoneTransforms.at(boneID).Position, nextKeyFrame->BoneTransforms.at(boneID).Position, interpolationFactor);
-            interpolatedTransform.Rotation = glm::slerp(prevKeyFrame->BoneTransforms.at(boneID).Rotation, nextKeyFrame->BoneTransforms.at(boneID).Rotation, interpolationFactor);
-            interpolatedTransform.Scale = glm::mix(prevKeyFrame->BoneTransforms.at(boneID).Scale, nextKeyFrame->BoneTransforms.at(boneID).Scale, interpolationFactor);
+            u32 boneID = m_IsQuantized ? m_Tracks[trackIdx].BoneID : m_UncompressedTracks[trackIdx].BoneID;
+
+            if (boneID >= m_TrackIndices.size())
+                m_TrackIndices.resize(boneID + 1, UINT32_MAX);
+
+            m_TrackIndices[boneID] = trackIdx;
         }
-        
-        return glm::translate(glm::mat4(1.0f), interpolatedTransform.Position) * glm::toMat4(interpolatedTransform.Rotation) * glm::scale(glm::mat4(1.0f), interpolatedTransform.Scale);
     }
-}
+}
\ No newline at end of file
@@ -14,31 +14,100 @@ namespace Atom
     public:
         struct BoneTransform
         {
-            glm::vec3 Position;
-            glm::quat Rotation;
-            glm::vec3 Scale = glm::vec3(1.0);
+            glm::vec3 Position = glm::vec3(0.0f);
+            glm::quat Rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+            glm::vec3 Scale = glm::vec3(1.0f);
         };
 
-        struct KeyFrame
+        // Every channel of a track has its own keys sorted by time stamp
+        struct BoneTrack
         {
-            f32 TimeStamp;
-            HashMap<u32, BoneTransform> BoneTransforms;
+            u32               BoneID = UINT32_MAX;
+            Vector<f32>       PositionTimeStamps;
+            Vector<glm::vec3> Positions;
+            Vector<f32>       RotationTimeStamps;
+            Vector<glm::quat> Rotations;
+            Vector<f32>       ScaleTimeStamps;
+            Vector<glm::vec3> Scales;
+        };
 
-            inline bool operator<(const KeyFrame& rhs) const { return TimeStamp < rhs.TimeStamp; }
-            inline bool operator==(const KeyFrame& rhs) const { return TimeStamp == rhs.TimeStamp; }
+        // Rotation encoded with the "smallest three" method: 2 bits for the index of the largest component and 15 bits for each of the other three
+        struct QuantizedQuat
+        {
+            u16 Data[3] = { 0, 0, 0 };
+        };
+
+        // Every component is quantized to 16 bits within the value range of the channel it belongs to
+        struct QuantizedVec3
+        {
+            u16 Data[3] = { 0, 0, 0 };
+        };
+
+        // Runtime representation of a track. Channels with a single key are constant for the whole animation.
+        struct CompressedBoneTrack
+        {
+            u32                   BoneID = UINT32_MAX;
+            Vector<f32>           PositionTimeStamps;
+            Vector<QuantizedVec3> Positions;
+            glm::vec3             PositionRangeMin = glm::vec3(0.0f);
+            glm::vec3             PositionRangeExtent = glm::vec3(0.0f);
+            Vector<f32>           RotationTimeStamps;
+            Vector<QuantizedQuat> Rotations;
+            Vector<f32>           ScaleTimeStamps;
+            Vector<QuantizedVec3> Scales;
+            glm::vec3             ScaleRangeMin = glm::vec3(0.0f);
+            glm::vec3             ScaleRangeExtent = glm::vec3(0.0f);
+        };
+
+        // The keys surrounding a time stamp for every channel of a bone and the interpolation factors between them
+        struct BoneKeys
+        {
+            BoneTransform From;
+            BoneTransform To;
+            f32           PositionFactor = 0.0f;
+            f32           RotationFactor = 0.0f;
+            f32           ScaleFactor = 0.0f;
+        };
+
+        // Per instance cache of the last key used for each channel. Playback is mostly monotonic so the next search usually hits the cached key.
+        struct TrackCursor
+        {
+            u32 PositionKey = 0;
+            u32 RotationKey = 0;
+            u32 ScaleKey = 0;
         };
 
     public:
-        Animation(f32 duration, f32 ticksPerSecond, const Set<KeyFrame>& keyFrames);
+        // The keys are quantized unless "quantize" is false, in which case they are kept as they are
+        Animation(f32 duration, f32 ticksPerSecond, const Vector<BoneTrack>& tracks, bool quantize = true);
+        Animation(f32 duration, f32 ticksPerSecond, const Vector<CompressedBoneTrack>& tracks);
 
-        glm::mat4 GetTransformAtTimeStamp(f32 timeStamp, u32 boneID);
+        // When provided, "cursors" must hold one entry per track of the animation
+        void GetKeysAtTimeStamp(f32 timeStamp, u32 boneID, BoneKeys& keys, TrackCursor* cursors = nullptr) const;
+        BoneTransform SampleBoneTransform(f32 timeStamp, u32 boneID, TrackCursor* cursors = nullptr) const;
+        glm::mat4 GetTransformAtTimeStamp(f32 timeStamp, u32 boneID, TrackCursor* cursors = nullptr) const;
 
         inline f32 GetDuration() const { return m_Duration; }
         inline f32 GetTicksPerSecond() const { return m_TicksPerSecond; }
-        inline const Set<KeyFrame>& GetKeyFrames() const { return m_KeyFrames; }
+        inline bool IsQuantized() const { return m_IsQuantized; }
+        inline u32 GetTrackCount() const { return m_IsQuantized ? m_Tracks.size() : m_UncompressedTracks.size(); }
+        inline u32 GetTrackIndex(u32 boneID) const { return boneID < m_TrackIndices.size() ? m_TrackIndices[boneID] : UINT32_MAX; }
+
+        // Size in bytes of the key data of the tracks in their source and in their quantized form
+        static u32 GetUncompressedDataSize(const Vector<BoneTrack>& tracks);
+        static u32 GetCompressedDataSize(const Vector<BoneTrack>& tracks);
+
+        // Upper bounds of the error quantization adds to the keys of a channel (distance for positions and scales, angle in radians for rotations)
+        static f32 GetQuantizationError(const Vector<glm::vec3>& values);
+        static f32 GetRotationQuantizationError();
+    private:
+        void BuildTrackIndices();
     private:
-        f32           m_Duration;
-        f32           m_TicksPerSecond;
-        Set<KeyFrame> m_KeyFrames;
+        f32                         m_Duration;
+        f32                         m_TicksPerSecond;
+        bool                        m_IsQuantized;
+        Vector<CompressedBoneTrack> m_Tracks;
+        Vector<BoneTrack>           m_UncompressedTracks; // Only used if the animation is not quantized
+        Vector<u32>                 m_TrackIndices;
     };
 }
\ No newline at end of file
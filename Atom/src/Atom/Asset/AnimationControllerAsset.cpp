@@ -5,13 +5,119 @@ namespace Atom
 {
     // -----------------------------------------------------------------------------------------------------------------------------
     AnimationController::AnimationController(const Vector<Ref<Animation>>& animationStates, u16 initialStateIdx)
+        : Asset(AssetType::AnimationController), m_InitialStateIdx(initialStateIdx), m_CurrentStateIdx(initialStateIdx)
+    {
+        m_AnimationStates.reserve(animationStates.size());
+
+        for (auto& animation : animationStates)
+        {
+            AnimationState& state = m_AnimationStates.emplace_back();
+            state.Type = AnimationStateType::Clip;
+            state.Animations.push_back(animation);
+            state.BlendPositions.push_back(glm::vec2(0.0f));
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    AnimationController::AnimationController(const Vector<AnimationState>& animationStates, u16 initialStateIdx)
         : Asset(AssetType::AnimationController), m_AnimationStates(animationStates), m_InitialStateIdx(initialStateIdx), m_CurrentStateIdx(initialStateIdx)
     {
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    void AnimationController::TransitionToState(u16 newState)
+    void AnimationController::TransitionToState(u16 newState, f32 transitionDuration)
     {
         m_CurrentStateIdx = newState;
+        m_TransitionDuration = transitionDuration;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AnimationController::GetBlendWeights(u16 stateIdx, Vector<f32>& weights) const
+    {
+        const AnimationState& state = m_AnimationStates[stateIdx];
+        u32 animationCount = state.Animations.size();
+
+        weights.assign(animationCount, 0.0f);
+
+        if (animationCount == 0)
+            return;
+
+        if (state.Type == AnimationStateType::Clip || animationCount == 1)
+        {
+            weights[0] = 1.0f;
+            return;
+        }
+
+        if (state.Type == AnimationStateType::Blend1D)
+        {
+            // Blend between the closest positions on each side of the parameter
+            u32 lowerIdx = UINT32_MAX;
+            u32 upperIdx = UINT32_MAX;
+
+            for (u32 i = 0; i < animationCount; i++)
+            {
+                f32 position = state.BlendPositions[i].x;
+
+                if (position <= m_BlendParameter.x && (lowerIdx == UINT32_MAX || position > state.BlendPositions[lowerIdx].x))
+                    lowerIdx = i;
+
+                if (position >= m_BlendParameter.x && (upperIdx == UINT32_MAX || position < state.BlendPositions[upperIdx].x))
+                    upperIdx = i;
+            }
+
+            if (lowerIdx == UINT32_MAX || upperIdx == UINT32_MAX || lowerIdx == upperIdx)
+            {
+                weights[lowerIdx != UINT32_MAX ? lowerIdx : upperIdx] = 1.0f;
+                return;
+            }
+
+            f32 lowerPosition = state.BlendPositions[lowerIdx].x;
+            f32 upperPosition = state.BlendPositions[upperIdx].x;
+            f32 factor = upperPosition > lowerPosition ? (m_BlendParameter.x - lowerPosition) / (upperPosition - lowerPosition) : 0.0f;
+
+            weights[lowerIdx] = 1.0f - factor;
+            weights[upperIdx] = factor;
+        }
+        else
+        {
+            // Inverse distance weighting. An animation placed exactly at the parameter takes the full weight.
+            f32 totalWeight = 0.0f;
+
+            for (u32 i = 0; i < animationCount; i++)
+            {
+                glm::vec2 offset = state.BlendPositions[i] - m_BlendParameter;
+                f32 distanceSq = glm::dot(offset, offset);
+
+                if (distanceSq < 1e-6f)
+                {
+                    weights.assign(animationCount, 0.0f);
+                    weights[i] = 1.0f;
+                    return;
+                }
+
+                weights[i] = 1.0f / distanceSq;
+                totalWeight += weights[i];
+            }
+
+            for (f32& weight : weights)
+                weight /= totalWeight;
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    f32 AnimationController::GetStateDuration(u16 stateIdx, const Vector<f32>& weights) const
+    {
+        const AnimationState& state = m_AnimationStates[stateIdx];
+        f32 duration = 0.0f;
+
+        for (u32 i = 0; i < state.Animations.size(); i++)
+        {
+            const Ref<Animation>& animation = state.Animations[i];
+
+            if (animation && animation->GetTicksPerSecond() > 0.0f)
+                duration += weights[i] * animation->GetDuration() / animation->GetTicksPerSecond();
+        }
+
+        return duration;
     }
 }
\ No newline at end of file
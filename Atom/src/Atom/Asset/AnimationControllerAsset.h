@@ -4,23 +4,67 @@
 #include "Atom/Asset/Asset.h"
 #include "Atom/Asset/AnimationAsset.h"
 
+#include <glm/glm.hpp>
+
 namespace Atom
 {
+    enum class AnimationStateType : u8
+    {
+        Clip = 0,
+        Blend1D,
+        Blend2D
+    };
+
+    // A clip state plays its first animation. Blend states place their animations in a 1D or 2D space and blend them based on where the
+    // blend parameter of the controller is.
+    struct AnimationState
+    {
+        AnimationStateType     Type = AnimationStateType::Clip;
+        Vector<Ref<Animation>> Animations;
+        Vector<glm::vec2>      BlendPositions; // One per animation. Only X is used by 1D blends.
+    };
+
+    // Clip states of controllers with baked palettes look up pre-sampled skinning palettes instead of evaluating the pose of every
+    // instance. Meant for crowds of background characters.
+    struct BakedPaletteSettings
+    {
+        bool Enabled = false;
+        u32  SampleRate = 30; // Frames per second
+        bool Interpolate = true;
+    };
+
     class AnimationController : public Asset
     {
         friend class AssetSerializer;
         friend class ContentTools;
     public:
         AnimationController(const Vector<Ref<Animation>>& animationStates, u16 initialStateIdx);
+        AnimationController(const Vector<AnimationState>& animationStates, u16 initialStateIdx);
+
+        // Animators fade from the previous state into the new one over the transition duration
+        void TransitionToState(u16 newState, f32 transitionDuration = 0.0f);
+
+        // Weight of every animation of the state for the current blend parameter. The weights sum up to 1.
+        void GetBlendWeights(u16 stateIdx, Vector<f32>& weights) const;
 
-        void TransitionToState(u16 newState);
+        // Playback length of the state in seconds for the given blend weights
+        f32 GetStateDuration(u16 stateIdx, const Vector<f32>& weights) const;
 
-        inline Ref<Animation> GetInitialState() const { return m_AnimationStates[m_InitialStateIdx]; }
-        inline Ref<Animation> GetCurrentState() const { return m_AnimationStates[m_CurrentStateIdx]; }
-        inline const Vector<Ref<Animation>>& GetAnimationStates() const { return m_AnimationStates; }
+        inline void SetBakedPaletteSettings(const BakedPaletteSettings& settings) { m_BakedPaletteSettings = settings; }
+        inline void SetBlendParameter(const glm::vec2& value) { m_BlendParameter = value; }
+        inline const glm::vec2& GetBlendParameter() const { return m_BlendParameter; }
+        inline f32 GetTransitionDuration() const { return m_TransitionDuration; }
+        inline u16 GetCurrentStateIdx() const { return m_CurrentStateIdx; }
+        inline const AnimationState& GetInitialState() const { return m_AnimationStates[m_InitialStateIdx]; }
+        inline const AnimationState& GetCurrentState() const { return m_AnimationStates[m_CurrentStateIdx]; }
+        inline const Vector<AnimationState>& GetAnimationStates() const { return m_AnimationStates; }
+        inline const BakedPaletteSettings& GetBakedPaletteSettings() const { return m_BakedPaletteSettings; }
     private:
-        u32                    m_InitialStateIdx;
-        u32                    m_CurrentStateIdx;
-        Vector<Ref<Animation>> m_AnimationStates;
+        u16                    m_InitialStateIdx;
+        u16                    m_CurrentStateIdx;
+        f32                    m_TransitionDuration = 0.0f;
+        glm::vec2              m_BlendParameter = glm::vec2(0.0f);
+        Vector<AnimationState> m_AnimationStates;
+        BakedPaletteSettings   m_BakedPaletteSettings;
     };
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "Atom/Core/Core.h"
 #include "Atom/Core/UUID.h"
+#include "Atom/Asset/AssetFile.h"
 
 namespace Atom
 {
@@ -33,11 +34,13 @@ namespace Atom
         AssetFlags            Flags;
         std::filesystem::path SourceFilepath;
         std::filesystem::path AssetFilepath;
+        u64                   ContentHash = 0; // Hash of the imported content and the import settings, 0 for assets that are not deduplicated
     };
 
     class Asset
     {
         friend class AssetSerializer;
+        friend class AssetManager;
         friend class ContentTools;
     public:
         inline static const char* AssetFileExtensions[(u32)AssetType::NumTypes] =
@@ -62,6 +65,8 @@ namespace Atom
         inline const std::filesystem::path& GetAssetFilepath() const { return m_MetaData.AssetFilepath; }
         inline const std::filesystem::path& GetSourceFilepath() const { return m_MetaData.SourceFilepath; }
         inline const AssetMetaData& GetMetaData() const { return m_MetaData; }
+        inline u64 GetMemorySize() const { return m_MemorySize; } // Estimated from the uncompressed size of the asset file, 0 for virtual assets
+        inline u32 GetRevision() const { return m_Revision; } // Incremented every time the asset is reloaded in place
     protected:
         Asset(AssetType type, AssetFlags flags = AssetFlags::None)
         {
@@ -69,6 +74,9 @@ namespace Atom
             m_MetaData.Flags = flags;
         }
     protected:
-        AssetMetaData m_MetaData;
+        AssetMetaData           m_MetaData;
+        u64                     m_MemorySize = 0;
+        u32                     m_Revision = 0;
+        Vector<AssetChunkEntry> m_Chunks; // Table of contents of the file the asset was read from, if it supports reloading changed chunks only
     };
 }
\ No newline at end of file
@@ -0,0 +1,462 @@
+#include "atompch.h"
+#include "AssetFile.h"
+
+#include "Atom/Asset/AssetPack.h"
+#include "Atom/Core/Application.h"
+#include "Atom/Core/LZCompression.h"
+
+namespace Atom
+{
+    // -----------------------------------------------------------------------------------------------------------------------------
+    u64 AssetFile::ComputeHash(const void* data, u64 size)
+    {
+        // Mixes 4 independent lanes of 8 bytes each so that verifying large vertex and pixel chunks stays cheap compared to reading them
+        const u64 prime1 = 0x9E3779B185EBCA87ull;
+        const u64 prime2 = 0xC2B2AE3D27D4EB4Full;
+
+        auto mix = [prime1, prime2](u64 hash, u64 word)
+        {
+            hash ^= word * prime2;
+            return ((hash << 31) | (hash >> 33)) * prime1;
+        };
+
+        const byte* bytes = (const byte*)data;
+        u64 lanes[4] = { size * prime1, size ^ prime2, ~size * prime1, size + prime2 };
+        u64 blockCount = size / sizeof(lanes);
+
+        for (u64 block = 0; block < blockCount; block++)
+        {
+            u64 words[4];
+            memcpy(words, bytes + block * sizeof(lanes), sizeof(lanes));
+
+            for (u32 lane = 0; lane < 4; lane++)
+                lanes[lane] = mix(lanes[lane], words[lane]);
+        }
+
+        u64 tail[4] = {};
+        memcpy(tail, bytes + blockCount * sizeof(lanes), size % sizeof(lanes));
+
+        u64 hash = 0;
+        for (u32 lane = 0; lane < 4; lane++)
+            hash = mix(hash, mix(lanes[lane], tail[lane]));
+
+        hash ^= hash >> 33;
+        hash *= prime2;
+        hash ^= hash >> 29;
+        return hash;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    AssetCompressionStats AssetFile::GetCompressionStats()
+    {
+        AssetCompressionStats stats;
+        stats.UncompressedBytesWritten = ms_UncompressedBytesWritten;
+        stats.CompressedBytesWritten = ms_CompressedBytesWritten;
+        stats.CompressedBytesRead = ms_CompressedBytesRead;
+        stats.DecompressedBytes = ms_DecompressedBytes;
+        stats.DecompressionTime = ms_DecompressionTime * 1e-9;
+        return stats;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetFile::ResetCompressionStats()
+    {
+        ms_UncompressedBytesWritten = 0;
+        ms_CompressedBytesWritten = 0;
+        ms_CompressedBytesRead = 0;
+        ms_DecompressedBytes = 0;
+        ms_DecompressionTime = 0;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    AssetChunkReader::AssetChunkReader(const byte* data, u64 size)
+        : m_Data(data), m_Size(size)
+    {
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool AssetChunkReader::Read(void* destination, u64 size)
+    {
+        const byte* data = ReadView(size);
+
+        if (!data)
+            return false;
+
+        memcpy(destination, data, size);
+        return true;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    const byte* AssetChunkReader::ReadView(u64 size)
+    {
+        if (!IsValid() || size > m_Size - m_Position)
+        {
+            m_Failed = true;
+            return nullptr;
+        }
+
+        const byte* data = m_Data + m_Position;
+        m_Position += size;
+        return data;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    AssetFileReader::AssetFileReader(const std::filesystem::path& filepath)
+        : m_Filepath(filepath)
+    {
+        const AssetPackEntry* packEntry = nullptr;
+        m_Pack = AssetPack::FindMountedAsset(filepath, packEntry);
+
+        if (m_Pack)
+        {
+            m_Data = m_Pack->ReadAsset(*packEntry, m_FileData);
+            m_Size = m_Data ? packEntry->Size : 0;
+        }
+        else
+        {
+            m_File = CreateScope<MappedFile>(filepath);
+            m_Data = m_File->GetData();
+            m_Size = m_File->GetSize();
+        }
+
+        if (!m_Data)
+            return;
+
+        AssetFile::Header header;
+        if (!Contains(0, sizeof(AssetFile::Header)))
+        {
+            ATOM_ERROR("Asset file {} is corrupted", filepath);
+            return;
+        }
+
+        memcpy(&header, m_Data, sizeof(AssetFile::Header));
+
+        if (header.Magic != AssetFile::Magic || header.Version != AssetFile::Version)
+        {
+            ATOM_ERROR("Asset file {} has an unsupported format version. Reimport the asset from its source file", filepath);
+            return;
+        }
+
+        u64 tableSize = (u64)header.ChunkCount * sizeof(AssetChunkEntry);
+        if (!Contains(header.TableOffset, tableSize) || AssetFile::ComputeHash(m_Data + header.TableOffset, tableSize) != header.TableHash)
+        {
+            ATOM_ERROR("Asset file {} is corrupted", filepath);
+            return;
+        }
+
+        m_Chunks.resize(header.ChunkCount);
+        memcpy(m_Chunks.data(), m_Data + header.TableOffset, tableSize);
+
+        for (const AssetChunkEntry& chunk : m_Chunks)
+        {
+            if (!Contains(chunk.Offset, chunk.Size) || (chunk.Compression == AssetCompression::None && chunk.Size != chunk.UncompressedSize))
+            {
+                ATOM_ERROR("Asset file {} is corrupted", filepath);
+                m_Chunks.clear();
+                return;
+            }
+        }
+
+        m_DecompressedChunks.resize(m_Chunks.size());
+        m_VerifiedChunks.resize(m_Chunks.size(), false);
+        m_IsValid = true;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    AssetChunkReader AssetFileReader::GetChunk(AssetChunkType type, u32 index) const
+    {
+        const AssetChunkEntry* chunk = FindChunk(type, index);
+
+        if (!chunk)
+            return AssetChunkReader();
+
+        if (!VerifyChunk(*chunk))
+            return AssetChunkReader();
+
+        const byte* data = m_Data + chunk->Offset;
+
+        if (chunk->Compression == AssetCompression::None)
+            return AssetChunkReader(data, chunk->Size);
+
+        Vector<byte>& decompressedData = m_DecompressedChunks[chunk - m_Chunks.data()];
+
+        if (decompressedData.empty() && chunk->UncompressedSize != 0 && !DecompressChunk(*chunk, decompressedData))
+        {
+            ATOM_ERROR("Asset file {} is corrupted. Chunk {:#x}[{}] could not be decompressed", m_Filepath, (u32)type, index);
+            decompressedData.clear();
+            return AssetChunkReader();
+        }
+
+        return AssetChunkReader(decompressedData.data(), decompressedData.size());
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    const AssetChunkEntry* AssetFileReader::FindChunk(AssetChunkType type, u32 index) const
+    {
+        for (const AssetChunkEntry& chunk : m_Chunks)
+        {
+            if (chunk.Type == type && chunk.Index == index)
+                return &chunk;
+        }
+
+        return nullptr;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    u32 AssetFileReader::GetChunkCount(AssetChunkType type) const
+    {
+        u32 count = 0;
+
+        for (const AssetChunkEntry& chunk : m_Chunks)
+        {
+            if (chunk.Type == type)
+                count++;
+        }
+
+        return count;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    u64 AssetFileReader::GetUncompressedSize() const
+    {
+        u64 size = 0;
+
+        for (const AssetChunkEntry& chunk : m_Chunks)
+            size += chunk.UncompressedSize;
+
+        return size;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    const byte* AssetFileReader::GetStoredChunkData(const AssetChunkEntry& chunk) const
+    {
+        return VerifyChunk(chunk) ? m_Data + chunk.Offset : nullptr;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool AssetFileReader::VerifyChunk(const AssetChunkEntry& chunk) const
+    {
+        u64 chunkIdx = &chunk - m_Chunks.data();
+        ATOM_ENGINE_ASSERT(chunkIdx < m_Chunks.size());
+
+        if (m_VerifiedChunks[chunkIdx])
+            return true;
+
+        if (AssetFile::ComputeHash(m_Data + chunk.Offset, chunk.Size) != chunk.Hash)
+        {
+            ATOM_ERROR("Asset file {} is corrupted. Chunk {:#x}[{}] does not match its hash", m_Filepath, (u32)chunk.Type, chunk.Index);
+            return false;
+        }
+
+        m_VerifiedChunks[chunkIdx] = true;
+        return true;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool AssetFileReader::DecompressChunk(const AssetChunkEntry& chunk, Vector<byte>& decompressedData) const
+    {
+        if (chunk.Compression != AssetCompression::LZ)
+            return false;
+
+        auto startTime = std::chrono::steady_clock::now();
+
+        AssetChunkReader stream(m_Data + chunk.Offset, chunk.Size);
+
+        u32 blockCount = 0, blockSize = 0;
+        if (!stream.Read(blockCount) || !stream.Read(blockSize) || blockSize == 0 || (u64)blockCount * blockSize < chunk.UncompressedSize || (u64)(blockCount - 1) * blockSize >= chunk.UncompressedSize)
+            return false;
+
+        const byte* blockSizesData = stream.ReadView((u64)blockCount * sizeof(u32));
+        if (!blockSizesData)
+            return false;
+
+        // Offsets of the blocks are known upfront, so they can be decompressed independently
+        Vector<u64> blockOffsets(blockCount);
+        Vector<u32> compressedBlockSizes(blockCount);
+        memcpy(compressedBlockSizes.data(), blockSizesData, blockCount * sizeof(u32));
+
+        u64 blockOffset = chunk.Size - stream.GetRemainingSize();
+        for (u32 block = 0; block < blockCount; block++)
+        {
+            blockOffsets[block] = blockOffset;
+            blockOffset += compressedBlockSizes[block];
+        }
+
+        if (blockOffset > chunk.Size)
+            return false;
+
+        decompressedData.resize(chunk.UncompressedSize);
+        std::atomic<bool> succeeded = true;
+
+        Application::Get().GetWorkerThreadPool().ParallelFor(blockCount, 1, [&](u32 begin, u32 end)
+        {
+            for (u32 block = begin; block < end; block++)
+            {
+                const byte* source = m_Data + chunk.Offset + blockOffsets[block];
+                byte* destination = decompressedData.data() + (u64)block * blockSize;
+                u64 size = std::min<u64>(blockSize, chunk.UncompressedSize - (u64)block * blockSize);
+
+                // Blocks that did not get smaller are stored as they are
+                if (compressedBlockSizes[block] == size)
+                    memcpy(destination, source, size);
+                else if (!LZCompression::Decompress(source, compressedBlockSizes[block], destination, size))
+                    succeeded = false;
+            }
+        });
+
+        AssetFile::ms_CompressedBytesRead += chunk.Size;
+        AssetFile::ms_DecompressedBytes += chunk.UncompressedSize;
+        AssetFile::ms_DecompressionTime += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+
+        return succeeded;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    AssetFileWriter::AssetFileWriter(const std::filesystem::path& filepath, AssetCompression compression)
+        : m_Stream(filepath, std::ios::out | std::ios::binary), m_Compression(compression)
+    {
+        // The header is written again by Finalize once the table of contents is known
+        AssetFile::Header header;
+        m_Stream.write((const char*)&header, sizeof(AssetFile::Header));
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetFileWriter::BeginChunk(AssetChunkType type, u32 index)
+    {
+        ATOM_ENGINE_ASSERT(!m_IsChunkOpen, "Previous chunk was not ended");
+
+        m_ChunkType = type;
+        m_ChunkIndex = index;
+        m_ChunkData.clear();
+        m_IsChunkOpen = true;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetFileWriter::Write(const void* data, u64 size)
+    {
+        ATOM_ENGINE_ASSERT(m_IsChunkOpen, "Writing outside of a chunk");
+
+        if (size)
+            m_ChunkData.insert(m_ChunkData.end(), (const byte*)data, (const byte*)data + size);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetFileWriter::EndChunk()
+    {
+        ATOM_ENGINE_ASSERT(m_IsChunkOpen, "No chunk to end");
+
+        m_IsChunkOpen = false;
+        WriteChunk(m_ChunkType, m_ChunkIndex, m_ChunkData.data(), m_ChunkData.size());
+        m_ChunkData.clear();
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetFileWriter::WriteChunk(AssetChunkType type, u32 index, const void* data, u64 size)
+    {
+        static const byte s_Padding[AssetFile::ChunkAlignment] = {};
+
+        // The metadata is read for every asset when the registry is built, so it stays uncompressed
+        AssetCompression compression = AssetCompression::None;
+        Vector<byte> compressedData;
+
+        if (m_Compression != AssetCompression::None && type != AssetChunkType::MetaData && size >= AssetFile::MinCompressedChunkSize && CompressChunk(data, size, compressedData))
+            compression = m_Compression;
+
+        const void* storedData = compression != AssetCompression::None ? compressedData.data() : data;
+        u64 storedSize = compression != AssetCompression::None ? compressedData.size() : size;
+
+        u64 offset = (u64)m_Stream.tellp();
+        u64 alignedOffset = (offset + AssetFile::ChunkAlignment - 1) & ~(AssetFile::ChunkAlignment - 1);
+        m_Stream.write((const char*)s_Padding, alignedOffset - offset);
+        m_Stream.write((const char*)storedData, storedSize);
+
+        m_Chunks.push_back({ type, index, alignedOffset, storedSize, size, AssetFile::ComputeHash(storedData, storedSize), compression, 0 });
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetFileWriter::WriteStoredChunk(const AssetChunkEntry& chunk, const void* storedData)
+    {
+        static const byte s_Padding[AssetFile::ChunkAlignment] = {};
+
+        ATOM_ENGINE_ASSERT(!m_IsChunkOpen, "Previous chunk was not ended");
+
+        u64 offset = (u64)m_Stream.tellp();
+        u64 alignedOffset = (offset + AssetFile::ChunkAlignment - 1) & ~(AssetFile::ChunkAlignment - 1);
+        m_Stream.write((const char*)s_Padding, alignedOffset - offset);
+        m_Stream.write((const char*)storedData, chunk.Size);
+
+        AssetChunkEntry& entry = m_Chunks.emplace_back(chunk);
+        entry.Offset = alignedOffset;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool AssetFileWriter::Finalize()
+    {
+        ATOM_ENGINE_ASSERT(!m_IsChunkOpen, "Last chunk was not ended");
+
+        AssetFile::Header header;
+        header.ChunkCount = m_Chunks.size();
+        header.TableOffset = (u64)m_Stream.tellp();
+        header.TableHash = AssetFile::ComputeHash(m_Chunks.data(), m_Chunks.size() * sizeof(AssetChunkEntry));
+
+        m_Stream.write((const char*)m_Chunks.data(), m_Chunks.size() * sizeof(AssetChunkEntry));
+        m_Stream.seekp(0);
+        m_Stream.write((const char*)&header, sizeof(AssetFile::Header));
+        m_Stream.flush();
+
+        return m_Stream.good();
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool AssetFileWriter::CompressChunk(const void* data, u64 size, Vector<byte>& compressedData)
+    {
+        ATOM_ENGINE_ASSERT(m_Compression == AssetCompression::LZ);
+
+        u32 blockSize = AssetFile::CompressionBlockSize;
+        u32 blockCount = (size + blockSize - 1) / blockSize;
+
+        // Blocks are compressed in parallel into separate buffers and stored raw if they don't get smaller
+        Vector<Vector<byte>> blocks(blockCount);
+
+        Application::Get().GetWorkerThreadPool().ParallelFor(blockCount, 1, [&](u32 begin, u32 end)
+        {
+            for (u32 block = begin; block < end; block++)
+            {
+                const byte* source = (const byte*)data + (u64)block * blockSize;
+                u64 sourceSize = std::min<u64>(blockSize, size - (u64)block * blockSize);
+
+                blocks[block].resize(sourceSize);
+                u64 compressedSize = LZCompression::Compress(source, sourceSize, blocks[block].data(), sourceSize - 1);
+
+                if (compressedSize != 0)
+                    blocks[block].resize(compressedSize);
+                else
+                    memcpy(blocks[block].data(), source, sourceSize);
+            }
+        });
+
+        u64 compressedSize = sizeof(u32) * (2 + blockCount);
+        for (const Vector<byte>& block : blocks)
+            compressedSize += block.size();
+
+        if (compressedSize >= size)
+            return false;
+
+        compressedData.reserve(compressedSize);
+        compressedData.insert(compressedData.end(), (const byte*)&blockCount, (const byte*)&blockCount + sizeof(u32));
+        compressedData.insert(compressedData.end(), (const byte*)&blockSize, (const byte*)&blockSize + sizeof(u32));
+
+        for (const Vector<byte>& block : blocks)
+        {
+            u32 blockDataSize = block.size();
+            compressedData.insert(compressedData.end(), (const byte*)&blockDataSize, (const byte*)&blockDataSize + sizeof(u32));
+        }
+
+        for (const Vector<byte>& block : blocks)
+            compressedData.insert(compressedData.end(), block.begin(), block.end());
+
+        AssetFile::ms_UncompressedBytesWritten += size;
+        AssetFile::ms_CompressedBytesWritten += compressedData.size();
+        return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,183 @@
+#pragma once
+
+#include "Atom/Core/Core.h"
+#include "Atom/Core/MappedFile.h"
+
+namespace Atom
+{
+    class AssetPackReader;
+
+    // Every asset file is a container of typed chunks. The file starts with a header, followed by the chunk data and a table of contents
+    // at the end. Each chunk starts at an offset aligned to AssetFile::ChunkAlignment and stores a hash of its contents, so loaders can
+    // map the file, jump directly to the chunks they need and reject stale or corrupted files without parsing everything before them.
+    enum class AssetChunkType : u32
+    {
+        MetaData      = 0x4154454D, // "META"
+        Data          = 0x41544144, // "DATA", generic serialized asset data
+        TextureHeader = 0x48584554, // "TEXH"
+        Subresource   = 0x53425553, // "SUBS", one chunk per texture subresource, the chunk index is the subresource index
+        MeshHeader    = 0x4848534D, // "MSHH"
+        VertexData    = 0x44585456, // "VTXD", interleaved vertices in the layout of the vertex buffer
+        IndexData     = 0x44584449, // "IDXD"
+        Submeshes     = 0x4D425553, // "SUBM"
+        Materials     = 0x4C54414D, // "MATL"
+        VertexStreams = 0x52545356, // "VSTR", separate vertex streams of readable meshes
+        Dependencies  = 0x53504544, // "DEPS", UUIDs of the assets that are referenced by the asset
+        CacheKey      = 0x4B434444, // "DDCK", key of a derived data cache entry
+        SceneEntities = 0x53544E45, // "ENTS", UUIDs of all scene entities
+        ComponentPool = 0x4C4F5043, // "CPOL", one chunk per scene component type, the chunk index identifies the component type
+    };
+
+    enum class AssetCompression : u32
+    {
+        None = 0,
+        LZ   = 1, // Independent LZCompression blocks, preceded by the block count, the block size and the compressed size of each block
+    };
+
+    struct AssetChunkEntry
+    {
+        AssetChunkType   Type;
+        u32              Index;
+        u64              Offset;
+        u64              Size;             // Size of the data in the file
+        u64              UncompressedSize;
+        u64              Hash;             // Hash of the data in the file, so corrupted chunks are rejected before decompressing them
+        AssetCompression Compression;
+        u32              Reserved;
+    };
+
+    struct AssetCompressionStats
+    {
+        u64 UncompressedBytesWritten = 0; // Only chunks that were stored compressed are counted
+        u64 CompressedBytesWritten = 0;
+        u64 CompressedBytesRead = 0;
+        u64 DecompressedBytes = 0;
+        f64 DecompressionTime = 0.0;      // Wall time in seconds
+
+        f32 GetCompressionRatio() const { return CompressedBytesWritten ? (f32)UncompressedBytesWritten / CompressedBytesWritten : 1.0f; }
+        f32 GetDecompressionThroughput() const { return DecompressionTime > 0.0 ? DecompressedBytes / DecompressionTime / (1024.0 * 1024.0) : 0.0f; } // MB/s
+    };
+
+    class AssetFile
+    {
+    public:
+        static constexpr u32 Magic = 0x4D4F5441; // "ATOM"
+        static constexpr u32 Version = 2;        // Bump whenever the layout of the container changes. Chunk contents are versioned per asset type by the serializer.
+        static constexpr u64 ChunkAlignment = 64;
+        static constexpr u32 CompressionBlockSize = 256 * 1024; // Blocks are decompressed in parallel
+        static constexpr u64 MinCompressedChunkSize = 4096;    // Smaller chunks are always stored uncompressed
+
+        struct Header
+        {
+            u32 Magic = AssetFile::Magic;
+            u32 Version = AssetFile::Version;
+            u32 ChunkCount = 0;
+            u32 Reserved = 0;
+            u64 TableOffset = 0;
+            u64 TableHash = 0;
+        };
+
+        static u64 ComputeHash(const void* data, u64 size);
+        static AssetCompressionStats GetCompressionStats();
+        static void ResetCompressionStats();
+    private:
+        friend class AssetFileReader;
+        friend class AssetFileWriter;
+
+        inline static std::atomic<u64> ms_UncompressedBytesWritten = 0;
+        inline static std::atomic<u64> ms_CompressedBytesWritten = 0;
+        inline static std::atomic<u64> ms_CompressedBytesRead = 0;
+        inline static std::atomic<u64> ms_DecompressedBytes = 0;
+        inline static std::atomic<u64> ms_DecompressionTime = 0; // In nanoseconds
+    };
+
+    // Sequential reader over the data of a single chunk. Reads past the end of the chunk fail and invalidate the reader.
+    class AssetChunkReader
+    {
+    public:
+        AssetChunkReader() = default;
+        AssetChunkReader(const byte* data, u64 size);
+
+        bool Read(void* destination, u64 size);
+        const byte* ReadView(u64 size);
+
+        template<typename T>
+        bool Read(T& value) { return Read(&value, sizeof(T)); }
+
+        inline bool IsValid() const { return m_Data != nullptr && !m_Failed; }
+        inline const byte* GetData() const { return m_Data; }
+        inline u64 GetSize() const { return m_Size; }
+        inline u64 GetRemainingSize() const { return m_Size - m_Position; }
+    private:
+        const byte* m_Data = nullptr;
+        u64         m_Size = 0;
+        u64         m_Position = 0;
+        bool        m_Failed = false;
+    };
+
+    // Maps an asset file and validates its header and table of contents. Uncompressed chunk data points directly into the mapping,
+    // compressed chunks are decompressed into buffers owned by the reader on first access. Both stay valid for the lifetime of the reader.
+    // Asset files inside mounted asset packs are read from the pack instead of the file system.
+    // Not thread safe, every thread has to use its own reader.
+    class AssetFileReader
+    {
+    public:
+        AssetFileReader(const std::filesystem::path& filepath);
+
+        AssetChunkReader GetChunk(AssetChunkType type, u32 index = 0) const;
+        const AssetChunkEntry* FindChunk(AssetChunkType type, u32 index = 0) const;
+        u32 GetChunkCount(AssetChunkType type) const;
+        u64 GetUncompressedSize() const;
+        const byte* GetStoredChunkData(const AssetChunkEntry& chunk) const; // Data of the chunk as it is stored in the file, nullptr if it does not match its hash
+
+        inline const Vector<AssetChunkEntry>& GetChunks() const { return m_Chunks; }
+
+        inline bool IsValid() const { return m_IsValid; }
+        inline const std::filesystem::path& GetFilepath() const { return m_Filepath; }
+    private:
+        bool VerifyChunk(const AssetChunkEntry& chunk) const;
+        bool DecompressChunk(const AssetChunkEntry& chunk, Vector<byte>& decompressedData) const;
+        inline bool Contains(u64 offset, u64 size) const { return offset <= m_Size && size <= m_Size - offset; }
+    private:
+        std::filesystem::path        m_Filepath;
+        Scope<MappedFile>            m_File;     // Set when the asset is read from a loose file
+        Ref<AssetPackReader>         m_Pack;     // Keeps the pack mapped while the asset is read from it
+        Vector<byte>                 m_FileData; // Contents of the asset file if it is read from a pack that is not memory mapped
+        const byte*                  m_Data = nullptr;
+        u64                          m_Size = 0;
+        Vector<AssetChunkEntry>      m_Chunks;
+        mutable Vector<Vector<byte>> m_DecompressedChunks;
+        mutable Vector<bool>         m_VerifiedChunks; // Chunks are hashed on first access only
+        bool                         m_IsValid = false;
+    };
+
+    // Writes an asset file chunk by chunk. The data of the current chunk is buffered until EndChunk so that its hash can be computed.
+    // Chunks are compressed with the given compression unless they are small or don't get smaller.
+    class AssetFileWriter
+    {
+    public:
+        AssetFileWriter(const std::filesystem::path& filepath, AssetCompression compression = AssetCompression::None);
+
+        void BeginChunk(AssetChunkType type, u32 index = 0);
+        void Write(const void* data, u64 size);
+        void EndChunk();
+        void WriteChunk(AssetChunkType type, u32 index, const void* data, u64 size);
+        void WriteStoredChunk(const AssetChunkEntry& chunk, const void* storedData); // Copies a chunk of another file without recompressing it
+        bool Finalize();
+
+        template<typename T>
+        void Write(const T& value) { Write(&value, sizeof(T)); }
+
+        inline bool IsValid() const { return m_Stream.good(); }
+    private:
+        bool CompressChunk(const void* data, u64 size, Vector<byte>& compressedData);
+    private:
+        std::ofstream           m_Stream;
+        AssetCompression        m_Compression;
+        Vector<AssetChunkEntry> m_Chunks;
+        Vector<byte>            m_ChunkData;
+        AssetChunkType          m_ChunkType = AssetChunkType::Data;
+        u32                     m_ChunkIndex = 0;
+        bool                    m_IsChunkOpen = false;
+    };
+}
\ No newline at end of file
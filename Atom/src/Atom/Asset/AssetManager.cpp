@@ -2,10 +2,14 @@
 #include "AssetManager.h"
 
 #include "Atom/Asset/AssetSerializer.h"
+#include "Atom/Asset/AssetPack.h"
+#include "Atom/Asset/AssetRegistryCache.h"
 #include "Atom/Asset/AnimationAsset.h"
 #include "Atom/Asset/AnimationControllerAsset.h"
 #include "Atom/Asset/MeshAsset.h"
 #include "Atom/Core/Application.h"
+#include "Atom/Renderer/Renderer.h"
+#include "Atom/Renderer/EngineResources.h"
 #include "Atom/Scene/Scene.h"
 
 namespace Atom
@@ -17,149 +21,1091 @@ namespace Atom
         ms_AssetsFolder = std::filesystem::canonical(assetFolder);
 
         RegisterAllAssets(ms_AssetsFolder);
+        InitializeLoaders();
 
-        ms_FileWatcher = CreateScope<filewatch::FileWatch<std::filesystem::path>>(ms_AssetsFolder, [&](const std::filesystem::path& path, const filewatch::Event changeType)
+        // Changes are applied in batches on the main thread, the reloaded assets are deserialized by the loader threads
+        ms_FileWatcher = CreateScope<FileWatcher>(ms_AssetsFolder, [](const Vector<FileChangeEvent>& changes)
         {
-            auto assetPath = ms_AssetsFolder / path;
-            if (changeType == filewatch::Event::added)
+            Application::Get().SubmitForMainThreadExecution([changes]()
             {
-                using namespace std::literals;
-                std::this_thread::sleep_for(1000ms);
+                AssetManager::OnAssetFilesChanged(changes);
+            });
+        });
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool AssetManager::Initialize(const std::filesystem::path& assetFolder, const Vector<std::filesystem::path>& assetPacks)
+    {
+        Shutdown();
+
+        // The assets folder does not have to exist, the paths of the packed assets are only resolved against it
+        ms_AssetsFolder = std::filesystem::weakly_canonical(assetFolder);
+
+        auto startTime = std::chrono::steady_clock::now();
+
+        for (const std::filesystem::path& packPath : assetPacks)
+        {
+            Ref<AssetPackReader> pack = CreateRef<AssetPackReader>(packPath);
+
+            if (!pack->IsValid())
+            {
+                Shutdown();
+                return false;
+            }
+
+            AssetPack::Mount(pack, ms_AssetsFolder);
+
+            std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+            ms_Registry.reserve(ms_Registry.size() + pack->GetEntries().size());
+            ms_AssetPathUUIDs.reserve(ms_AssetPathUUIDs.size() + pack->GetEntries().size());
+
+            // Assets of packs mounted later replace the ones with the same UUID from earlier packs
+            for (const AssetPackEntry& entry : pack->GetEntries())
+            {
+                AssetMetaData metaData;
+                metaData.UUID = entry.UUID;
+                metaData.Type = entry.Type;
+                metaData.Flags = entry.Flags;
+                metaData.AssetFilepath = (ms_AssetsFolder / pack->GetAssetPath(entry)).make_preferred();
+
+                auto it = ms_Registry.find(entry.UUID);
+                if (it != ms_Registry.end())
+                    ms_AssetPathUUIDs.erase(it->second.AssetFilepath);
+
+                ms_AssetPathUUIDs[metaData.AssetFilepath] = metaData.UUID;
+                ms_Registry[metaData.UUID] = std::move(metaData);
+            }
+        }
+
+        ms_RegistryStats = AssetRegistryStats();
+        ms_RegistryStats.AssetCount = ms_Registry.size();
+        ms_RegistryStats.RegistrationTime = std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+        ATOM_INFO("Registered {} assets from {} asset packs in {:.2f} ms", ms_RegistryStats.AssetCount, assetPacks.size(), ms_RegistryStats.RegistrationTime);
+
+        // Packed assets can't change, so there is nothing to watch
+        InitializeLoaders();
+        return true;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetManager::Shutdown()
+    {
+        ms_FileWatcher.reset();
+
+        // Let the loader threads finish their current requests before the registry goes away
+        if (ms_LoaderThreadPool)
+        {
+            ms_LoaderThreadPool->Stop();
+            ms_LoaderThreadPool.reset();
+        }
+
+        AssetPack::UnmountAll();
+
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+        UnloadAllAssets();
+        ms_Registry.clear();
+        ms_AssetPathUUIDs.clear();
+        ms_AssetContentHashes.clear();
+        ms_AssetDependencies.clear();
+        ms_LoadRequests.clear();
+        ms_CompletedLoadRequests.clear();
+
+        {
+            std::lock_guard<std::mutex> releasedAssetsLock(ms_ReleasedAssetsMutex);
+            ms_ReleasedAssets.clear();
+        }
+
+        for (auto& placeholder : ms_PlaceholderAssets)
+            placeholder = nullptr;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetManager::RegisterAsset(const AssetMetaData& metaData)
+    {
+        if (!IsAssetFile(metaData.AssetFilepath))
+            return;
+
+        ATOM_ENGINE_ASSERT((metaData.Flags & AssetFlags::Serialized) != AssetFlags::None);
+
+        if (!std::filesystem::exists(metaData.AssetFilepath))
+        {
+            ATOM_ERROR("Failed registering asset {}. Asset file not found.", metaData.AssetFilepath);
+            return;
+        }
+
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+        ms_Registry[metaData.UUID] = metaData;
+        ms_AssetPathUUIDs[metaData.AssetFilepath] = metaData.UUID;
+        ms_AssetDependencies.erase(metaData.UUID);
+
+        if (metaData.ContentHash)
+            ms_AssetContentHashes[metaData.ContentHash] = metaData.UUID;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetManager::RegisterAsset(const Ref<Asset>& asset)
+    {
+        const AssetMetaData& metaData = asset->GetMetaData();
+
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+        if (asset->GetAssetFlag(AssetFlags::Serialized))
+        {
+            if (!std::filesystem::exists(metaData.AssetFilepath))
+            {
+                ATOM_ERROR("Failed registering asset {}. Asset file not found.", metaData.AssetFilepath);
+                return;
+            }
+
+            ms_AssetPathUUIDs[metaData.AssetFilepath] = metaData.UUID;
+
+            if (metaData.ContentHash)
+                ms_AssetContentHashes[metaData.ContentHash] = metaData.UUID;
+        }
+
+        ms_Registry[metaData.UUID] = metaData;
+        ms_LoadedAssets[metaData.UUID] = asset;
+        ms_AssetDependencies.erase(metaData.UUID);
+
+        // Unregistered on the next UnloadUnusedAssets call unless it gets referenced until then
+        OnAssetReferenceReleased(metaData.UUID);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetManager::RegisterAsset(const std::filesystem::path& assetPath)
+    {
+        if (!IsAssetFile(assetPath))
+            return;
+
+        AssetMetaData metaData;
+        if (!AssetSerializer::DeserializeMetaData(assetPath, metaData))
+        {
+            ATOM_ERROR("Failed registering asset {}. Reading asset meta data failed.", assetPath);
+            return;
+        }
+
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+        ms_Registry[metaData.UUID] = metaData;
+        ms_AssetPathUUIDs[metaData.AssetFilepath] = metaData.UUID;
+        ms_AssetDependencies.erase(metaData.UUID);
+
+        if (metaData.ContentHash)
+            ms_AssetContentHashes[metaData.ContentHash] = metaData.UUID;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetManager::UnregisterAsset(UUID uuid)
+    {
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+        if (!IsAssetValid(uuid))
+            return;
+        
+        RemoveFromCache(uuid);
+        ms_AssetPathUUIDs.erase(ms_Registry[uuid].AssetFilepath);
+        ms_Registry.erase(uuid);
+        ms_LoadedAssets.erase(uuid);
+        ms_AssetReferences.erase(uuid);
+        ms_AssetDependencies.erase(uuid);
+
+        ATOM_INFO("Asset {} unregistered", uuid);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetManager::UnregisterAsset(const std::filesystem::path& assetPath)
+    {
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+        auto it = ms_AssetPathUUIDs.find(assetPath);
+
+        if (it == ms_AssetPathUUIDs.end())
+            return;
+
+        UUID uuid = it->second;
+        RemoveFromCache(uuid);
+        ms_Registry.erase(uuid);
+        ms_LoadedAssets.erase(uuid);
+        ms_AssetReferences.erase(uuid);
+        ms_AssetDependencies.erase(uuid);
+        ms_AssetPathUUIDs.erase(it);
+
+        ATOM_INFO("Asset {} unregistered", uuid);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool AssetManager::LoadAsset(UUID uuid)
+    {
+        Ref<AssetLoadRequest> request = nullptr;
+
+        {
+            std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+            if (!IsAssetValid(uuid))
+            {
+                ATOM_ERROR("Failed loading asset with UUID = {}. Asset was not found in registry.", uuid);
+                return false;
+            }
+
+            if (IsAssetLoaded(uuid))
+                return true;
+
+            bool created;
+            request = GetOrCreateLoadRequest(uuid, created);
+        }
+
+        // Loads the asset on the calling thread unless a loader thread is already working on it
+        WaitForLoadRequest(request);
+
+        // Loader threads only need the deserialized asset, the GPU uploads are submitted once the main thread processes the request
+        if (IsMainThread())
+            ProcessAsyncLoads();
+
+        return request->LoadedAsset != nullptr;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    AssetLoadHandle AssetManager::LoadAssetAsync(UUID uuid)
+    {
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+        if (!IsAssetValid(uuid))
+        {
+            ATOM_ERROR("Failed loading asset with UUID = {}. Asset was not found in registry.", uuid);
+            return AssetLoadHandle();
+        }
+
+        if (IsAssetLoaded(uuid))
+        {
+            Ref<AssetLoadRequest> request = CreateRef<AssetLoadRequest>();
+            request->AssetUUID = uuid;
+            request->LoadedAsset = GetAssetReference(uuid, ms_LoadedAssets[uuid]);
+            request->Status = AssetLoadStatus::Loaded;
+            return AssetLoadHandle(request);
+        }
+
+        bool created;
+        Ref<AssetLoadRequest> request = GetOrCreateLoadRequest(uuid, created);
+
+        if (created)
+        {
+            ms_LoaderThreadPool->EnqueueTask([request]()
+            {
+                ExecuteLoadRequest(request);
+            });
+        }
+
+        return AssetLoadHandle(request);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetManager::ProcessAsyncLoads()
+    {
+        ATOM_ENGINE_ASSERT(IsMainThread());
+
+        Vector<Ref<AssetLoadRequest>> completedRequests;
+
+        {
+            std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+            completedRequests.swap(ms_CompletedLoadRequests);
+        }
+
+        if (completedRequests.empty())
+            return;
+
+        // Uploads of all requests that finished since the last call go out with a single command list
+        Vector<GPUUploadBatch*> uploadBatches;
+        uploadBatches.reserve(completedRequests.size());
+
+        for (auto& request : completedRequests)
+            uploadBatches.push_back(request->Uploads.get());
+
+        Renderer::SubmitUploadBatches(uploadBatches);
+
+        for (auto& request : completedRequests)
+            FinalizeLoadRequest(request);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetManager::WaitForAsyncLoads()
+    {
+        ATOM_ENGINE_ASSERT(IsMainThread());
+
+        // Completion callbacks may start new loads, so keep going until nothing is left
+        while (true)
+        {
+            Vector<Ref<AssetLoadRequest>> pendingRequests;
+
+            {
+                std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+                for (auto& [uuid, request] : ms_LoadRequests)
+                    pendingRequests.push_back(request);
+            }
+
+            if (pendingRequests.empty())
+                break;
+
+            for (auto& request : pendingRequests)
+                WaitForLoadRequest(request);
+
+            ProcessAsyncLoads();
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    u32 AssetManager::GetPendingLoadCount()
+    {
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+        return ms_LoadRequests.size();
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    Ref<Asset> AssetManager::GetPlaceholderAsset(AssetType type)
+    {
+        return ms_PlaceholderAssets[(u32)type];
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool AssetManager::ReloadAsset(UUID uuid)
+    {
+        AssetMetaData metaData;
+        Ref<Asset> loadedAsset = nullptr;
+
+        {
+            std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+            if (!IsAssetValid(uuid))
+                return false;
+
+            if (!IsAssetLoaded(uuid))
+                return LoadAsset(uuid);
+
+            metaData = ms_Registry[uuid];
+            loadedAsset = ms_LoadedAssets[uuid];
+        }
+
+        // Scenes are not reloaded in place, they are deserialized again when they are opened
+        if (metaData.Type == AssetType::Scene)
+            return true;
+
+        if (ReloadChangedChunks(uuid))
+            return true;
+
+        Ref<Asset> newAsset = DeserializeAsset(metaData);
+        bool result = newAsset && ReplaceAsset(loadedAsset, newAsset);
+
+        if (!result)
+        {
+            ATOM_ERROR("Failed reloading asset {}({}). Asset deserialization failed.", metaData.AssetFilepath, uuid);
+            return false;
+        }
+
+        {
+            std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+            ms_AssetDependencies.erase(uuid);
+        }
+
+        ATOM_INFO("Asset {}({}) reloaded", metaData.AssetFilepath, uuid);
+        return true;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    AssetLoadHandle AssetManager::ReloadAssetAsync(UUID uuid)
+    {
+        // Changes that only touch chunks which can be read on their own are applied right away, without a load request
+        if (ReloadChangedChunks(uuid))
+            return AssetLoadHandle();
+
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+        if (!IsAssetValid(uuid) || !IsAssetLoaded(uuid) || ms_Registry[uuid].Type == AssetType::Scene)
+            return AssetLoadHandle();
+
+        // Cached assets are not in use, reading them again is left to the next load
+        if (ms_CachedAssetEntries.find(uuid) != ms_CachedAssetEntries.end())
+        {
+            UnloadAsset(uuid);
+            return AssetLoadHandle();
+        }
+
+        auto requestIt = ms_LoadRequests.find(uuid);
+        if (requestIt != ms_LoadRequests.end())
+        {
+            // A request that already started might have read the previous contents of the file, so the asset is reloaded again after it
+            AssetLoadHandle handle(requestIt->second);
+
+            if (requestIt->second->Status != AssetLoadStatus::Queued)
+                handle.OnLoaded([uuid](const Ref<Asset>&) { ReloadAssetAsync(uuid); });
+
+            return handle;
+        }
+
+        bool created;
+        Ref<AssetLoadRequest> request = GetOrCreateLoadRequest(uuid, created);
+        request->IsReload = true;
+
+        ms_LoaderThreadPool->EnqueueTask([request]()
+        {
+            ExecuteLoadRequest(request);
+        });
+
+        return AssetLoadHandle(request);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool AssetManager::ReloadChangedChunks(UUID uuid)
+    {
+        Ref<Asset> asset = nullptr;
+        std::filesystem::path assetPath;
+
+        {
+            std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+            // Cached assets are not in use and assets that are being loaded might have read either version of the file
+            if (!IsAssetValid(uuid) || !IsAssetLoaded(uuid) || ms_CachedAssetEntries.find(uuid) != ms_CachedAssetEntries.end() || ms_LoadRequests.find(uuid) != ms_LoadRequests.end())
+                return false;
+
+            asset = ms_LoadedAssets[uuid];
+            assetPath = ms_Registry[uuid].AssetFilepath;
+        }
+
+        // The lock is not held while reading, since applying the changes can load other assets synchronously
+        u32 changedChunkCount = 0;
+        if (!AssetSerializer::DeserializeChangedChunks(asset, assetPath, changedChunkCount))
+            return false;
+
+        if (changedChunkCount == 0)
+            return true;
+
+        asset->m_Revision++;
+
+        // The metadata might have changed as well, registering it again also drops the cached dependencies
+        RegisterAsset(asset->GetMetaData());
+
+        ATOM_INFO("Asset {}({}) reloaded in place, {} changed chunks were read", assetPath, uuid, changedChunkCount);
+        return true;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetManager::UnloadAsset(UUID uuid)
+    {
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+        if (!IsAssetValid(uuid) || !IsAssetLoaded(uuid))
+            return;
+
+        // Assets that are still referenced stay alive until their last reference is released
+        RemoveFromCache(uuid);
+        ms_LoadedAssets.erase(uuid);
+        ms_AssetReferences.erase(uuid);
+        ATOM_INFO("Asset {}({}) unloaded", ms_Registry[uuid].AssetFilepath, uuid);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetManager::UnloadAllAssets()
+    {
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+        ms_LoadedAssets.clear();
+        ms_AssetReferences.clear();
+        ms_CachedAssetEntries.clear();
+
+        for (u32 i = 0; i < (u32)AssetType::NumTypes; i++)
+        {
+            ms_CachedAssets[i].clear();
+            ms_CacheStats[i].CachedAssetCount = 0;
+            ms_CacheStats[i].CachedMemory = 0;
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetManager::UnloadUnusedAssets()
+    {
+        // Unloading an asset releases its references to its dependencies, so keep going until no more references are released
+        while (true)
+        {
+            bool hasReleasedAssets = ProcessReleasedAssets();
+
+            // Destroyed after the lock is released
+            Vector<Ref<Asset>> unloadedAssets;
+
+            {
+                std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+                for (u32 i = 0; i < (u32)AssetType::NumTypes; i++)
+                {
+                    while (!ms_CachedAssets[i].empty())
+                    {
+                        UUID uuid = ms_CachedAssets[i].front().AssetUUID;
+                        unloadedAssets.push_back(ms_LoadedAssets[uuid]);
+                        RemoveFromCache(uuid);
+                        UnloadAsset(uuid);
+                        ms_CacheStats[i].Evictions++;
+                    }
+                }
+            }
+
+            if (!hasReleasedAssets && unloadedAssets.empty())
+                break;
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetManager::UpdateAssetCache()
+    {
+        ProcessReleasedAssets();
+        EvictFromCache();
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    Vector<UUID> AssetManager::GetAssetDependencies(UUID uuid, bool recursive)
+    {
+        Vector<UUID> dependencies;
+        HashSet<UUID> visitedAssets = { uuid };
+        Vector<UUID> frontier = { uuid };
+
+        // The graph is walked level by level and the dependencies of all assets in a level that are not cached yet are read in parallel
+        while (!frontier.empty())
+        {
+            Vector<Vector<UUID>> frontierDependencies(frontier.size());
+            Vector<u32> uncachedAssets;
+            Vector<std::filesystem::path> uncachedAssetPaths;
+
+            {
+                std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+                for (u32 i = 0; i < frontier.size(); i++)
+                {
+                    auto dependenciesIt = ms_AssetDependencies.find(frontier[i]);
+                    if (dependenciesIt != ms_AssetDependencies.end())
+                    {
+                        frontierDependencies[i] = dependenciesIt->second;
+                        continue;
+                    }
+
+                    // Only serialized assets record their dependencies
+                    auto registryIt = ms_Registry.find(frontier[i]);
+                    if (registryIt != ms_Registry.end() && (registryIt->second.Flags & AssetFlags::Serialized) != AssetFlags::None)
+                    {
+                        uncachedAssets.push_back(i);
+                        uncachedAssetPaths.push_back(registryIt->second.AssetFilepath);
+                    }
+                }
+            }
+
+            if (!uncachedAssets.empty())
+            {
+                Application::Get().GetWorkerThreadPool().ParallelFor(uncachedAssets.size(), 8, [&](u32 begin, u32 end)
+                {
+                    for (u32 i = begin; i < end; i++)
+                        AssetSerializer::DeserializeDependencies(uncachedAssetPaths[i], frontierDependencies[uncachedAssets[i]]);
+                });
+
+                std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+                for (u32 i : uncachedAssets)
+                    ms_AssetDependencies[frontier[i]] = frontierDependencies[i];
+            }
+
+            Vector<UUID> nextFrontier;
+
+            for (const Vector<UUID>& assetDependencies : frontierDependencies)
+            {
+                for (UUID dependency : assetDependencies)
+                {
+                    if (visitedAssets.insert(dependency).second)
+                    {
+                        dependencies.push_back(dependency);
+                        nextFrontier.push_back(dependency);
+                    }
+                }
+            }
+
+            if (!recursive)
+                break;
+
+            frontier.swap(nextFrontier);
+        }
+
+        return dependencies;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    Vector<AssetLoadHandle> AssetManager::PrefetchAssetDependencies(UUID uuid)
+    {
+        Vector<UUID> dependencies = GetAssetDependencies(uuid, true);
+
+        Vector<AssetLoadHandle> handles;
+        handles.reserve(dependencies.size());
+
+        // The furthest dependencies are queued first, so the loader threads rarely have to wait for the assets that others depend on
+        for (auto it = dependencies.rbegin(); it != dependencies.rend(); it++)
+        {
+            if (IsAssetValid(*it))
+                handles.push_back(LoadAssetAsync(*it));
+        }
+
+        return handles;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    HashMap<UUID, AssetMetaData> AssetManager::GetRegistry()
+    {
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+        return ms_Registry;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    UUID AssetManager::GetUUIDForAssetPath(const std::filesystem::path& assetPath)
+    {
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+        auto it = ms_AssetPathUUIDs.find(GetAssetFullPath(assetPath));
+
+        if (it == ms_AssetPathUUIDs.end())
+            return 0;
+
+        return it->second;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    UUID AssetManager::FindAssetByContentHash(AssetType type, u64 contentHash)
+    {
+        if (!contentHash)
+            return 0;
+
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+        auto it = ms_AssetContentHashes.find(contentHash);
+
+        if (it == ms_AssetContentHashes.end())
+            return 0;
+
+        // Entries are not removed when an asset is registered again with different content, so check that the asset still matches.
+        // Loaded assets are checked against their own metadata, which is updated when an edited asset is serialized.
+        auto registryIt = ms_Registry.find(it->second);
+
+        if (registryIt == ms_Registry.end())
+            return 0;
+
+        auto loadedIt = ms_LoadedAssets.find(it->second);
+        const AssetMetaData& metaData = loadedIt != ms_LoadedAssets.end() ? loadedIt->second->GetMetaData() : registryIt->second;
+
+        if (metaData.Type != type || metaData.ContentHash != contentHash)
+            return 0;
+
+        return it->second;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    std::filesystem::path AssetManager::GetAssetFullPath(const std::filesystem::path& assetPath)
+    {
+        return ms_AssetsFolder / assetPath;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    const std::filesystem::path& AssetManager::GetAssetsFolder()
+    {
+        return ms_AssetsFolder;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool AssetManager::IsAssetFile(const std::filesystem::path& filepath)
+    {
+        for (u32 i = 0; i < (u32)AssetType::NumTypes; i++)
+            if (filepath.extension() == Asset::AssetFileExtensions[i])
+                return true;
+
+        return false;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetManager::RegisterAllAssets(const std::filesystem::path& assetFolder)
+    {
+        ATOM_ENGINE_ASSERT(std::filesystem::exists(assetFolder));
+
+        auto startTime = std::chrono::steady_clock::now();
+
+        // The cache lives next to the assets folder, so writing it does not trigger the file watcher
+        std::filesystem::path cachePath = assetFolder.parent_path() / (assetFolder.filename().string() + ".atmregistry");
+        HashMap<String, AssetRegistryCacheEntry> cachedEntries;
+        bool isWarmStart = AssetRegistryCache::Load(cachePath, assetFolder, cachedEntries);
+
+        Vector<std::filesystem::path> assetPaths;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(assetFolder))
+        {
+            if (entry.is_regular_file() && IsAssetFile(entry.path()))
+                assetPaths.push_back(entry.path());
+        }
+
+        // Files are only stat'ed, their metadata is read only if they are not in the cache or changed since it was written
+        Vector<AssetRegistryCacheEntry> entries(assetPaths.size());
+        Vector<u8> isEntryValid(assetPaths.size(), false);
+        std::atomic<u32> cachedAssetCount = 0;
+
+        Application::Get().GetWorkerThreadPool().ParallelFor(assetPaths.size(), 64, [&](u32 begin, u32 end)
+        {
+            for (u32 i = begin; i < end; i++)
+            {
+                std::error_code error;
+                u64 fileSize = std::filesystem::file_size(assetPaths[i], error);
+                s64 writeTime = error ? 0 : std::filesystem::last_write_time(assetPaths[i], error).time_since_epoch().count();
+
+                if (error)
+                    continue;
+
+                auto it = cachedEntries.find(AssetRegistryCache::GetCacheKey(assetPaths[i], assetFolder));
+
+                if (it != cachedEntries.end() && it->second.FileSize == fileSize && it->second.WriteTime == writeTime)
+                {
+                    entries[i] = it->second;
+                    isEntryValid[i] = true;
+                    cachedAssetCount++;
+                    continue;
+                }
+
+                entries[i].FileSize = fileSize;
+                entries[i].WriteTime = writeTime;
+
+                if (!AssetSerializer::DeserializeMetaData(assetPaths[i], entries[i].MetaData))
+                {
+                    ATOM_ERROR("Failed registering asset {}. Reading asset meta data failed.", assetPaths[i]);
+                    continue;
+                }
+
+                isEntryValid[i] = true;
+            }
+        });
+
+        Vector<AssetRegistryCacheEntry> validEntries;
+        validEntries.reserve(entries.size());
+
+        {
+            std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+            ms_Registry.reserve(entries.size());
+            ms_AssetPathUUIDs.reserve(entries.size());
+
+            for (u32 i = 0; i < entries.size(); i++)
+            {
+                if (!isEntryValid[i])
+                    continue;
+
+                const AssetMetaData& metaData = entries[i].MetaData;
+                ms_Registry[metaData.UUID] = metaData;
+                ms_AssetPathUUIDs[metaData.AssetFilepath] = metaData.UUID;
+
+                if (metaData.ContentHash)
+                    ms_AssetContentHashes[metaData.ContentHash] = metaData.UUID;
+
+                validEntries.push_back(std::move(entries[i]));
+            }
+        }
+
+        // Only rewritten if assets were added, changed or removed
+        if (!isWarmStart || cachedAssetCount != validEntries.size() || cachedAssetCount != cachedEntries.size())
+            AssetRegistryCache::Save(cachePath, assetFolder, validEntries);
+
+        ms_RegistryStats.AssetCount = validEntries.size();
+        ms_RegistryStats.CachedAssetCount = cachedAssetCount;
+        ms_RegistryStats.ReadAssetCount = validEntries.size() - cachedAssetCount;
+        ms_RegistryStats.IsWarmStart = isWarmStart;
+        ms_RegistryStats.RegistrationTime = std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+        ATOM_INFO("Registered {} assets in {:.2f} ms ({} start, {} from the registry cache, {} read from their files)", ms_RegistryStats.AssetCount, ms_RegistryStats.RegistrationTime,
+            isWarmStart ? "warm" : "cold", ms_RegistryStats.CachedAssetCount, ms_RegistryStats.ReadAssetCount);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetManager::InitializeLoaders()
+    {
+        ms_LoaderThreadPool = CreateScope<ThreadPool>(LoaderThreadCount);
+        ms_LoaderThreadPool->Start();
+
+        // Shown by the users of async loads until the actual asset is ready
+        ms_PlaceholderAssets[(u32)AssetType::Texture2D] = CreateRef<Texture2D>(EngineResources::BlackTexture, false);
+        ms_PlaceholderAssets[(u32)AssetType::TextureCube] = CreateRef<TextureCube>(EngineResources::BlackTextureCube, false);
+        ms_PlaceholderAssets[(u32)AssetType::Material] = EngineResources::DefaultMaterial;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    const AssetRegistryStats& AssetManager::GetRegistryStats()
+    {
+        return ms_RegistryStats;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetManager::SetCacheBudget(AssetType type, u64 budget)
+    {
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+        ms_CacheBudgets[(u32)type] = budget;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    u64 AssetManager::GetCacheBudget(AssetType type)
+    {
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+        return ms_CacheBudgets[(u32)type];
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    AssetCacheStats AssetManager::GetCacheStats(AssetType type)
+    {
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+        AssetCacheStats stats = ms_CacheStats[(u32)type];
+        stats.Budget = ms_CacheBudgets[(u32)type];
+        return stats;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    AssetCacheStats AssetManager::GetCacheStats()
+    {
+        AssetCacheStats totalStats;
+
+        for (u32 i = 0; i < (u32)AssetType::NumTypes; i++)
+        {
+            AssetCacheStats stats = GetCacheStats((AssetType)i);
+            totalStats.Hits += stats.Hits;
+            totalStats.Misses += stats.Misses;
+            totalStats.Evictions += stats.Evictions;
+            totalStats.CachedAssetCount += stats.CachedAssetCount;
+            totalStats.CachedMemory += stats.CachedMemory;
+            totalStats.Budget += stats.Budget;
+        }
+
+        return totalStats;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetManager::ResetCacheStats()
+    {
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+        for (AssetCacheStats& stats : ms_CacheStats)
+        {
+            stats.Hits = 0;
+            stats.Misses = 0;
+            stats.Evictions = 0;
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    AssetLoadStats AssetManager::GetLoadStats(AssetType type)
+    {
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+        return ms_LoadStats[(u32)type];
+    }
 
-                Application::Get().SubmitForMainThreadExecution([=]()
-                {
-                    AssetManager::RegisterAsset(assetPath);
-                });
-            }
-            else if (changeType == filewatch::Event::modified && !ms_PendingReloads[ms_AssetPathUUIDs[assetPath]])
-            {
-                ms_PendingReloads[ms_AssetPathUUIDs[assetPath]] = true;
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetManager::ResetLoadStats()
+    {
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
 
-                using namespace std::literals;
-                std::this_thread::sleep_for(1000ms);
+        for (AssetLoadStats& stats : ms_LoadStats)
+            stats = AssetLoadStats();
+    }
 
-                Application::Get().SubmitForMainThreadExecution([=]()
-                {
-                    AssetManager::ReloadAsset(ms_AssetPathUUIDs[assetPath]);
-                });
-            }
-            else if (changeType == filewatch::Event::removed)
-            {
-                UnregisterAsset(assetPath);
-            }
-        });
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool AssetManager::IsAssetValid(UUID uuid)
+    {
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+        return ms_Registry.find(uuid) != ms_Registry.end();
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    void AssetManager::Shutdown()
+    bool AssetManager::IsAssetLoaded(UUID uuid)
     {
-        ms_Registry.clear();
-        ms_AssetPathUUIDs.clear();
-        ms_LoadedAssets.clear();
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+        return ms_LoadedAssets.find(uuid) != ms_LoadedAssets.end();
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    void AssetManager::RegisterAsset(const AssetMetaData& metaData)
+    std::optional<AssetMetaData> AssetManager::GetAssetMetaData(UUID uuid)
     {
-        if (!IsAssetFile(metaData.AssetFilepath))
-            return;
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
 
-        ATOM_ENGINE_ASSERT((metaData.Flags & AssetFlags::Serialized) != AssetFlags::None);
+        auto it = ms_Registry.find(uuid);
 
-        if (!std::filesystem::exists(metaData.AssetFilepath))
+        if (it != ms_Registry.end())
+            return it->second;
+
+        return std::nullopt;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    u32 AssetManager::GetAssetRefCount(UUID uuid)
+    {
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+        if (!IsAssetValid(uuid) || !IsAssetLoaded(uuid))
+            return 0;
+
+        auto it = ms_AssetReferences.find(uuid);
+        return it != ms_AssetReferences.end() ? it->second.use_count() : 0;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    Ref<Asset> AssetManager::GetLoadedAsset(UUID uuid)
+    {
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+        auto it = ms_LoadedAssets.find(uuid);
+        if (it != ms_LoadedAssets.end())
+            return GetAssetReference(uuid, it->second);
+
+        // Loader threads may use dependencies whose GPU uploads are still waiting for the main thread. Those are submitted together
+        // with the uploads of the dependent asset at the latest.
+        if (!IsMainThread())
         {
-            ATOM_ERROR("Failed registering asset {}. Asset file not found.", metaData.AssetFilepath);
-            return;
+            auto requestIt = ms_LoadRequests.find(uuid);
+            if (requestIt != ms_LoadRequests.end() && requestIt->second->Status == AssetLoadStatus::PendingUpload && requestIt->second->LoadedAsset)
+                return GetAssetReference(uuid, requestIt->second->LoadedAsset);
         }
 
-        ms_Registry[metaData.UUID] = metaData;
-        ms_AssetPathUUIDs[metaData.AssetFilepath] = metaData.UUID;
-        ms_PendingReloads[metaData.UUID] = false;
+        return nullptr;
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    void AssetManager::RegisterAsset(const Ref<Asset>& asset)
+    Ref<Asset> AssetManager::GetAssetReference(UUID uuid, const Ref<Asset>& asset)
     {
-        const AssetMetaData& metaData = asset->GetMetaData();
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
 
-        if (asset->GetAssetFlag(AssetFlags::Serialized))
+        std::weak_ptr<Asset>& reference = ms_AssetReferences[uuid];
+
+        if (Ref<Asset> existingReference = reference.lock(); existingReference && existingReference.get() == asset.get())
+            return existingReference;
+
+        // Cached assets are referenced again before they got evicted
+        if (RemoveFromCache(uuid))
+            ms_CacheStats[(u32)asset->GetAssetType()].Hits++;
+
+        // All references share one control block whose deleter notifies the asset manager once the last of them is released. The deleter
+        // also keeps the asset alive, in case it gets unloaded explicitly while it is still referenced.
+        Ref<Asset> newReference(asset.get(), [uuid, ownedAsset = asset](Asset*) mutable
         {
-            if (!std::filesystem::exists(metaData.AssetFilepath))
-            {
-                ATOM_ERROR("Failed registering asset {}. Asset file not found.", metaData.AssetFilepath);
-                return;
-            }
+            ownedAsset = nullptr;
+            OnAssetReferenceReleased(uuid);
+        });
 
-            ms_AssetPathUUIDs[metaData.AssetFilepath] = metaData.UUID;
-            ms_PendingReloads[metaData.UUID] = false;
-        }
+        reference = newReference;
+        return newReference;
+    }
 
-        ms_Registry[metaData.UUID] = metaData;
-        ms_LoadedAssets[metaData.UUID] = asset;
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetManager::OnAssetReferenceReleased(UUID uuid)
+    {
+        // References can be released on any thread, the assets are unloaded by the main thread
+        std::lock_guard<std::mutex> lock(ms_ReleasedAssetsMutex);
+        ms_ReleasedAssets.push_back(uuid);
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    void AssetManager::RegisterAsset(const std::filesystem::path& assetPath)
+    bool AssetManager::ProcessReleasedAssets()
     {
-        if (!IsAssetFile(assetPath))
-            return;
+        Vector<UUID> releasedAssets;
 
-        AssetMetaData metaData;
-        if (!AssetSerializer::DeserializeMetaData(assetPath, metaData))
         {
-            ATOM_ERROR("Failed registering asset {}. Reading asset meta data failed.", assetPath);
-            return;
+            std::lock_guard<std::mutex> releasedAssetsLock(ms_ReleasedAssetsMutex);
+            releasedAssets.swap(ms_ReleasedAssets);
         }
 
-        ms_Registry[metaData.UUID] = metaData;
-        ms_AssetPathUUIDs[metaData.AssetFilepath] = metaData.UUID;
-        ms_PendingReloads[metaData.UUID] = false;
+        if (releasedAssets.empty())
+            return false;
+
+        for (UUID uuid : releasedAssets)
+        {
+            // Destroyed after the lock is released
+            Ref<Asset> asset = nullptr;
+
+            std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+            auto assetIt = ms_LoadedAssets.find(uuid);
+            if (assetIt == ms_LoadedAssets.end())
+                continue;
+
+            // The asset might have been referenced again since the last reference was released
+            auto referenceIt = ms_AssetReferences.find(uuid);
+            if (referenceIt != ms_AssetReferences.end() && !referenceIt->second.expired())
+                continue;
+
+            asset = assetIt->second;
+
+            // Virtual assets can't be loaded again once they are gone, so there is no point in caching them
+            if (asset->GetAssetFlag(AssetFlags::Serialized))
+                AddToCache(asset);
+            else
+                UnregisterAsset(uuid);
+        }
+
+        return true;
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    void AssetManager::UnregisterAsset(UUID uuid)
+    void AssetManager::AddToCache(const Ref<Asset>& asset)
     {
-        if (!IsAssetValid(uuid))
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+        if (ms_CachedAssetEntries.find(asset->GetUUID()) != ms_CachedAssetEntries.end())
             return;
-        
-        ms_AssetPathUUIDs.erase(ms_Registry[uuid].AssetFilepath);
-        ms_Registry.erase(uuid);
-        ms_LoadedAssets.erase(uuid);
-        ms_PendingReloads.erase(uuid);
 
-        ATOM_INFO("Asset {} unregistered", uuid);
+        std::list<AssetCacheEntry>& cachedAssets = ms_CachedAssets[(u32)asset->GetAssetType()];
+        cachedAssets.push_back({ asset->GetUUID(), asset->GetAssetType(), asset->GetMemorySize() });
+        ms_CachedAssetEntries[asset->GetUUID()] = std::prev(cachedAssets.end());
+
+        AssetCacheStats& stats = ms_CacheStats[(u32)asset->GetAssetType()];
+        stats.CachedAssetCount++;
+        stats.CachedMemory += asset->GetMemorySize();
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    void AssetManager::UnregisterAsset(const std::filesystem::path& assetPath)
+    bool AssetManager::RemoveFromCache(UUID uuid)
     {
-        auto it = ms_AssetPathUUIDs.find(assetPath);
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
 
-        if (it == ms_AssetPathUUIDs.end())
-            return;
+        auto entryIt = ms_CachedAssetEntries.find(uuid);
+        if (entryIt == ms_CachedAssetEntries.end())
+            return false;
 
-        UUID uuid = it->second;
-        ms_Registry.erase(uuid);
-        ms_LoadedAssets.erase(uuid);
-        ms_PendingReloads.erase(uuid);
-        ms_AssetPathUUIDs.erase(it);
+        // The entry keeps the size the asset was cached with, the asset might have been reloaded since then
+        const AssetCacheEntry& entry = *entryIt->second;
+        AssetCacheStats& stats = ms_CacheStats[(u32)entry.Type];
+        stats.CachedAssetCount--;
+        stats.CachedMemory -= entry.MemorySize;
 
-        ATOM_INFO("Asset {} unregistered", uuid);
+        ms_CachedAssets[(u32)entry.Type].erase(entryIt->second);
+        ms_CachedAssetEntries.erase(entryIt);
+        return true;
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    bool AssetManager::LoadAsset(UUID uuid)
+    void AssetManager::EvictFromCache()
     {
-        if (!IsAssetValid(uuid))
+        // Destroyed after the lock is released. The references they hold to their dependencies are released at that point, so the
+        // dependencies enter the cache on the next update.
+        Vector<Ref<Asset>> evictedAssets;
+
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+        // Only a few assets are evicted per frame, so that releasing a whole level doesn't cause a spike
+        for (u32 i = 0; i < (u32)AssetType::NumTypes && evictedAssets.size() < MaxEvictionsPerFrame; i++)
         {
-            ATOM_ERROR("Failed loading asset with UUID = {}. Asset was not found in registry.", uuid);
-            return false;
-        }
+            AssetCacheStats& stats = ms_CacheStats[i];
 
-        if (IsAssetLoaded(uuid))
-            return true;
+            while (!ms_CachedAssets[i].empty() && stats.CachedMemory > ms_CacheBudgets[i] && evictedAssets.size() < MaxEvictionsPerFrame)
+            {
+                UUID uuid = ms_CachedAssets[i].front().AssetUUID;
+                evictedAssets.push_back(ms_LoadedAssets[uuid]);
+                RemoveFromCache(uuid);
+                UnloadAsset(uuid);
+                stats.Evictions++;
+            }
+        }
+    }
 
-        AssetMetaData& metaData = ms_Registry[uuid];
+    // -----------------------------------------------------------------------------------------------------------------------------
+    Ref<Asset> AssetManager::DeserializeAsset(const AssetMetaData& metaData)
+    {
+        auto startTime = std::chrono::steady_clock::now();
         Ref<Asset> asset = nullptr;
 
         switch (metaData.Type)
@@ -174,68 +1120,68 @@ namespace Atom
             case AssetType::AnimationController: asset = AssetSerializer::Deserialize<AnimationController>(metaData.AssetFilepath); break;
         }
 
-        if (!asset)
+        if (asset)
         {
-            ATOM_ERROR("Failed loading asset {}({}). Asset deserialization failed.", metaData.AssetFilepath, uuid);
-            return false;
+            std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+            AssetLoadStats& stats = ms_LoadStats[(u32)metaData.Type];
+            stats.LoadCount++;
+            stats.LoadedMemory += asset->GetMemorySize();
+            stats.LoadTime += std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - startTime).count();
         }
 
-        ms_LoadedAssets[uuid] = asset;
-        ATOM_INFO("Successfully loaded asset {}({})", metaData.AssetFilepath, uuid);
-        return true;
+        return asset;
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    bool AssetManager::ReloadAsset(UUID uuid)
+    bool AssetManager::ReplaceAsset(const Ref<Asset>& asset, const Ref<Asset>& newAsset)
     {
-        if (!IsAssetValid(uuid))
-            return false;
-
-        if (!IsAssetLoaded(uuid))
-            return LoadAsset(uuid);
+        ATOM_ENGINE_ASSERT(asset->GetAssetType() == newAsset->GetAssetType());
 
-        AssetMetaData& metaData = ms_Registry[uuid];
+        // The contents are moved into the existing asset, so everything that references it picks up the changes. The revision
+        // tells caches built from the previous contents that they are stale.
+        u32 revision = asset->m_Revision;
         bool result = false;
 
-        switch (metaData.Type)
+        switch (asset->GetAssetType())
         {
             case AssetType::Texture2D:
             {
-                Ref<Texture2D> textureAsset = AssetSerializer::Deserialize<Texture2D>(metaData.AssetFilepath);
+                Ref<Texture2D> textureAsset = std::dynamic_pointer_cast<Texture2D>(newAsset);
                 result = textureAsset != nullptr;
 
                 if(result)
-                    *std::dynamic_pointer_cast<Texture2D>(ms_LoadedAssets[uuid]) = std::move(*textureAsset);
+                    *std::dynamic_pointer_cast<Texture2D>(asset) = std::move(*textureAsset);
 
                 break;
             }
             case AssetType::TextureCube:
             {
-                Ref<TextureCube> textureAsset = AssetSerializer::Deserialize<TextureCube>(metaData.AssetFilepath); 
+                Ref<TextureCube> textureAsset = std::dynamic_pointer_cast<TextureCube>(newAsset);
                 result = textureAsset != nullptr;
 
                 if (result)
-                    *std::dynamic_pointer_cast<TextureCube>(ms_LoadedAssets[uuid]) = std::move(*textureAsset);
+                    *std::dynamic_pointer_cast<TextureCube>(asset) = std::move(*textureAsset);
 
                 break;
             }
             case AssetType::Material:
             {
-                Ref<Material> materialAsset = AssetSerializer::Deserialize<Material>(metaData.AssetFilepath);
+                Ref<Material> materialAsset = std::dynamic_pointer_cast<Material>(newAsset);
                 result = materialAsset != nullptr;
 
                 if (result)
-                    *std::dynamic_pointer_cast<Material>(ms_LoadedAssets[uuid]) = std::move(*materialAsset);
+                    *std::dynamic_pointer_cast<Material>(asset) = std::move(*materialAsset);
 
                 break;
             }
             case AssetType::Mesh:
             {
-                Ref<Mesh> meshAsset = AssetSerializer::Deserialize<Mesh>(metaData.AssetFilepath);
+                Ref<Mesh> meshAsset = std::dynamic_pointer_cast<Mesh>(newAsset);
                 result = meshAsset != nullptr;
 
                 if (result)
-                    *std::dynamic_pointer_cast<Mesh>(ms_LoadedAssets[uuid]) = std::move(*meshAsset);
+                    *std::dynamic_pointer_cast<Mesh>(asset) = std::move(*meshAsset);
 
                 break;
             }
@@ -246,170 +1192,295 @@ namespace Atom
             }
             case AssetType::Animation:
             {
-                Ref<Animation> animationAsset = AssetSerializer::Deserialize<Animation>(metaData.AssetFilepath);
+                Ref<Animation> animationAsset = std::dynamic_pointer_cast<Animation>(newAsset);
                 result = animationAsset != nullptr;
 
                 if (result)
-                    *std::dynamic_pointer_cast<Animation>(ms_LoadedAssets[uuid]) = std::move(*animationAsset);
+                    *std::dynamic_pointer_cast<Animation>(asset) = std::move(*animationAsset);
 
                 break;
             }
             case AssetType::Skeleton:
             {
-                Ref<Skeleton> skeletonAsset = AssetSerializer::Deserialize<Skeleton>(metaData.AssetFilepath);
+                Ref<Skeleton> skeletonAsset = std::dynamic_pointer_cast<Skeleton>(newAsset);
                 result = skeletonAsset != nullptr;
 
                 if (result)
-                    *std::dynamic_pointer_cast<Skeleton>(ms_LoadedAssets[uuid]) = std::move(*skeletonAsset);
+                    *std::dynamic_pointer_cast<Skeleton>(asset) = std::move(*skeletonAsset);
 
                 break;
             }
             case AssetType::AnimationController:
             {
-                Ref<AnimationController> animControllerAsset = AssetSerializer::Deserialize<AnimationController>(metaData.AssetFilepath);
+                Ref<AnimationController> animControllerAsset = std::dynamic_pointer_cast<AnimationController>(newAsset);
                 result = animControllerAsset != nullptr;
 
                 if (result)
-                    *std::dynamic_pointer_cast<AnimationController>(ms_LoadedAssets[uuid]) = std::move(*animControllerAsset);
+                    *std::dynamic_pointer_cast<AnimationController>(asset) = std::move(*animControllerAsset);
 
                 break;
             }
         }
 
-        if (!result)
-        {
-            ATOM_ERROR("Failed reloading asset {}({}). Asset deserialization failed.", metaData.AssetFilepath, uuid);
-            return false;
-        }
+        if (result)
+            asset->m_Revision = revision + 1;
 
-        ms_PendingReloads[uuid] = false;
-        ATOM_INFO("Asset {}({}) reloaded", metaData.AssetFilepath, uuid);
-        return true;
+        return result;
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    void AssetManager::UnloadAsset(UUID uuid)
+    void AssetManager::OnAssetFilesChanged(const Vector<FileChangeEvent>& changes)
     {
-        if (!IsAssetValid(uuid) || !IsAssetLoaded(uuid))
+        ATOM_ENGINE_ASSERT(IsMainThread());
+
+        Vector<std::filesystem::path> addedAssetPaths;
+
+        for (const FileChangeEvent& event : changes)
+        {
+            if (!IsAssetFile(event.Filepath))
+                continue;
+
+            UUID uuid = GetUUIDForAssetPath(event.Filepath);
+
+            if (event.Change == FileChange::Removed)
+                UnregisterAsset(event.Filepath);
+            else if (uuid == 0)
+                addedAssetPaths.push_back(event.Filepath);
+            else if (event.Change == FileChange::Modified)
+                ReloadAssetAsync(uuid);
+        }
+
+        if (addedAssetPaths.empty())
             return;
 
-        ms_LoadedAssets.erase(uuid);
-        ATOM_INFO("Asset {}({}) unloaded", ms_Registry[uuid].AssetFilepath, uuid);
+        // Copying many assets into the folder at once produces large batches, so their metadata is read in parallel
+        Vector<AssetMetaData> addedAssets(addedAssetPaths.size());
+        Vector<u8> isValid(addedAssetPaths.size(), false);
+
+        Application::Get().GetWorkerThreadPool().ParallelFor(addedAssetPaths.size(), 16, [&](u32 begin, u32 end)
+        {
+            for (u32 i = begin; i < end; i++)
+                isValid[i] = AssetSerializer::DeserializeMetaData(addedAssetPaths[i], addedAssets[i]);
+        });
+
+        for (u32 i = 0; i < addedAssets.size(); i++)
+        {
+            // Files that are still being written fail here and are registered once their next modification is reported
+            if (isValid[i])
+                RegisterAsset(addedAssets[i]);
+        }
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    void AssetManager::UnloadAllAssets()
+    Ref<AssetLoadRequest> AssetManager::GetOrCreateLoadRequest(UUID uuid, bool& created)
     {
-        ms_LoadedAssets.clear();
+        std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+        auto it = ms_LoadRequests.find(uuid);
+        created = it == ms_LoadRequests.end();
+
+        if (!created)
+            return it->second;
+
+        Ref<AssetLoadRequest> request = CreateRef<AssetLoadRequest>();
+        request->AssetUUID = uuid;
+        request->Uploads = CreateRef<GPUUploadBatch>();
+        ms_LoadRequests[uuid] = request;
+
+        auto registryIt = ms_Registry.find(uuid);
+        if (registryIt != ms_Registry.end())
+            ms_CacheStats[(u32)registryIt->second.Type].Misses++;
+
+        return request;
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    void AssetManager::UnloadUnusedAssets()
+    bool AssetManager::ExecuteLoadRequest(const Ref<AssetLoadRequest>& request)
     {
-        Vector<Ref<Asset>> assetsToUnload;
-        assetsToUnload.reserve(ms_LoadedAssets.size());
+        AssetLoadStatus expectedStatus = AssetLoadStatus::Queued;
+        if (!request->Status.compare_exchange_strong(expectedStatus, AssetLoadStatus::Loading))
+            return false;
+
+        AssetMetaData metaData;
+        bool isRegistered;
 
-        for (auto& [uuid, asset] : ms_LoadedAssets)
         {
-            if (asset.use_count() == 1)
-                assetsToUnload.push_back(asset);
+            std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+
+            auto it = ms_Registry.find(request->AssetUUID);
+            isRegistered = it != ms_Registry.end();
+
+            if (isRegistered)
+                metaData = it->second;
         }
 
-        for (auto& asset : assetsToUnload)
+        Ref<Asset> asset = nullptr;
+
+        // Scenes reference most of the assets they need through their components. Those are queued on the loader threads before the
+        // scene is deserialized, so they load in parallel instead of one after another as the deserializer reaches them.
+        if (isRegistered && metaData.Type == AssetType::Scene)
+            request->Prefetches = PrefetchAssetDependencies(request->AssetUUID);
+
+        if (isRegistered)
         {
-            if (asset->GetAssetFlag(AssetFlags::Serialized))
-                UnloadAsset(asset->GetUUID());
-            else
-                UnregisterAsset(asset->GetUUID());
+            // Dependencies loaded by the deserializer on this thread record their uploads into their own requests
+            GPUUploadBatch* previousUploadBatch = Renderer::SetUploadBatch(request->Uploads.get());
+            asset = DeserializeAsset(metaData);
+            Renderer::SetUploadBatch(previousUploadBatch);
+
+            if (!asset)
+                ATOM_ERROR("Failed loading asset {}({}). Asset deserialization failed.", metaData.AssetFilepath, request->AssetUUID);
+        }
+
+        {
+            std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
+            std::lock_guard<std::mutex> requestLock(request->Mutex);
+
+            request->LoadedAsset = asset;
+            request->Status = AssetLoadStatus::PendingUpload;
+            ms_CompletedLoadRequests.push_back(request);
         }
+
+        request->LoadedCV.notify_all();
+        return true;
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    const HashMap<UUID, AssetMetaData>& AssetManager::GetRegistry()
+    void AssetManager::WaitForLoadRequest(const Ref<AssetLoadRequest>& request)
     {
-        return ms_Registry;
+        // Requests that did not start yet are executed on the calling thread. Since asset dependencies can't form cycles, waiting for
+        // requests that are already running can't deadlock.
+        if (ExecuteLoadRequest(request))
+            return;
+
+        std::unique_lock<std::mutex> lock(request->Mutex);
+        request->LoadedCV.wait(lock, [&request]() { return request->Status != AssetLoadStatus::Queued && request->Status != AssetLoadStatus::Loading; });
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    UUID AssetManager::GetUUIDForAssetPath(const std::filesystem::path& assetPath)
+    void AssetManager::FinalizeLoadRequest(const Ref<AssetLoadRequest>& request)
     {
-        auto it = ms_AssetPathUUIDs.find(GetAssetFullPath(assetPath));
+        if (request->Status != AssetLoadStatus::PendingUpload)
+            return;
 
-        if (it == ms_AssetPathUUIDs.end())
-            return 0;
+        Renderer::SubmitUploadBatches({ request->Uploads.get() });
 
-        return it->second;
-    }
+        {
+            std::lock_guard<std::recursive_mutex> lock(ms_Mutex);
 
-    // -----------------------------------------------------------------------------------------------------------------------------
-    std::filesystem::path AssetManager::GetAssetFullPath(const std::filesystem::path& assetPath)
-    {
-        return ms_AssetsFolder / assetPath;
+            auto it = ms_LoadRequests.find(request->AssetUUID);
+            bool isCurrentRequest = it != ms_LoadRequests.end() && it->second == request;
+
+            if (isCurrentRequest)
+                ms_LoadRequests.erase(it);
+
+            auto loadedIt = ms_LoadedAssets.find(request->AssetUUID);
+
+            // The asset might have been unregistered while it was loading
+            if (request->LoadedAsset && isCurrentRequest && IsAssetValid(request->AssetUUID) && request->IsReload && loadedIt != ms_LoadedAssets.end())
+            {
+                if (ReplaceAsset(loadedIt->second, request->LoadedAsset))
+                {
+                    ms_AssetDependencies.erase(request->AssetUUID);
+                    ATOM_INFO("Asset {}({}) reloaded", ms_Registry[request->AssetUUID].AssetFilepath, request->AssetUUID);
+                }
+
+                request->LoadedAsset = GetAssetReference(request->AssetUUID, loadedIt->second);
+            }
+            else if (request->LoadedAsset && isCurrentRequest && IsAssetValid(request->AssetUUID))
+            {
+                ms_LoadedAssets[request->AssetUUID] = request->LoadedAsset;
+                request->LoadedAsset = GetAssetReference(request->AssetUUID, request->LoadedAsset);
+                ATOM_INFO("Successfully loaded asset {}({})", ms_Registry[request->AssetUUID].AssetFilepath, request->AssetUUID);
+            }
+            else
+            {
+                request->LoadedAsset = nullptr;
+            }
+        }
+
+        Vector<std::function<void(const Ref<Asset>&)>> callbacks;
+
+        {
+            std::lock_guard<std::mutex> requestLock(request->Mutex);
+            request->Status = request->LoadedAsset ? AssetLoadStatus::Loaded : AssetLoadStatus::Failed;
+            callbacks.swap(request->Callbacks);
+        }
+
+        for (auto& callback : callbacks)
+            callback(request->LoadedAsset);
+
+        // Prefetched dependencies that were not referenced by the asset get unloaded again
+        request->Prefetches.clear();
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    const std::filesystem::path& AssetManager::GetAssetsFolder()
+    bool AssetManager::IsMainThread()
     {
-        return ms_AssetsFolder;
+        return std::this_thread::get_id() == ms_MainThreadID;
     }
 
+    // ------------------------------------------------------- AssetLoadHandle -----------------------------------------------------
     // -----------------------------------------------------------------------------------------------------------------------------
-    bool AssetManager::IsAssetFile(const std::filesystem::path& filepath)
+    bool AssetLoadHandle::Wait()
     {
-        for (u32 i = 0; i < (u32)AssetType::NumTypes; i++)
-            if (filepath.extension() == Asset::AssetFileExtensions[i])
-                return true;
+        if (!m_Request)
+            return false;
 
-        return false;
+        ATOM_ENGINE_ASSERT(AssetManager::IsMainThread());
+
+        AssetManager::WaitForLoadRequest(m_Request);
+        AssetManager::ProcessAsyncLoads();
+
+        return m_Request->Status == AssetLoadStatus::Loaded;
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    void AssetManager::RegisterAllAssets(const std::filesystem::path& assetFolder)
+    void AssetLoadHandle::OnLoaded(const std::function<void(const Ref<Asset>&)>& callback)
     {
-        ATOM_ENGINE_ASSERT(std::filesystem::exists(assetFolder));
+        if (!m_Request)
+            return;
 
-        for (auto entry : std::filesystem::directory_iterator(assetFolder))
         {
-            if (entry.is_directory())
-            {
-                RegisterAllAssets(entry);
-            }
-            else if(IsAssetFile(entry.path()))
+            std::lock_guard<std::mutex> lock(m_Request->Mutex);
+
+            if (m_Request->Status != AssetLoadStatus::Loaded && m_Request->Status != AssetLoadStatus::Failed)
             {
-                RegisterAsset(entry);
+                m_Request->Callbacks.push_back(callback);
+                return;
             }
         }
-    }
 
-    // -----------------------------------------------------------------------------------------------------------------------------
-    bool AssetManager::IsAssetValid(UUID uuid)
-    {
-        return ms_Registry.find(uuid) != ms_Registry.end();
+        if (AssetManager::IsMainThread())
+        {
+            callback(m_Request->LoadedAsset);
+        }
+        else
+        {
+            Ref<Asset> asset = m_Request->LoadedAsset;
+            Application::Get().SubmitForMainThreadExecution([=]()
+            {
+                callback(asset);
+            });
+        }
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    bool AssetManager::IsAssetLoaded(UUID uuid)
+    AssetLoadStatus AssetLoadHandle::GetStatus() const
     {
-        return ms_LoadedAssets.find(uuid) != ms_LoadedAssets.end();
+        return m_Request ? m_Request->Status.load() : AssetLoadStatus::Failed;
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    const AssetMetaData* AssetManager::GetAssetMetaData(UUID uuid)
+    bool AssetLoadHandle::IsReady() const
     {
-        auto it = ms_Registry.find(uuid);
-
-        if (it != ms_Registry.end())
-            return &it->second;
-
-        return nullptr;
+        AssetLoadStatus status = GetStatus();
+        return status == AssetLoadStatus::Loaded || status == AssetLoadStatus::Failed;
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    u32 AssetManager::GetAssetRefCount(UUID uuid)
+    UUID AssetLoadHandle::GetUUID() const
     {
-        if (!IsAssetValid(uuid) || !IsAssetLoaded(uuid))
-            return 0;
-
-        return ms_LoadedAssets.at(uuid).use_count() - 1;
+        return m_Request ? m_Request->AssetUUID : UUID(0);
     }
-}
+}
\ No newline at end of file
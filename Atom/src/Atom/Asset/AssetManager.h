@@ -2,36 +2,144 @@
 
 #include "Atom/Core/Core.h"
 #include "Atom/Core/UUID.h"
+#include "Atom/Core/ThreadPool.h"
+#include "Atom/Core/FileWatcher.h"
 #include "Atom/Asset/Asset.h"
 
-#include <FileWatch.h>
+#include <list>
+#include <optional>
 
 namespace Atom
 {
+    struct GPUUploadBatch;
+
+    enum class AssetLoadStatus : u8
+    {
+        Queued,
+        Loading,
+        PendingUpload, // Deserialized, waiting for the main thread to submit the GPU uploads
+        Loaded,
+        Failed
+    };
+
+    class AssetLoadHandle;
+
+    struct AssetLoadRequest
+    {
+        UUID                                           AssetUUID = 0;
+        std::atomic<AssetLoadStatus>                   Status = AssetLoadStatus::Queued;
+        Ref<Asset>                                     LoadedAsset = nullptr;
+        Ref<GPUUploadBatch>                            Uploads = nullptr;
+        Vector<std::function<void(const Ref<Asset>&)>> Callbacks;
+        Vector<AssetLoadHandle>                        Prefetches; // Dependencies loaded ahead of the asset, kept alive until it is finalized
+        bool                                           IsReload = false; // The deserialized asset replaces the contents of the loaded one
+        std::mutex                                     Mutex;
+        std::condition_variable                        LoadedCV;
+    };
+
+    class AssetLoadHandle
+    {
+    public:
+        AssetLoadHandle() = default;
+        AssetLoadHandle(const Ref<AssetLoadRequest>& request)
+            : m_Request(request) {}
+
+        // Blocks until the asset is loaded. Has to be called on the main thread. Returns false if loading failed.
+        bool Wait();
+
+        // The callback is always invoked on the main thread, with a null asset if loading failed
+        void OnLoaded(const std::function<void(const Ref<Asset>&)>& callback);
+
+        AssetLoadStatus GetStatus() const;
+        bool IsReady() const;
+        UUID GetUUID() const;
+
+        inline bool IsValid() const { return m_Request != nullptr; }
+
+        template<typename T>
+        Ref<T> GetAsset() const
+        {
+            return IsValid() && GetStatus() == AssetLoadStatus::Loaded ? std::dynamic_pointer_cast<T>(m_Request->LoadedAsset) : nullptr;
+        }
+    private:
+        Ref<AssetLoadRequest> m_Request = nullptr;
+    };
+
+    struct AssetRegistryStats
+    {
+        u32  AssetCount = 0;
+        u32  CachedAssetCount = 0; // Assets whose metadata was taken from the registry cache
+        u32  ReadAssetCount = 0;   // Assets whose metadata had to be read from their files
+        bool IsWarmStart = false;  // Whether a valid registry cache existed
+        f64  RegistrationTime = 0.0; // In milliseconds
+    };
+
+    struct AssetCacheStats
+    {
+        u64 Hits = 0;             // Unreferenced assets that were used again before they got evicted
+        u64 Misses = 0;           // Assets that had to be loaded from their files
+        u64 Evictions = 0;
+        u32 CachedAssetCount = 0; // Loaded assets that are not referenced
+        u64 CachedMemory = 0;
+        u64 Budget = 0;
+
+        f32 GetHitRatio() const { return Hits + Misses ? (f32)Hits / (Hits + Misses) : 0.0f; }
+    };
+
+    struct AssetLoadStats
+    {
+        u64 LoadCount = 0;
+        u64 LoadedMemory = 0;
+        f64 LoadTime = 0.0; // In milliseconds, including the dependencies the deserializer loads synchronously
+
+        f64 GetAverageLoadTime() const { return LoadCount ? LoadTime / LoadCount : 0.0; }
+    };
+
     class AssetManager
     {
     public:
         static void Initialize(const std::filesystem::path& assetFolder);
+        static bool Initialize(const std::filesystem::path& assetFolder, const Vector<std::filesystem::path>& assetPacks); // Registers the assets from the packs only, without scanning the assets folder
         static void Shutdown();
         static void RegisterAsset(const AssetMetaData& metaData);
-        static void RegisterAsset(const Ref<Asset>& asset);
+        static void RegisterAsset(const Ref<Asset>& asset); // Virtual assets are unregistered once nothing references them, so the caller has to use the asset through GetAsset
         static void RegisterAsset(const std::filesystem::path& assetPath);
         static void UnregisterAsset(UUID uuid);
         static void UnregisterAsset(const std::filesystem::path& assetPath);
         static bool LoadAsset(UUID uuid);
+        static AssetLoadHandle LoadAssetAsync(UUID uuid);
+        static void ProcessAsyncLoads();
+        static void WaitForAsyncLoads();
+        static u32 GetPendingLoadCount();
+        static Ref<Asset> GetPlaceholderAsset(AssetType type);
         static bool ReloadAsset(UUID uuid);
+        static AssetLoadHandle ReloadAssetAsync(UUID uuid); // Returns an invalid handle if the changes were applied in place right away, or if the asset is not in use and is read from the new file once it is loaded again
         static void UnloadAsset(UUID uuid);
         static void UnloadAllAssets();
-        static void UnloadUnusedAssets();
+        static void UnloadUnusedAssets(); // Unloads all assets that are not referenced, regardless of the cache budgets
+        static void UpdateAssetCache();   // Caches the assets whose last reference was released and evicts a few of them if a budget is exceeded
+        static Vector<UUID> GetAssetDependencies(UUID uuid, bool recursive = false); // The recursive query returns the transitive closure, nearest dependencies first
+        static Vector<AssetLoadHandle> PrefetchAssetDependencies(UUID uuid);
         static bool IsAssetValid(UUID uuid);
         static bool IsAssetLoaded(UUID uuid);
-        static const AssetMetaData* GetAssetMetaData(UUID uuid);
+        static std::optional<AssetMetaData> GetAssetMetaData(UUID uuid); // Returns a copy, since the registry can be modified by other threads once the lock is released
         static u32 GetAssetRefCount(UUID uuid);
-        static const HashMap<UUID, AssetMetaData>& GetRegistry();
+        static HashMap<UUID, AssetMetaData> GetRegistry();
         static UUID GetUUIDForAssetPath(const std::filesystem::path& assetPath);
+        static UUID FindAssetByContentHash(AssetType type, u64 contentHash); // Returns 0 if no registered asset of the type has the content
         static std::filesystem::path GetAssetFullPath(const std::filesystem::path& assetPath);
         static const std::filesystem::path& GetAssetsFolder();
         static bool IsAssetFile(const std::filesystem::path& filepath);
+        static const AssetRegistryStats& GetRegistryStats();
+        static AssetLoadStats GetLoadStats(AssetType type);
+        static void ResetLoadStats();
+
+        // Unreferenced assets stay loaded until the cached assets of their type exceed the budget, then the least recently used are evicted
+        static void SetCacheBudget(AssetType type, u64 budget);
+        static u64 GetCacheBudget(AssetType type);
+        static AssetCacheStats GetCacheStats(AssetType type);
+        static AssetCacheStats GetCacheStats(); // Totals of all types
+        static void ResetCacheStats();
 
         template<typename T>
         static Ref<T> GetAsset(UUID uuid, bool load = false)
@@ -39,20 +147,82 @@ namespace Atom
             if (load && !LoadAsset(uuid))
                 return nullptr;
 
-            if(!IsAssetLoaded(uuid))
-                return nullptr;
+            return std::dynamic_pointer_cast<T>(GetLoadedAsset(uuid));
+        }
+
+        template<typename T>
+        static Ref<T> GetAssetOrPlaceholder(const AssetLoadHandle& handle)
+        {
+            if (Ref<T> asset = handle.GetAsset<T>())
+                return asset;
 
-            return std::dynamic_pointer_cast<T>(ms_LoadedAssets[uuid]);
+            std::optional<AssetMetaData> metaData = handle.IsValid() ? GetAssetMetaData(handle.GetUUID()) : std::nullopt;
+            return metaData ? std::dynamic_pointer_cast<T>(GetPlaceholderAsset(metaData->Type)) : nullptr;
         }
 
     private:
         static void RegisterAllAssets(const std::filesystem::path& assetFolder);
+        static void InitializeLoaders();
+        static Ref<Asset> GetLoadedAsset(UUID uuid);
+        static Ref<Asset> GetAssetReference(UUID uuid, const Ref<Asset>& asset);
+        static void OnAssetReferenceReleased(UUID uuid);
+        static bool ProcessReleasedAssets(); // Returns false if no references were released
+        static void AddToCache(const Ref<Asset>& asset);
+        static bool RemoveFromCache(UUID uuid);
+        static void EvictFromCache();
+        static Ref<Asset> DeserializeAsset(const AssetMetaData& metaData);
+        static bool ReplaceAsset(const Ref<Asset>& asset, const Ref<Asset>& newAsset);
+        static bool ReloadChangedChunks(UUID uuid); // Reads only the changed chunks of the asset file into the loaded asset, if its type supports it
+        static void OnAssetFilesChanged(const Vector<FileChangeEvent>& changes);
+        static Ref<AssetLoadRequest> GetOrCreateLoadRequest(UUID uuid, bool& created);
+        static bool ExecuteLoadRequest(const Ref<AssetLoadRequest>& request);
+        static void WaitForLoadRequest(const Ref<AssetLoadRequest>& request);
+        static void FinalizeLoadRequest(const Ref<AssetLoadRequest>& request);
+        static bool IsMainThread();
+
+        friend class AssetLoadHandle;
     private:
+        static constexpr u32 LoaderThreadCount = 2;
+        static constexpr u32 MaxEvictionsPerFrame = 8;
+
+        struct AssetCacheEntry
+        {
+            UUID      AssetUUID;
+            AssetType Type;
+            u64       MemorySize;
+        };
+
+        inline static std::recursive_mutex                               ms_Mutex;
         inline static std::filesystem::path                              ms_AssetsFolder;
         inline static HashMap<UUID, AssetMetaData>                       ms_Registry;
         inline static HashMap<std::filesystem::path, UUID>               ms_AssetPathUUIDs;
+        inline static HashMap<u64, UUID>                                 ms_AssetContentHashes;
         inline static HashMap<UUID, Ref<Asset>>                          ms_LoadedAssets;
-        inline static HashMap<UUID, bool>                                ms_PendingReloads;
-        inline static Scope<filewatch::FileWatch<std::filesystem::path>> ms_FileWatcher;
+        inline static HashMap<UUID, std::weak_ptr<Asset>>                ms_AssetReferences; // The references handed out to the users of the loaded assets
+        inline static HashMap<UUID, Vector<UUID>>                        ms_AssetDependencies;
+        inline static std::mutex                                         ms_ReleasedAssetsMutex;
+        inline static Vector<UUID>                                       ms_ReleasedAssets;
+        inline static std::list<AssetCacheEntry>                         ms_CachedAssets[(u32)AssetType::NumTypes]; // Least recently released first
+        inline static HashMap<UUID, std::list<AssetCacheEntry>::iterator> ms_CachedAssetEntries;
+        inline static AssetCacheStats                                    ms_CacheStats[(u32)AssetType::NumTypes];
+        inline static u64                                                ms_CacheBudgets[(u32)AssetType::NumTypes] =
+        {
+            256ull * 1024 * 1024, // Texture2D
+            128ull * 1024 * 1024, // TextureCube
+            256ull * 1024 * 1024, // Mesh
+            4ull * 1024 * 1024,   // Material
+            0,                    // Scene
+            64ull * 1024 * 1024,  // Animation
+            8ull * 1024 * 1024,   // Skeleton
+            4ull * 1024 * 1024,   // AnimationController
+        };
+        inline static HashMap<UUID, Ref<AssetLoadRequest>>               ms_LoadRequests;
+        inline static Vector<Ref<AssetLoadRequest>>                      ms_CompletedLoadRequests;
+        inline static Ref<Asset>                                         ms_PlaceholderAssets[(u32)AssetType::NumTypes];
+        inline static Scope<ThreadPool>                                  ms_LoaderThreadPool;
+        inline static AssetLoadStats                                     ms_LoadStats[(u32)AssetType::NumTypes];
+        inline static std::thread::id                                    ms_MainThreadID = std::this_thread::get_id();
+        inline static Scope<FileWatcher>                                 ms_FileWatcher;
+        inline static AssetRegistryStats                                 ms_RegistryStats;
     };
 }
\ No newline at end of file
@@ -0,0 +1,306 @@
+#include "atompch.h"
+#include "AssetPack.h"
+
+#include "Atom/Asset/AssetFile.h"
+#include "Atom/Asset/AssetSerializer.h"
+
+namespace Atom
+{
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetPack::Mount(const Ref<AssetPackReader>& pack, const std::filesystem::path& assetFolder)
+    {
+        ATOM_ENGINE_ASSERT(pack && pack->IsValid());
+
+        std::lock_guard<std::mutex> lock(ms_MountMutex);
+        ms_MountPoints.push_back({ assetFolder.lexically_normal(), pack });
+
+        ATOM_INFO("Mounted asset pack {} with {} assets", pack->GetFilepath(), pack->GetEntries().size());
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetPack::UnmountAll()
+    {
+        std::lock_guard<std::mutex> lock(ms_MountMutex);
+        ms_MountPoints.clear();
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    Ref<AssetPackReader> AssetPack::FindMountedAsset(const std::filesystem::path& assetFilepath, const AssetPackEntry*& entry)
+    {
+        std::lock_guard<std::mutex> lock(ms_MountMutex);
+
+        entry = nullptr;
+
+        if (ms_MountPoints.empty())
+            return nullptr;
+
+        std::filesystem::path normalizedPath = assetFilepath.lexically_normal();
+
+        for (auto it = ms_MountPoints.rbegin(); it != ms_MountPoints.rend(); it++)
+        {
+            std::filesystem::path relativePath = normalizedPath.lexically_relative(it->AssetFolder);
+
+            if (relativePath.empty() || *relativePath.begin() == "..")
+                continue;
+
+            entry = it->Pack->FindAsset(relativePath.generic_string());
+
+            if (entry)
+                return it->Pack;
+        }
+
+        return nullptr;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    AssetPackReader::AssetPackReader(const std::filesystem::path& filepath, bool memoryMapped)
+        : m_Filepath(filepath)
+    {
+        if (memoryMapped)
+        {
+            m_File = CreateScope<MappedFile>(filepath);
+
+            if (!m_File->IsValid())
+            {
+                ATOM_ERROR("Failed opening asset pack {}", filepath);
+                m_File.reset();
+                return;
+            }
+
+            m_Size = m_File->GetSize();
+        }
+        else
+        {
+            m_Stream.open(filepath, std::ios::in | std::ios::binary | std::ios::ate);
+
+            if (!m_Stream)
+            {
+                ATOM_ERROR("Failed opening asset pack {}", filepath);
+                return;
+            }
+
+            m_Size = (u64)m_Stream.tellg();
+        }
+
+        AssetPack::Header header;
+        if (!Read(0, sizeof(AssetPack::Header), &header))
+        {
+            ATOM_ERROR("Asset pack {} is corrupted", filepath);
+            return;
+        }
+
+        if (header.Magic != AssetPack::Magic || header.Version != AssetPack::Version)
+        {
+            ATOM_ERROR("Asset pack {} has an unsupported format version. Rebuild the pack", filepath);
+            return;
+        }
+
+        // The index and the path table are read together, so a single hash covers both. Their size is checked against the pack
+        // before allocating, the counts can't overflow 64 bits but the offset can be anything.
+        u64 entriesSize = (u64)header.EntryCount * sizeof(AssetPackEntry);
+        u64 indexSize = entriesSize + header.PathTableSize;
+
+        if (header.IndexOffset > m_Size || indexSize > m_Size - header.IndexOffset)
+        {
+            ATOM_ERROR("Asset pack {} is corrupted", filepath);
+            return;
+        }
+
+        Vector<byte> index(indexSize);
+
+        if (!Read(header.IndexOffset, index.size(), index.data()) || AssetFile::ComputeHash(index.data(), index.size()) != header.IndexHash)
+        {
+            ATOM_ERROR("Asset pack {} is corrupted", filepath);
+            return;
+        }
+
+        m_Entries.resize(header.EntryCount);
+        memcpy(m_Entries.data(), index.data(), entriesSize);
+        m_PathTable.assign((const char*)index.data() + entriesSize, header.PathTableSize);
+        m_PathEntries.reserve(m_Entries.size());
+
+        for (u32 i = 0; i < m_Entries.size(); i++)
+        {
+            const AssetPackEntry& entry = m_Entries[i];
+
+            bool isSorted = i == 0 || (u64)m_Entries[i - 1].UUID < (u64)entry.UUID;
+            bool isInRange = entry.Offset <= m_Size && entry.Size <= m_Size - entry.Offset && (u64)entry.PathOffset + entry.PathSize <= m_PathTable.size();
+
+            if (!isSorted || !isInRange)
+            {
+                ATOM_ERROR("Asset pack {} is corrupted", filepath);
+                m_Entries.clear();
+                m_PathEntries.clear();
+                return;
+            }
+
+            m_PathEntries[GetAssetPath(entry)] = i;
+        }
+
+        m_IsValid = true;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    const AssetPackEntry* AssetPackReader::FindAsset(UUID uuid) const
+    {
+        auto it = std::lower_bound(m_Entries.begin(), m_Entries.end(), (u64)uuid, [](const AssetPackEntry& entry, u64 uuid)
+        {
+            return (u64)entry.UUID < uuid;
+        });
+
+        return it != m_Entries.end() && it->UUID == uuid ? &(*it) : nullptr;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    const AssetPackEntry* AssetPackReader::FindAsset(const String& assetPath) const
+    {
+        auto it = m_PathEntries.find(assetPath);
+        return it != m_PathEntries.end() ? &m_Entries[it->second] : nullptr;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    String AssetPackReader::GetAssetPath(const AssetPackEntry& entry) const
+    {
+        return m_PathTable.substr(entry.PathOffset, entry.PathSize);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    const byte* AssetPackReader::ReadAsset(const AssetPackEntry& entry, Vector<byte>& buffer) const
+    {
+        if (m_File)
+            return m_File->GetData() + entry.Offset;
+
+        buffer.resize(entry.Size);
+
+        if (!Read(entry.Offset, entry.Size, buffer.data()))
+        {
+            ATOM_ERROR("Failed reading asset {} from asset pack {}", GetAssetPath(entry), m_Filepath);
+            buffer.clear();
+            return nullptr;
+        }
+
+        return buffer.data();
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool AssetPackReader::Read(u64 offset, u64 size, void* destination) const
+    {
+        if (offset > m_Size || size > m_Size - offset)
+            return false;
+
+        if (m_File)
+        {
+            memcpy(destination, m_File->GetData() + offset, size);
+            return true;
+        }
+
+        std::lock_guard<std::mutex> lock(m_StreamMutex);
+        m_Stream.clear();
+        m_Stream.seekg(offset);
+        m_Stream.read((char*)destination, size);
+        return m_Stream.good();
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool AssetPackBuilder::AddAsset(const std::filesystem::path& assetFilepath, const std::filesystem::path& assetPath)
+    {
+        PackedAsset asset;
+        asset.AssetPath = assetPath.lexically_normal().generic_string();
+
+        if (!AssetSerializer::DeserializeMetaData(assetFilepath, asset.MetaData))
+        {
+            ATOM_ERROR("Failed adding asset {} to the pack. Reading asset meta data failed.", assetFilepath);
+            return false;
+        }
+
+        m_Assets.push_back(asset);
+        return true;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool AssetPackBuilder::Build(const std::filesystem::path& packFilepath)
+    {
+        static const byte s_Padding[AssetPack::EntryAlignment] = {};
+
+        std::sort(m_Assets.begin(), m_Assets.end(), [](const PackedAsset& a, const PackedAsset& b)
+        {
+            return (u64)a.MetaData.UUID < (u64)b.MetaData.UUID;
+        });
+
+        for (u32 i = 1; i < m_Assets.size(); i++)
+        {
+            if (m_Assets[i].MetaData.UUID == m_Assets[i - 1].MetaData.UUID)
+            {
+                ATOM_ERROR("Failed building asset pack {}. Assets {} and {} have the same UUID", packFilepath, m_Assets[i - 1].AssetPath, m_Assets[i].AssetPath);
+                return false;
+            }
+        }
+
+        std::ofstream stream(packFilepath, std::ios::out | std::ios::binary);
+
+        if (!stream)
+        {
+            ATOM_ERROR("Failed building asset pack {}. The file could not be created", packFilepath);
+            return false;
+        }
+
+        // The header is written again once the index is known
+        AssetPack::Header header;
+        stream.write((const char*)&header, sizeof(AssetPack::Header));
+
+        Vector<AssetPackEntry> entries;
+        entries.reserve(m_Assets.size());
+        String pathTable;
+
+        for (const PackedAsset& asset : m_Assets)
+        {
+            // Asset files are copied as they are, the offsets of their chunks are relative to the start of the entry
+            MappedFile file(asset.MetaData.AssetFilepath);
+
+            if (!file.IsValid())
+            {
+                ATOM_ERROR("Failed building asset pack {}. Asset file {} could not be read", packFilepath, asset.MetaData.AssetFilepath);
+                return false;
+            }
+
+            u64 offset = (u64)stream.tellp();
+            u64 alignedOffset = (offset + AssetPack::EntryAlignment - 1) & ~(AssetPack::EntryAlignment - 1);
+            stream.write((const char*)s_Padding, alignedOffset - offset);
+            stream.write((const char*)file.GetData(), file.GetSize());
+
+            AssetPackEntry& entry = entries.emplace_back();
+            entry.UUID = asset.MetaData.UUID;
+            entry.Type = asset.MetaData.Type;
+            entry.Flags = asset.MetaData.Flags;
+            entry.Offset = alignedOffset;
+            entry.Size = file.GetSize();
+            entry.PathOffset = pathTable.size();
+            entry.PathSize = asset.AssetPath.size();
+
+            pathTable += asset.AssetPath;
+        }
+
+        Vector<byte> index(entries.size() * sizeof(AssetPackEntry) + pathTable.size());
+        memcpy(index.data(), entries.data(), entries.size() * sizeof(AssetPackEntry));
+        memcpy(index.data() + entries.size() * sizeof(AssetPackEntry), pathTable.data(), pathTable.size());
+
+        header.EntryCount = entries.size();
+        header.PathTableSize = pathTable.size();
+        header.IndexOffset = (u64)stream.tellp();
+        header.IndexHash = AssetFile::ComputeHash(index.data(), index.size());
+
+        stream.write((const char*)index.data(), index.size());
+        stream.seekp(0);
+        stream.write((const char*)&header, sizeof(AssetPack::Header));
+        stream.flush();
+
+        if (!stream.good())
+        {
+            ATOM_ERROR("Failed building asset pack {}. Writing the file failed", packFilepath);
+            return false;
+        }
+
+        ATOM_INFO("Built asset pack {} with {} assets", packFilepath, entries.size());
+        return true;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "Atom/Core/Core.h"
+#include "Atom/Core/UUID.h"
+#include "Atom/Core/MappedFile.h"
+#include "Atom/Asset/Asset.h"
+
+namespace Atom
+{
+    // A pack file bundles the asset files of a project into a single archive, so that shipped builds open one file instead of walking
+    // the assets folder. The asset files are stored unmodified at offsets aligned to AssetPack::EntryAlignment, followed by an index
+    // sorted by UUID and a table with the paths of the assets relative to the assets folder.
+    struct AssetPackEntry
+    {
+        UUID       UUID;
+        AssetType  Type;
+        AssetFlags Flags;
+        u64        Offset;
+        u64        Size;
+        u32        PathOffset; // Offset into the path table
+        u32        PathSize;
+    };
+
+    class AssetPackReader;
+
+    class AssetPack
+    {
+    public:
+        static constexpr u32 Magic = 0x4B415041; // "APAK"
+        static constexpr u32 Version = 1;
+        static constexpr u64 EntryAlignment = 4096; // Page aligned, so the chunks of mapped entries keep their alignment in memory
+        inline static const char* FileExtension = ".atmpak";
+
+        struct Header
+        {
+            u32 Magic = AssetPack::Magic;
+            u32 Version = AssetPack::Version;
+            u32 EntryCount = 0;
+            u32 PathTableSize = 0;
+            u64 IndexOffset = 0;
+            u64 IndexHash = 0;    // Hash of the index and the path table that follows it
+        };
+
+        // Asset files are looked up in the mounted packs before the file system. The paths of the packed assets are relative to the
+        // given assets folder and packs mounted later take precedence, so they can be used to patch the assets of earlier ones.
+        static void Mount(const Ref<AssetPackReader>& pack, const std::filesystem::path& assetFolder);
+        static void UnmountAll();
+        static Ref<AssetPackReader> FindMountedAsset(const std::filesystem::path& assetFilepath, const AssetPackEntry*& entry);
+    private:
+        struct MountPoint
+        {
+            std::filesystem::path AssetFolder;
+            Ref<AssetPackReader>  Pack;
+        };
+
+        inline static std::mutex         ms_MountMutex;
+        inline static Vector<MountPoint> ms_MountPoints;
+    };
+
+    // Reads the index of a pack file. Entries are served directly from a mapping of the whole pack if it is memory mapped, otherwise they
+    // are read into buffers on demand. The reader can be used from multiple threads.
+    class AssetPackReader
+    {
+    public:
+        AssetPackReader(const std::filesystem::path& filepath, bool memoryMapped = true);
+
+        const AssetPackEntry* FindAsset(UUID uuid) const;
+        const AssetPackEntry* FindAsset(const String& assetPath) const;
+        String GetAssetPath(const AssetPackEntry& entry) const;
+
+        // Returns the contents of the asset file. The data either points into the mapping or into the given buffer.
+        const byte* ReadAsset(const AssetPackEntry& entry, Vector<byte>& buffer) const;
+
+        inline bool IsValid() const { return m_IsValid; }
+        inline bool IsMemoryMapped() const { return m_File != nullptr; }
+        inline const Vector<AssetPackEntry>& GetEntries() const { return m_Entries; }
+        inline const std::filesystem::path& GetFilepath() const { return m_Filepath; }
+    private:
+        bool Read(u64 offset, u64 size, void* destination) const;
+    private:
+        std::filesystem::path  m_Filepath;
+        u64                    m_Size = 0;
+        Scope<MappedFile>      m_File;
+        mutable std::ifstream  m_Stream;
+        mutable std::mutex     m_StreamMutex;
+        Vector<AssetPackEntry> m_Entries;
+        String                 m_PathTable;
+        HashMap<String, u32>   m_PathEntries; // Index of the entry for each asset path
+        bool                   m_IsValid = false;
+    };
+
+    // Collects asset files and writes them into a pack file
+    class AssetPackBuilder
+    {
+    public:
+        // The asset path is the path that is used to find the asset in the pack, relative to the assets folder it gets mounted to
+        bool AddAsset(const std::filesystem::path& assetFilepath, const std::filesystem::path& assetPath);
+        bool Build(const std::filesystem::path& packFilepath);
+
+        inline u32 GetAssetCount() const { return m_Assets.size(); }
+    private:
+        struct PackedAsset
+        {
+            AssetMetaData MetaData;
+            String        AssetPath;
+        };
+
+        Vector<PackedAsset> m_Assets;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+#include "atompch.h"
+#include "AssetRegistryCache.h"
+
+#include "Atom/Asset/AssetFile.h"
+
+namespace Atom
+{
+    namespace Utils
+    {
+        struct RegistryCacheFileEntry
+        {
+            u64        UUID;
+            AssetType  Type;
+            AssetFlags Flags;
+            u64        ContentHash;
+            u64        FileSize;
+            s64        WriteTime;
+            u32        AssetPathOffset; // Offsets into the path table
+            u32        AssetPathSize;
+            u32        SourcePathOffset;
+            u32        SourcePathSize;
+        };
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool AssetRegistryCache::Load(const std::filesystem::path& filepath, const std::filesystem::path& assetFolder, HashMap<String, AssetRegistryCacheEntry>& entries)
+    {
+        std::ifstream stream(filepath, std::ios::in | std::ios::binary);
+
+        if (!stream)
+            return false;
+
+        Header header;
+        if (!stream.read((char*)&header, sizeof(Header)) || header.Magic != Magic || header.Version != Version)
+        {
+            ATOM_WARNING("Asset registry cache {} is outdated and will be rebuilt", filepath);
+            return false;
+        }
+
+        u64 entriesSize = (u64)header.EntryCount * sizeof(Utils::RegistryCacheFileEntry);
+        Vector<byte> data(entriesSize + header.PathTableSize);
+
+        if (!stream.read((char*)data.data(), data.size()) || AssetFile::ComputeHash(data.data(), data.size()) != header.Hash)
+        {
+            ATOM_WARNING("Asset registry cache {} is corrupted and will be rebuilt", filepath);
+            return false;
+        }
+
+        const char* pathTable = (const char*)data.data() + entriesSize;
+        entries.reserve(header.EntryCount);
+
+        for (u32 i = 0; i < header.EntryCount; i++)
+        {
+            Utils::RegistryCacheFileEntry fileEntry;
+            memcpy(&fileEntry, data.data() + i * sizeof(Utils::RegistryCacheFileEntry), sizeof(Utils::RegistryCacheFileEntry));
+
+            if ((u64)fileEntry.AssetPathOffset + fileEntry.AssetPathSize > header.PathTableSize || (u64)fileEntry.SourcePathOffset + fileEntry.SourcePathSize > header.PathTableSize)
+            {
+                ATOM_WARNING("Asset registry cache {} is corrupted and will be rebuilt", filepath);
+                entries.clear();
+                return false;
+            }
+
+            String assetPath(pathTable + fileEntry.AssetPathOffset, fileEntry.AssetPathSize);
+
+            AssetRegistryCacheEntry& entry = entries[assetPath];
+            entry.MetaData.UUID = fileEntry.UUID;
+            entry.MetaData.Type = fileEntry.Type;
+            entry.MetaData.Flags = fileEntry.Flags;
+            entry.MetaData.ContentHash = fileEntry.ContentHash;
+            entry.MetaData.SourceFilepath = std::filesystem::u8path(String(pathTable + fileEntry.SourcePathOffset, fileEntry.SourcePathSize));
+            entry.MetaData.AssetFilepath = (assetFolder / std::filesystem::u8path(assetPath)).make_preferred();
+            entry.FileSize = fileEntry.FileSize;
+            entry.WriteTime = fileEntry.WriteTime;
+        }
+
+        return true;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool AssetRegistryCache::Save(const std::filesystem::path& filepath, const std::filesystem::path& assetFolder, const Vector<AssetRegistryCacheEntry>& entries)
+    {
+        Vector<Utils::RegistryCacheFileEntry> fileEntries;
+        fileEntries.reserve(entries.size());
+        String pathTable;
+
+        for (const AssetRegistryCacheEntry& entry : entries)
+        {
+            String assetPath = GetCacheKey(entry.MetaData.AssetFilepath, assetFolder);
+            String sourcePath = entry.MetaData.SourceFilepath.u8string();
+
+            Utils::RegistryCacheFileEntry& fileEntry = fileEntries.emplace_back();
+            fileEntry.UUID = entry.MetaData.UUID;
+            fileEntry.Type = entry.MetaData.Type;
+            fileEntry.Flags = entry.MetaData.Flags;
+            fileEntry.ContentHash = entry.MetaData.ContentHash;
+            fileEntry.FileSize = entry.FileSize;
+            fileEntry.WriteTime = entry.WriteTime;
+            fileEntry.AssetPathOffset = pathTable.size();
+            fileEntry.AssetPathSize = assetPath.size();
+            pathTable += assetPath;
+            fileEntry.SourcePathOffset = pathTable.size();
+            fileEntry.SourcePathSize = sourcePath.size();
+            pathTable += sourcePath;
+        }
+
+        u64 entriesSize = fileEntries.size() * sizeof(Utils::RegistryCacheFileEntry);
+        Vector<byte> data(entriesSize + pathTable.size());
+        memcpy(data.data(), fileEntries.data(), entriesSize);
+        memcpy(data.data() + entriesSize, pathTable.data(), pathTable.size());
+
+        Header header;
+        header.EntryCount = fileEntries.size();
+        header.PathTableSize = pathTable.size();
+        header.Hash = AssetFile::ComputeHash(data.data(), data.size());
+
+        std::ofstream stream(filepath, std::ios::out | std::ios::binary);
+        stream.write((const char*)&header, sizeof(Header));
+        stream.write((const char*)data.data(), data.size());
+
+        if (!stream.good())
+        {
+            ATOM_WARNING("Failed writing asset registry cache {}", filepath);
+            return false;
+        }
+
+        return true;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    String AssetRegistryCache::GetCacheKey(const std::filesystem::path& assetFilepath, const std::filesystem::path& assetFolder)
+    {
+        return assetFilepath.lexically_relative(assetFolder).generic_u8string();
+    }
+}
\ No newline at end of file
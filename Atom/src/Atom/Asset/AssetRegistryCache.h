@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Atom/Core/Core.h"
+#include "Atom/Asset/Asset.h"
+
+namespace Atom
+{
+    struct AssetRegistryCacheEntry
+    {
+        AssetMetaData MetaData;
+        u64           FileSize = 0;
+        s64           WriteTime = 0; // Last write time of the asset file in ticks of the file clock
+    };
+
+    // Persists the asset registry between runs, so that only the asset files that were added or changed since the last run have to be
+    // opened at startup. Files are matched by their path relative to the assets folder, their size and their last write time.
+    class AssetRegistryCache
+    {
+    public:
+        static constexpr u32 Magic = 0x47455241; // "AREG"
+        static constexpr u32 Version = 2;
+
+        struct Header
+        {
+            u32 Magic = AssetRegistryCache::Magic;
+            u32 Version = AssetRegistryCache::Version;
+            u32 EntryCount = 0;
+            u32 PathTableSize = 0;
+            u64 Hash = 0;       // Hash of the entries and the path table that follows them
+        };
+
+        // Entries are keyed by the generic form of their path relative to the assets folder
+        static bool Load(const std::filesystem::path& filepath, const std::filesystem::path& assetFolder, HashMap<String, AssetRegistryCacheEntry>& entries);
+        static bool Save(const std::filesystem::path& filepath, const std::filesystem::path& assetFolder, const Vector<AssetRegistryCacheEntry>& entries);
+        static String GetCacheKey(const std::filesystem::path& assetFilepath, const std::filesystem::path& assetFolder);
+    };
+}
\ No newline at end of file
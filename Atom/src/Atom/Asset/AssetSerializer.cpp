@@ -5,8 +5,10 @@
 #include "Atom/Asset/MaterialAsset.h"
 #include "Atom/Asset/AnimationControllerAsset.h"
 #include "Atom/Asset/MeshAsset.h"
+#include "Atom/Asset/AssetFile.h"
 
 #include "Atom/Renderer/Renderer.h"
+#include "Atom/Renderer/TextureStreamer.h"
 #include "Atom/Renderer/ShaderLibrary.h"
 #include "Atom/Renderer/Buffer.h"
 #include "Atom/Scene/Scene.h"
@@ -15,80 +17,279 @@
 
 namespace Atom
 {
-    // -----------------------------------------------------------------------------------------------------------------------------
-    template<>
-    static bool AssetSerializer::Serialize(const std::filesystem::path& filepath, Ref<Texture2D> asset)
+    namespace Utils
     {
-        std::ofstream ofs(filepath, std::ios::out | std::ios::binary);
+        // Version of the chunk layout of every asset type, stored in the metadata chunk right after the type. Bump the version of a type whenever
+        // the layout of its chunks changes, files with another version are rejected and have to be reimported.
+        static constexpr u32 AssetDataVersions[(u32)AssetType::NumTypes] =
+        {
+            1, // Texture2D
+            1, // TextureCube
+            2, // Mesh, 2: dependencies chunk
+            2, // Material, 2: dependencies chunk
+            3, // Scene, 2: dependencies chunk, 3: component pools
+            1, // Animation
+            1, // Skeleton
+            2, // AnimationController, 2: dependencies chunk
+        };
+
+        struct TextureFileHeader
+        {
+            u32 Format = 0;
+            u32 Width = 0;
+            u32 Height = 0;
+            u32 MipLevels = 0;
+            u32 Filter = 0;
+            u32 Wrap = 0;
+            u32 IsCpuReadable = 0;
+            u32 IsGpuWritable = 0;
+        };
+
+        struct MeshFileHeader
+        {
+            u32 VertexCount = 0;
+            u32 VertexStride = 0;
+            u32 IndexCount = 0;
+            u32 SubmeshCount = 0;
+            u32 IsReadable = 0;
+            u32 IsAnimated = 0;
+        };
+
+        static bool DeserializeTextureSubresources(const AssetFileReader& file, u32 firstSubresource, u32 subresourceCount, Vector<PixelDataView>& pixelData)
+        {
+            // Pixels are uploaded straight from the mapped file, or from the reader's buffers if they are compressed
+            pixelData.resize(subresourceCount);
 
-        if (!ofs)
-            return false;
+            for (u32 subresource = firstSubresource; subresource < firstSubresource + subresourceCount; subresource++)
+            {
+                AssetChunkReader chunk = file.GetChunk(AssetChunkType::Subresource, subresource);
 
-        std::filesystem::path absolutePath = std::filesystem::canonical(filepath);
+                if (!chunk.IsValid())
+                {
+                    ATOM_ERROR("Texture file {} is missing subresource {}", file.GetFilepath(), subresource);
+                    return false;
+                }
 
-        if (asset->GetAssetFlag(AssetFlags::Serialized) && asset->m_MetaData.AssetFilepath != absolutePath)
+                pixelData[subresource - firstSubresource] = { chunk.GetData(), (u32)chunk.GetSize() };
+            }
+
+            return true;
+        }
+
+        // Scenes store every component type in its own ComponentPool chunk, the chunk index identifies the component type.
+        // A pool holds the component count, the index of each component's entity in the SceneEntities chunk and the component data.
+        enum class SceneComponentPool : u32
         {
-            // If the asset was already serialized but the path is different than the one passed as a paraeter, create a copy of the asset with a new ID
-            AssetMetaData newMetaData = asset->m_MetaData;
-            newMetaData.UUID = UUID();
-            newMetaData.AssetFilepath = absolutePath;
-            SerializeMetaData(ofs, newMetaData);
+            Tag, SceneHierarchy, Transform, Camera, Mesh, AnimatedMesh, Animator, SkyLight,
+            DirectionalLight, PointLight, SpotLight, Script, Rigidbody, BoxCollider, SphereCollider, CapsuleCollider
+        };
+
+        // Opens the chunk of a component pool and writes its entity column. Returns the entities of the pool in the order their data has to be written.
+        template<typename Component>
+        static Vector<entt::entity> BeginComponentPool(AssetFileWriter& writer, SceneComponentPool pool, const entt::registry& registry, const Vector<u32>& entityIndices)
+        {
+            Vector<entt::entity> entities;
+            Vector<u32> indices;
+
+            auto view = registry.view<Component>();
+            entities.reserve(view.size());
+            indices.reserve(view.size());
+
+            for (entt::entity entity : view)
+            {
+                u32 index = entityIndices[entt::to_entity(entity)];
+
+                if (index == UINT32_MAX)
+                    continue;
+
+                entities.push_back(entity);
+                indices.push_back(index);
+            }
+
+            if (entities.empty())
+                return entities;
+
+            u32 count = entities.size();
+            writer.BeginChunk(AssetChunkType::ComponentPool, (u32)pool);
+            writer.Write(count);
+            writer.Write(indices.data(), sizeof(u32) * count);
+
+            return entities;
         }
-        else
+
+        // Writes a pool of trivially copyable components as a single array
+        template<typename Component>
+        static void SerializeRawComponentPool(AssetFileWriter& writer, SceneComponentPool pool, const entt::registry& registry, const Vector<u32>& entityIndices)
         {
-            asset->m_MetaData.AssetFilepath = absolutePath;
-            asset->SetAssetFlag(AssetFlags::Serialized);
-            SerializeMetaData(ofs, asset->m_MetaData);
+            static_assert(std::is_trivially_copyable_v<Component>, "Only trivially copyable components can be written as raw data");
+
+            Vector<entt::entity> entities = BeginComponentPool<Component>(writer, pool, registry, entityIndices);
+
+            if (entities.empty())
+                return;
+
+            Vector<Component> components;
+            components.reserve(entities.size());
+
+            for (entt::entity entity : entities)
+                components.push_back(registry.get<Component>(entity));
+
+            writer.Write(components.data(), sizeof(Component) * components.size());
+            writer.EndChunk();
         }
 
-        const TextureDescription& desc = asset->m_TextureResource->GetDescription();
-        TextureFilter filter = asset->GetFilter();
-        TextureWrap wrap = asset->GetWrap();
-        bool isGpuWritable = asset->IsGpuWritable();
+        // Cameras are polymorphic, so the pool stores their projection settings instead of the component itself
+        struct SerializedCamera
+        {
+            s32 ProjectionType;
+            f32 PerspectiveFOV;
+            f32 PerspectiveNear;
+            f32 PerspectiveFar;
+            f32 OrthographicSize;
+            f32 OrthographicNear;
+            f32 OrthographicFar;
+            u8  Primary;
+            u8  FixedAspectRatio;
+            u16 Padding = 0;
+        };
+
+        // Maps the entity column of a component pool to the scene entities. Pools that are missing from the file are empty.
+        static bool ReadComponentPool(const AssetFileReader& file, SceneComponentPool pool, const Vector<entt::entity>& sceneEntities, AssetChunkReader& stream, Vector<entt::entity>& entities)
+        {
+            entities.clear();
+
+            if (!file.FindChunk(AssetChunkType::ComponentPool, (u32)pool))
+                return true;
+
+            stream = file.GetChunk(AssetChunkType::ComponentPool, (u32)pool);
+
+            u32 count = 0;
+            if (!stream.Read(count) || count > stream.GetRemainingSize() / sizeof(u32))
+            {
+                ATOM_ERROR("Scene file {} has a corrupted component pool {}", file.GetFilepath(), (u32)pool);
+                return false;
+            }
+
+            const u32* indices = (const u32*)stream.ReadView(sizeof(u32) * count);
+            entities.resize(count);
+
+            for (u32 i = 0; i < count; i++)
+            {
+                if (indices[i] >= sceneEntities.size())
+                {
+                    ATOM_ERROR("Scene file {} has a corrupted component pool {}", file.GetFilepath(), (u32)pool);
+                    return false;
+                }
+
+                entities[i] = sceneEntities[indices[i]];
+            }
 
-        ofs.write((char*)&desc.Format, sizeof(TextureFormat));
-        ofs.write((char*)&desc.Width, sizeof(u32));
-        ofs.write((char*)&desc.Height, sizeof(u32));
-        ofs.write((char*)&desc.MipLevels, sizeof(u32));
-        ofs.write((char*)&filter, sizeof(TextureFilter));
-        ofs.write((char*)&wrap, sizeof(TextureWrap));
-        ofs.write((char*)&asset->m_CpuReadable, sizeof(bool));
-        ofs.write((char*)&isGpuWritable, sizeof(bool));
+            return true;
+        }
 
-        if (asset->m_CpuReadable)
+        // Reads a pool of trivially copyable components and inserts it into the registry at once
+        template<typename Component>
+        static bool DeserializeRawComponentPool(const AssetFileReader& file, SceneComponentPool pool, entt::registry& registry, const Vector<entt::entity>& sceneEntities)
         {
-            for (u32 mip = 0; mip < asset->GetMipLevels(); mip++)
+            static_assert(std::is_trivially_copyable_v<Component>, "Only trivially copyable components can be read as raw data");
+
+            AssetChunkReader stream;
+            Vector<entt::entity> entities;
+
+            if (!ReadComponentPool(file, pool, sceneEntities, stream, entities))
+                return false;
+
+            if (entities.empty())
+                return true;
+
+            Vector<Component> components(entities.size());
+
+            if (!stream.Read(components.data(), sizeof(Component) * components.size()))
             {
-                u32 pixelDataSize = asset->m_PixelData[mip].size();
-                ofs.write((char*)&pixelDataSize, sizeof(u32));
-                ofs.write((char*)asset->m_PixelData[mip].data(), pixelDataSize);
+                ATOM_ERROR("Scene file {} has a corrupted component pool {}", file.GetFilepath(), (u32)pool);
+                return false;
             }
+
+            registry.insert<Component>(entities.begin(), entities.end(), components.begin());
+            return true;
         }
-        else
+
+        static bool ReadString(AssetChunkReader& stream, String& string)
         {
-            for (u32 mip = 0; mip < asset->GetMipLevels(); mip++)
+            u32 size = 0;
+            if (!stream.Read(size))
+                return false;
+
+            const byte* data = stream.ReadView(size);
+
+            if (!data)
+                return false;
+
+            string.assign((const char*)data, size);
+            return true;
+        }
+
+        // Streams in the assets referenced by a component pool. Every asset is requested once and handed to all entities referencing it
+        // that still exist once it is loaded.
+        static void LoadSceneAssetsAsync(const Ref<Scene>& scene, const Vector<UUID>& entityUUIDs, const Vector<UUID>& assetUUIDs, const std::function<void(Entity, const Ref<Asset>&)>& onLoaded)
+        {
+            HashMap<UUID, Vector<UUID>> entitiesByAsset;
+
+            for (u32 i = 0; i < assetUUIDs.size(); i++)
+            {
+                if (assetUUIDs[i] != 0)
+                    entitiesByAsset[assetUUIDs[i]].push_back(entityUUIDs[i]);
+            }
+
+            std::weak_ptr<Scene> sceneRef = scene;
+
+            for (auto& [assetUUID, entities] : entitiesByAsset)
             {
-                Ref<ReadbackBuffer> buffer = Renderer::ReadbackTextureData(asset->GetResource(), mip);
-                void* mappedData = buffer->Map(0, 0);
+                AssetManager::LoadAssetAsync(assetUUID).OnLoaded([sceneRef, entities = std::move(entities), onLoaded](const Ref<Asset>& asset)
+                {
+                    Ref<Scene> loadedScene = sceneRef.lock();
 
-                u32 pixelDataSize = buffer->GetSize();
-                ofs.write((char*)&pixelDataSize, sizeof(u32));
-                ofs.write((char*)mappedData, pixelDataSize);
+                    if (!asset || !loadedScene)
+                        return;
 
-                buffer->Unmap();
+                    for (UUID entityUUID : entities)
+                    {
+                        if (Entity entity = loadedScene->FindEntityByUUID(entityUUID))
+                            onLoaded(entity, asset);
+                    }
+                });
             }
         }
-
-        return true;
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
     template<>
-    static bool AssetSerializer::Serialize(const std::filesystem::path& filepath, Ref<TextureCube> asset)
+    static bool AssetSerializer::Serialize(const std::filesystem::path& filepath, Ref<Texture2D> asset)
     {
-        std::ofstream ofs(filepath, std::ios::out | std::ios::binary);
+        // Mips that are not streamed in are copied from the current asset file before it gets overwritten
+        Vector<Vector<byte>> nonResidentMips(asset->m_ResidentMip);
+
+        if (asset->m_ResidentMip > 0)
+        {
+            AssetFileReader sourceFile(asset->m_MetaData.AssetFilepath);
+
+            for (u32 mip = 0; mip < asset->m_ResidentMip; mip++)
+            {
+                AssetChunkReader chunk = sourceFile.GetChunk(AssetChunkType::Subresource, mip);
+
+                if (!chunk.IsValid())
+                {
+                    ATOM_ERROR("Failed reading mip {} of streamed texture {}", mip, asset->m_MetaData.AssetFilepath);
+                    return false;
+                }
+
+                nonResidentMips[mip].assign(chunk.GetData(), chunk.GetData() + chunk.GetSize());
+            }
+        }
 
-        if (!ofs)
+        AssetFileWriter writer(filepath, GetCompression(AssetType::Texture2D));
+
+        if (!writer.IsValid())
             return false;
 
         std::filesystem::path absolutePath = std::filesystem::canonical(filepath);
@@ -99,71 +300,92 @@ namespace Atom
             AssetMetaData newMetaData = asset->m_MetaData;
             newMetaData.UUID = UUID();
             newMetaData.AssetFilepath = absolutePath;
-            SerializeMetaData(ofs, newMetaData);
+            SerializeMetaData(writer, newMetaData);
         }
         else
         {
             asset->m_MetaData.AssetFilepath = absolutePath;
             asset->SetAssetFlag(AssetFlags::Serialized);
-            SerializeMetaData(ofs, asset->m_MetaData);
+            SerializeMetaData(writer, asset->m_MetaData);
         }
 
-        const TextureDescription& desc = asset->m_TextureResource->GetDescription();
-        TextureFilter filter = asset->GetFilter();
-        TextureWrap wrap = asset->GetWrap();
-        bool isGpuWritable = asset->IsGpuWritable();
+        const TextureDescription& desc = asset->m_Description;
+
+        Utils::TextureFileHeader header;
+        header.Format = (u32)desc.Format;
+        header.Width = desc.Width;
+        header.Height = desc.Height;
+        header.MipLevels = desc.MipLevels;
+        header.Filter = (u32)asset->GetFilter();
+        header.Wrap = (u32)asset->GetWrap();
+        header.IsCpuReadable = asset->m_CpuReadable;
+        header.IsGpuWritable = asset->IsGpuWritable();
+        writer.WriteChunk(AssetChunkType::TextureHeader, 0, &header, sizeof(Utils::TextureFileHeader));
+
+        SerializeTextureSubresources(writer, asset, 1, nonResidentMips);
+
+        return writer.Finalize();
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    template<>
+    static bool AssetSerializer::Serialize(const std::filesystem::path& filepath, Ref<TextureCube> asset)
+    {
+        AssetFileWriter writer(filepath, GetCompression(AssetType::TextureCube));
+
+        if (!writer.IsValid())
+            return false;
 
-        ofs.write((char*)&desc.Format, sizeof(TextureFormat));
-        ofs.write((char*)&desc.Width, sizeof(u32));
-        ofs.write((char*)&desc.MipLevels, sizeof(u32));
-        ofs.write((char*)&filter, sizeof(TextureFilter));
-        ofs.write((char*)&wrap, sizeof(TextureWrap));
-        ofs.write((char*)&asset->m_CpuReadable, sizeof(bool));
-        ofs.write((char*)&isGpuWritable, sizeof(bool));
+        std::filesystem::path absolutePath = std::filesystem::canonical(filepath);
 
-        if (asset->m_CpuReadable)
+        if (asset->GetAssetFlag(AssetFlags::Serialized) && asset->m_MetaData.AssetFilepath != absolutePath)
         {
-            for (u32 face = 0; face < 6; face++)
-            {
-                for (u32 mip = 0; mip < asset->GetMipLevels(); mip++)
-                {
-                    u32 subresource = Texture::CalculateSubresource(mip, face, asset->GetMipLevels(), 6);
-                    u32 pixelDataSize = asset->m_PixelData[subresource].size();
-                    ofs.write((char*)&pixelDataSize, sizeof(u32));
-                    ofs.write((char*)asset->m_PixelData[subresource].data(), pixelDataSize);
-                }
-            }
+            // If the asset was already serialized but the path is different than the one passed as a paraeter, create a copy of the asset with a new ID
+            AssetMetaData newMetaData = asset->m_MetaData;
+            newMetaData.UUID = UUID();
+            newMetaData.AssetFilepath = absolutePath;
+            SerializeMetaData(writer, newMetaData);
         }
         else
         {
-            for (u32 face = 0; face < 6; face++)
-            {
-                for (u32 mip = 0; mip < asset->GetMipLevels(); mip++)
-                {
-                    Ref<ReadbackBuffer> buffer = Renderer::ReadbackTextureData(asset->GetResource(), mip, face);
-                    void* mappedData = buffer->Map(0, 0);
+            asset->m_MetaData.AssetFilepath = absolutePath;
+            asset->SetAssetFlag(AssetFlags::Serialized);
+            SerializeMetaData(writer, asset->m_MetaData);
+        }
 
-                    u32 pixelDataSize = buffer->GetSize();
-                    ofs.write((char*)&pixelDataSize, sizeof(u32));
-                    ofs.write((char*)mappedData, pixelDataSize);
+        const TextureDescription& desc = asset->m_TextureResource->GetDescription();
 
-                    buffer->Unmap();
-                }
-            }
-        }
+        Utils::TextureFileHeader header;
+        header.Format = (u32)desc.Format;
+        header.Width = desc.Width;
+        header.Height = desc.Height;
+        header.MipLevels = desc.MipLevels;
+        header.Filter = (u32)asset->GetFilter();
+        header.Wrap = (u32)asset->GetWrap();
+        header.IsCpuReadable = asset->m_CpuReadable;
+        header.IsGpuWritable = asset->IsGpuWritable();
+        writer.WriteChunk(AssetChunkType::TextureHeader, 0, &header, sizeof(Utils::TextureFileHeader));
 
-        return true;
+        SerializeTextureSubresources(writer, asset, 6);
+
+        return writer.Finalize();
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
     template<>
     static bool AssetSerializer::Serialize(const std::filesystem::path& filepath, Ref<Material> asset)
     {
-        std::ofstream ofs(filepath, std::ios::out | std::ios::binary);
+        // Textures that are still streaming in are represented by placeholders
+        AssetManager::WaitForAsyncLoads();
 
-        if (!ofs)
+        AssetFileWriter writer(filepath, GetCompression(AssetType::Material));
+
+        if (!writer.IsValid())
             return false;
 
+        // Imports reuse materials with the same parameters, so the hash has to match what is written
+        asset->m_MetaData.ContentHash = asset->ComputeContentHash();
+
         std::filesystem::path absolutePath = std::filesystem::canonical(filepath);
 
         if (asset->GetAssetFlag(AssetFlags::Serialized) && asset->m_MetaData.AssetFilepath != absolutePath)
@@ -172,30 +394,33 @@ namespace Atom
             AssetMetaData newMetaData = asset->m_MetaData;
             newMetaData.UUID = UUID();
             newMetaData.AssetFilepath = absolutePath;
-            SerializeMetaData(ofs, newMetaData);
+            SerializeMetaData(writer, newMetaData);
         }
         else
         {
             asset->m_MetaData.AssetFilepath = absolutePath;
             asset->SetAssetFlag(AssetFlags::Serialized);
-            SerializeMetaData(ofs, asset->m_MetaData);
+            SerializeMetaData(writer, asset->m_MetaData);
         }
 
+        writer.BeginChunk(AssetChunkType::Data);
         // Serialize shader name
         u32 shaderNameLength = asset->GetShader()->GetName().length();
-        ofs.write((char*)&shaderNameLength, sizeof(u32));
-        ofs.write(asset->GetShader()->GetName().data(), shaderNameLength);
+        writer.Write(&shaderNameLength, sizeof(u32));
+        writer.Write(asset->GetShader()->GetName().data(), shaderNameLength);
 
         // Serialize flags
         MaterialFlags flags = asset->GetFlags();
-        ofs.write((char*)&flags, sizeof(MaterialFlags));
+        writer.Write(&flags, sizeof(MaterialFlags));
 
         // Serialize constants data
-        ofs.write((char*)asset->GetConstantsData().data(), asset->GetConstantsData().size());
+        writer.Write(asset->GetConstantsData().data(), asset->GetConstantsData().size());
 
         // Serialize textures
         u32 textureCount = asset->GetTextures().size();
-        ofs.write((char*)&textureCount, sizeof(u32));
+        writer.Write(&textureCount, sizeof(u32));
+
+        Vector<UUID> dependencies;
 
         for (auto& [textureRegister, textureAsset] : asset->GetTextures())
         {
@@ -210,20 +435,27 @@ namespace Atom
                 textureHandle = texture->GetUUID();
             }
 
-            ofs.write((char*)&textureRegister, sizeof(u32));
-            ofs.write((char*)&textureHandle, sizeof(u64));
+            writer.Write(&textureRegister, sizeof(u32));
+            writer.Write(&textureHandle, sizeof(u64));
+
+            // Empty texture slots are not dependencies
+            if (textureHandle != 0)
+                dependencies.push_back(textureHandle);
         }
 
-        return true;
+        writer.EndChunk();
+        SerializeDependencies(writer, dependencies);
+
+        return writer.Finalize();
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
     template<>
     static bool AssetSerializer::Serialize(const std::filesystem::path& filepath, Ref<Mesh> asset)
     {
-        std::ofstream ofs(filepath, std::ios::out | std::ios::binary);
+        AssetFileWriter writer(filepath, GetCompression(AssetType::Mesh));
 
-        if (!ofs)
+        if (!writer.IsValid())
             return false;
 
         std::filesystem::path absolutePath = std::filesystem::canonical(filepath);
@@ -234,54 +466,76 @@ namespace Atom
             AssetMetaData newMetaData = asset->m_MetaData;
             newMetaData.UUID = UUID();
             newMetaData.AssetFilepath = absolutePath;
-            SerializeMetaData(ofs, newMetaData);
+            SerializeMetaData(writer, newMetaData);
         }
         else
         {
             asset->m_MetaData.AssetFilepath = absolutePath;
             asset->SetAssetFlag(AssetFlags::Serialized);
-            SerializeMetaData(ofs, asset->m_MetaData);
+            SerializeMetaData(writer, asset->m_MetaData);
         }
 
-        u32 vertexCount = asset->m_Positions.size();
-        ofs.write((char*)&vertexCount, sizeof(u32));
-        ofs.write((char*)asset->m_Positions.data(), sizeof(glm::vec3) * vertexCount);
-        ofs.write((char*)asset->m_UVs.data(), sizeof(glm::vec2) * vertexCount);
-        ofs.write((char*)asset->m_Normals.data(), sizeof(glm::vec3) * vertexCount);
-        ofs.write((char*)asset->m_Tangents.data(), sizeof(glm::vec3) * vertexCount);
-        ofs.write((char*)asset->m_Bitangents.data(), sizeof(glm::vec3) * vertexCount);
-        ofs.write((char*)asset->m_BoneWeights.data(), sizeof(BoneWeight) * vertexCount);
+        bool isAnimated = !asset->m_BoneWeights.empty();
 
-        u32 indexCount = asset->m_Indices.size();
-        ofs.write((char*)&indexCount, sizeof(u32));
-        ofs.write((char*)asset->m_Indices.data(), sizeof(u32) * indexCount);
+        Utils::MeshFileHeader header;
+        header.VertexCount = asset->m_Positions.size();
+        header.VertexStride = Mesh::GetVertexStride(isAnimated);
+        header.IndexCount = asset->m_Indices.size();
+        header.SubmeshCount = asset->m_Submeshes.size();
+        header.IsReadable = asset->m_IsReadable;
+        header.IsAnimated = isAnimated;
+        writer.WriteChunk(AssetChunkType::MeshHeader, 0, &header, sizeof(Utils::MeshFileHeader));
 
-        u32 submeshCount = asset->m_Submeshes.size();
-        ofs.write((char*)&submeshCount, sizeof(u32));
-        ofs.write((char*)asset->m_Submeshes.data(), sizeof(Submesh) * submeshCount);
+        Vector<byte> vertexData;
+        Mesh::InterleaveVertices(asset->m_Positions, asset->m_UVs, asset->m_Normals, asset->m_Tangents, asset->m_Bitangents, asset->m_BoneWeights, vertexData);
+        writer.WriteChunk(AssetChunkType::VertexData, 0, vertexData.data(), vertexData.size());
+        writer.WriteChunk(AssetChunkType::IndexData, 0, asset->m_Indices.data(), sizeof(u32) * header.IndexCount);
+        writer.WriteChunk(AssetChunkType::Submeshes, 0, asset->m_Submeshes.data(), sizeof(Submesh) * header.SubmeshCount);
 
-        ofs.write((char*)&asset->m_IsReadable, sizeof(bool));
+        Vector<UUID> dependencies;
 
-        for (u32 submeshIdx = 0; submeshIdx < submeshCount; submeshIdx++)
+        writer.BeginChunk(AssetChunkType::Materials);
+        for (u32 submeshIdx = 0; submeshIdx < header.SubmeshCount; submeshIdx++)
         {
             UUID materialUUID = 0;
 
             if (Ref<Material> material = asset->m_MaterialTable->GetMaterial(submeshIdx))
                 materialUUID = material->m_MetaData.UUID;
 
-            ofs.write((char*)&materialUUID, sizeof(u64));
+            writer.Write(&materialUUID, sizeof(u64));
+            dependencies.push_back(materialUUID);
         }
+        writer.EndChunk();
+        SerializeDependencies(writer, dependencies);
 
-        return true;
+        if (asset->m_IsReadable)
+        {
+            writer.BeginChunk(AssetChunkType::VertexStreams);
+            writer.Write(asset->m_Positions.data(), sizeof(glm::vec3) * header.VertexCount);
+            writer.Write(asset->m_UVs.data(), sizeof(glm::vec2) * header.VertexCount);
+            writer.Write(asset->m_Normals.data(), sizeof(glm::vec3) * header.VertexCount);
+            writer.Write(asset->m_Tangents.data(), sizeof(glm::vec3) * header.VertexCount);
+            writer.Write(asset->m_Bitangents.data(), sizeof(glm::vec3) * header.VertexCount);
+
+            if (isAnimated)
+                writer.Write(asset->m_BoneWeights.data(), sizeof(BoneWeight) * header.VertexCount);
+
+            writer.EndChunk();
+        }
+
+        return writer.Finalize();
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
     template<>
     static bool AssetSerializer::Serialize(const std::filesystem::path& filepath, Ref<Scene> asset)
     {
-        std::ofstream ofs(filepath, std::ios::out | std::ios::binary);
+        // Components are only assigned their assets once those finished loading
+        AssetManager::WaitForAsyncLoads();
 
-        if (!ofs)
+        AssetFileWriter writer(filepath, GetCompression(AssetType::Scene));
+
+        if (!writer.IsValid())
             return false;
 
         std::filesystem::path absolutePath = std::filesystem::canonical(filepath);
@@ -292,275 +546,292 @@ namespace Atom
             AssetMetaData newMetaData = asset->m_MetaData;
             newMetaData.UUID = UUID();
             newMetaData.AssetFilepath = absolutePath;
-            SerializeMetaData(ofs, newMetaData);
+            SerializeMetaData(writer, newMetaData);
         }
         else
         {
             asset->m_MetaData.AssetFilepath = absolutePath;
             asset->SetAssetFlag(AssetFlags::Serialized);
-            SerializeMetaData(ofs, asset->m_MetaData);
+            SerializeMetaData(writer, asset->m_MetaData);
         }
-        
+
+        Vector<UUID> dependencies;
+        entt::registry& registry = asset->m_Registry;
+
+        writer.BeginChunk(AssetChunkType::Data);
         u32 nameSize = asset->m_Name.size();
-        ofs.write((char*)&nameSize, sizeof(u32));
-        ofs.write((char*)asset->m_Name.data(), nameSize);
+        writer.Write(&nameSize, sizeof(u32));
+        writer.Write(asset->m_Name.data(), nameSize);
+        writer.EndChunk();
 
-        u32 entityCount = asset->m_Registry.alive();
-        ofs.write((char*)&entityCount, sizeof(u32));
+        // Component pools refer to their entities by the index of the entity in this column
+        auto idView = registry.view<IDComponent>();
+        Vector<UUID> entityUUIDs;
+        Vector<u32> entityIndices(registry.size(), UINT32_MAX);
+        entityUUIDs.reserve(idView.size());
 
-        asset->m_Registry.each([&](auto entityID)
+        for (entt::entity entity : idView)
         {
-            Entity entity = { entityID, asset.get() };
+            entityIndices[entt::to_entity(entity)] = entityUUIDs.size();
+            entityUUIDs.push_back(idView.get<IDComponent>(entity).ID);
+        }
 
-            bool isValid = (bool)entity;
-            ofs.write((char*)&isValid, sizeof(bool));
+        u32 entityCount = entityUUIDs.size();
+        writer.BeginChunk(AssetChunkType::SceneEntities);
+        writer.Write(entityCount);
+        writer.Write(entityUUIDs.data(), sizeof(UUID) * entityCount);
+        writer.EndChunk();
 
-            if (!isValid)
-                return;
+        // Tags are stored as a column of sizes followed by the characters of all tags
+        Vector<entt::entity> entities = Utils::BeginComponentPool<TagComponent>(writer, Utils::SceneComponentPool::Tag, registry, entityIndices);
+
+        if (!entities.empty())
+        {
+            Vector<u32> tagSizes;
+            tagSizes.reserve(entities.size());
 
-            UUID uuid = entity.GetUUID();
-            ofs.write((char*)&uuid, sizeof(UUID));
+            for (entt::entity entity : entities)
+                tagSizes.push_back(registry.get<TagComponent>(entity).Tag.size());
 
-            bool hasTagComponent = entity.HasComponent<TagComponent>();
-            ofs.write((char*)&hasTagComponent, sizeof(bool));
+            writer.Write(tagSizes.data(), sizeof(u32) * tagSizes.size());
 
-            if (hasTagComponent)
+            for (entt::entity entity : entities)
             {
-                auto& tc = entity.GetComponent<TagComponent>();
-                u32 tagSize = tc.Tag.size();
-                ofs.write((char*)&tagSize, sizeof(u32));
-                ofs.write((char*)tc.Tag.data(), tagSize);
+                const String& tag = registry.get<TagComponent>(entity).Tag;
+                writer.Write(tag.data(), tag.size());
             }
 
-            bool hasSceneHierarchyComponent = entity.HasComponent<SceneHierarchyComponent>();
-            ofs.write((char*)&hasSceneHierarchyComponent, sizeof(bool));
+            writer.EndChunk();
+        }
+
+        Utils::SerializeRawComponentPool<SceneHierarchyComponent>(writer, Utils::SceneComponentPool::SceneHierarchy, registry, entityIndices);
+        Utils::SerializeRawComponentPool<TransformComponent>(writer, Utils::SceneComponentPool::Transform, registry, entityIndices);
 
-            if (hasSceneHierarchyComponent)
-            {
-                auto& shc = entity.GetComponent<SceneHierarchyComponent>();
-                ofs.write((char*)&shc, sizeof(SceneHierarchyComponent));
-            }
+        entities = Utils::BeginComponentPool<CameraComponent>(writer, Utils::SceneComponentPool::Camera, registry, entityIndices);
 
-            bool hasTransformComponent = entity.HasComponent<TransformComponent>();
-            ofs.write((char*)&hasTransformComponent, sizeof(bool));
+        if (!entities.empty())
+        {
+            Vector<Utils::SerializedCamera> cameras;
+            cameras.reserve(entities.size());
 
-            if (hasTransformComponent)
+            for (entt::entity entity : entities)
             {
-                auto& tc = entity.GetComponent<TransformComponent>();
-                ofs.write((char*)&tc, sizeof(TransformComponent));
+                auto& cc = registry.get<CameraComponent>(entity);
+                auto& camera = cameras.emplace_back();
+                camera.ProjectionType = (s32)cc.Camera.GetProjectionType();
+                camera.PerspectiveFOV = cc.Camera.GetPerspectiveFOV();
+                camera.PerspectiveNear = cc.Camera.GetPerspectiveNear();
+                camera.PerspectiveFar = cc.Camera.GetPerspectiveFar();
+                camera.OrthographicSize = cc.Camera.GetOrthographicSize();
+                camera.OrthographicNear = cc.Camera.GetOrthographicNear();
+                camera.OrthographicFar = cc.Camera.GetOrthographicFar();
+                camera.Primary = cc.Primary;
+                camera.FixedAspectRatio = cc.FixedAspectRatio;
             }
 
-            bool hasCameraComponent = entity.HasComponent<CameraComponent>();
-            ofs.write((char*)&hasCameraComponent, sizeof(bool));
+            writer.Write(cameras.data(), sizeof(Utils::SerializedCamera) * cameras.size());
+            writer.EndChunk();
+        }
 
-            if (hasCameraComponent)
-            {
-                auto& cc = entity.GetComponent<CameraComponent>();
-                ofs.write((char*)&cc, sizeof(CameraComponent));
-            }
+        // Components referencing assets store the UUIDs of their assets
+        entities = Utils::BeginComponentPool<MeshComponent>(writer, Utils::SceneComponentPool::Mesh, registry, entityIndices);
 
-            bool hasMeshComponent = entity.HasComponent<MeshComponent>();
-            ofs.write((char*)&hasMeshComponent, sizeof(bool));
+        if (!entities.empty())
+        {
+            Vector<UUID> meshUUIDs;
+            meshUUIDs.reserve(entities.size());
 
-            if (hasMeshComponent)
+            for (entt::entity entity : entities)
             {
-                auto& mc = entity.GetComponent<MeshComponent>();
-
-                UUID uuid = mc.Mesh ? mc.Mesh->GetUUID() : 0;
-                ofs.write((char*)&uuid, sizeof(UUID));
+                auto& mc = registry.get<MeshComponent>(entity);
+                meshUUIDs.push_back(mc.Mesh ? mc.Mesh->GetUUID() : UUID(0));
             }
 
-            bool hasAnimatedMeshComponent = entity.HasComponent<AnimatedMeshComponent>();
-            ofs.write((char*)&hasAnimatedMeshComponent, sizeof(bool));
+            writer.Write(meshUUIDs.data(), sizeof(UUID) * meshUUIDs.size());
+            writer.EndChunk();
+            dependencies.insert(dependencies.end(), meshUUIDs.begin(), meshUUIDs.end());
+        }
 
-            if (hasAnimatedMeshComponent)
-            {
-                auto& amc = entity.GetComponent<AnimatedMeshComponent>();
+        entities = Utils::BeginComponentPool<AnimatedMeshComponent>(writer, Utils::SceneComponentPool::AnimatedMesh, registry, entityIndices);
 
-                UUID meshUUID = amc.Mesh ? amc.Mesh->GetUUID() : 0;
-                ofs.write((char*)&meshUUID, sizeof(UUID));
+        if (!entities.empty())
+        {
+            Vector<UUID> meshUUIDs;
+            Vector<UUID> skeletonUUIDs;
+            meshUUIDs.reserve(entities.size());
+            skeletonUUIDs.reserve(entities.size());
 
-                UUID skeletonUUID = amc.Skeleton ? amc.Skeleton->GetUUID() : 0;
-                ofs.write((char*)&skeletonUUID, sizeof(UUID));
+            for (entt::entity entity : entities)
+            {
+                auto& amc = registry.get<AnimatedMeshComponent>(entity);
+                meshUUIDs.push_back(amc.Mesh ? amc.Mesh->GetUUID() : UUID(0));
+                skeletonUUIDs.push_back(amc.Skeleton ? amc.Skeleton->GetUUID() : UUID(0));
             }
 
-            bool hasAnimatorComponent = entity.HasComponent<AnimatorComponent>();
-            ofs.write((char*)&hasAnimatorComponent, sizeof(bool));
-
-            if (hasAnimatorComponent)
-            {
-                auto& ac = entity.GetComponent<AnimatorComponent>();
+            writer.Write(meshUUIDs.data(), sizeof(UUID) * meshUUIDs.size());
+            writer.Write(skeletonUUIDs.data(), sizeof(UUID) * skeletonUUIDs.size());
+            writer.EndChunk();
+            dependencies.insert(dependencies.end(), meshUUIDs.begin(), meshUUIDs.end());
+            dependencies.insert(dependencies.end(), skeletonUUIDs.begin(), skeletonUUIDs.end());
+        }
 
-                UUID animationControllerUUID = ac.AnimationController ? ac.AnimationController->GetUUID() : 0;
-                ofs.write((char*)&animationControllerUUID, sizeof(UUID));
-                ofs.write((char*)&ac.Play, sizeof(bool));
-            }
+        entities = Utils::BeginComponentPool<AnimatorComponent>(writer, Utils::SceneComponentPool::Animator, registry, entityIndices);
 
-            bool hasSkyLightComponent = entity.HasComponent<SkyLightComponent>();
-            ofs.write((char*)&hasSkyLightComponent, sizeof(bool));
+        if (!entities.empty())
+        {
+            Vector<UUID> animationControllerUUIDs;
+            Vector<u8> play;
+            animationControllerUUIDs.reserve(entities.size());
+            play.reserve(entities.size());
 
-            if (hasSkyLightComponent)
+            for (entt::entity entity : entities)
             {
-                auto& slc = entity.GetComponent<SkyLightComponent>();
-
-                UUID uuid = slc.EnvironmentMap ? slc.EnvironmentMap->GetUUID() : 0;
-                ofs.write((char*)&uuid, sizeof(UUID));
+                auto& ac = registry.get<AnimatorComponent>(entity);
+                animationControllerUUIDs.push_back(ac.AnimationController ? ac.AnimationController->GetUUID() : UUID(0));
+                play.push_back(ac.Play);
             }
 
-            bool hasDirectionalLightComponent = entity.HasComponent<DirectionalLightComponent>();
-            ofs.write((char*)&hasDirectionalLightComponent, sizeof(bool));
+            writer.Write(animationControllerUUIDs.data(), sizeof(UUID) * animationControllerUUIDs.size());
+            writer.Write(play.data(), sizeof(u8) * play.size());
+            writer.EndChunk();
+            dependencies.insert(dependencies.end(), animationControllerUUIDs.begin(), animationControllerUUIDs.end());
+        }
 
-            if (hasDirectionalLightComponent)
-            {
-                auto& dlc = entity.GetComponent<DirectionalLightComponent>();
-                ofs.write((char*)&dlc, sizeof(DirectionalLightComponent));
-            }
+        entities = Utils::BeginComponentPool<SkyLightComponent>(writer, Utils::SceneComponentPool::SkyLight, registry, entityIndices);
 
-            bool hasPointLightComponent = entity.HasComponent<PointLightComponent>();
-            ofs.write((char*)&hasPointLightComponent, sizeof(bool));
+        if (!entities.empty())
+        {
+            Vector<UUID> environmentMapUUIDs;
+            environmentMapUUIDs.reserve(entities.size());
 
-            if (hasPointLightComponent)
+            for (entt::entity entity : entities)
             {
-                auto& plc = entity.GetComponent<PointLightComponent>();
-                ofs.write((char*)&plc, sizeof(PointLightComponent));
+                auto& slc = registry.get<SkyLightComponent>(entity);
+                environmentMapUUIDs.push_back(slc.EnvironmentMap ? slc.EnvironmentMap->GetUUID() : UUID(0));
             }
 
-            bool hasSpotLightComponent = entity.HasComponent<SpotLightComponent>();
-            ofs.write((char*)&hasSpotLightComponent, sizeof(bool));
+            writer.Write(environmentMapUUIDs.data(), sizeof(UUID) * environmentMapUUIDs.size());
+            writer.EndChunk();
+            dependencies.insert(dependencies.end(), environmentMapUUIDs.begin(), environmentMapUUIDs.end());
+        }
 
-            if (hasSpotLightComponent)
-            {
-                auto& slc = entity.GetComponent<SpotLightComponent>();
-                ofs.write((char*)&slc, sizeof(SpotLightComponent));
-            }
+        Utils::SerializeRawComponentPool<DirectionalLightComponent>(writer, Utils::SceneComponentPool::DirectionalLight, registry, entityIndices);
+        Utils::SerializeRawComponentPool<PointLightComponent>(writer, Utils::SceneComponentPool::PointLight, registry, entityIndices);
+        Utils::SerializeRawComponentPool<SpotLightComponent>(writer, Utils::SceneComponentPool::SpotLight, registry, entityIndices);
 
-            bool hasScriptComponent = entity.HasComponent<ScriptComponent>();
-            ofs.write((char*)&hasScriptComponent, sizeof(bool));
+        // Scripts store their class name followed by the variables of the entity's script instance
+        entities = Utils::BeginComponentPool<ScriptComponent>(writer, Utils::SceneComponentPool::Script, registry, entityIndices);
 
-            if (hasScriptComponent)
+        if (!entities.empty())
+        {
+            for (entt::entity entity : entities)
             {
-                auto& sc = entity.GetComponent<ScriptComponent>();
+                auto& sc = registry.get<ScriptComponent>(entity);
                 u32 scriptClassSize = sc.ScriptClass.size();
-                ofs.write((char*)&scriptClassSize, sizeof(u32));
-                ofs.write((char*)sc.ScriptClass.data(), scriptClassSize);
+                writer.Write(&scriptClassSize, sizeof(u32));
+                writer.Write(sc.ScriptClass.data(), scriptClassSize);
+
+                u32 scriptVariableCount = 0;
 
-                if (Ref<ScriptClass> scriptClass = ScriptEngine::GetScriptClass(sc.ScriptClass))
+                if (!ScriptEngine::GetScriptClass(sc.ScriptClass))
                 {
-                    // Get the fields from the script field map for the entity
-                    ScriptVariableMap& scriptInstanceVarMap = ScriptEngine::GetScriptVariableMap(entity);
+                    writer.Write(scriptVariableCount);
+                    continue;
+                }
 
-                    u32 scriptVariableCount = scriptInstanceVarMap.size();
-                    ofs.write((char*)&scriptVariableCount, sizeof(u32));
+                // Get the fields from the script field map for the entity
+                ScriptVariableMap& scriptInstanceVarMap = ScriptEngine::GetScriptVariableMap({ entity, asset.get() });
 
-                    for (auto& [name, variable] : scriptInstanceVarMap)
-                    {
-                        u32 varNameSize = name.size();
-                        ofs.write((char*)&varNameSize, sizeof(u32));
-                        ofs.write((char*)name.data(), varNameSize);
+                scriptVariableCount = scriptInstanceVarMap.size();
+                writer.Write(&scriptVariableCount, sizeof(u32));
+
+                for (auto& [name, variable] : scriptInstanceVarMap)
+                {
+                    u32 varNameSize = name.size();
+                    writer.Write(&varNameSize, sizeof(u32));
+                    writer.Write(name.data(), varNameSize);
 
-                        ScriptVariableType type = variable.GetType();
-                        ofs.write((char*)&type, sizeof(ScriptVariableType));
+                    ScriptVariableType type = variable.GetType();
+                    writer.Write(&type, sizeof(ScriptVariableType));
 
-                        switch (type)
+                    switch (type)
+                    {
+                        case ScriptVariableType::Int:
+                        {
+                            s32 value = variable.GetValue<s32>();
+                            writer.Write(&value, sizeof(s32));
+                            break;
+                        }
+                        case ScriptVariableType::Float:
+                        {
+                            f32 value = variable.GetValue<f32>();
+                            writer.Write(&value, sizeof(f32));
+                            break;
+                        }
+                        case ScriptVariableType::Bool:
+                        {
+                            bool value = variable.GetValue<bool>();
+                            writer.Write(&value, sizeof(bool));
+                            break;
+                        }
+                        case ScriptVariableType::Vec2:
+                        {
+                            glm::vec2 value = variable.GetValue<glm::vec2>();
+                            writer.Write(&value, sizeof(glm::vec2));
+                            break;
+                        }
+                        case ScriptVariableType::Vec3:
+                        {
+                            glm::vec3 value = variable.GetValue<glm::vec3>();
+                            writer.Write(&value, sizeof(glm::vec3));
+                            break;
+                        }
+                        case ScriptVariableType::Vec4:
+                        {
+                            glm::vec4 value = variable.GetValue<glm::vec4>();
+                            writer.Write(&value, sizeof(glm::vec4));
+                            break;
+                        }
+                        case ScriptVariableType::Entity:
+                        {
+                            UUID value = variable.GetValue<UUID>();
+                            writer.Write(&value, sizeof(UUID));
+                            break;
+                        }
+                        case ScriptVariableType::Material:
+                        case ScriptVariableType::Mesh:
+                        case ScriptVariableType::Texture2D:
+                        case ScriptVariableType::TextureCube:
                         {
-                            case ScriptVariableType::Int:
-                            {
-                                s32 value = variable.GetValue<s32>();
-                                ofs.write((char*)&value, sizeof(s32));
-                                break;
-                            }
-                            case ScriptVariableType::Float:
-                            {
-                                f32 value = variable.GetValue<f32>();
-                                ofs.write((char*)&value, sizeof(f32));
-                                break;
-                            }
-                            case ScriptVariableType::Bool:
-                            {
-                                bool value = variable.GetValue<bool>();
-                                ofs.write((char*)&value, sizeof(bool));
-                                break;
-                            }
-                            case ScriptVariableType::Vec2:
-                            {
-                                glm::vec2 value = variable.GetValue<glm::vec2>();
-                                ofs.write((char*)&value, sizeof(glm::vec2));
-                                break;
-                            }
-                            case ScriptVariableType::Vec3:
-                            {
-                                glm::vec3 value = variable.GetValue<glm::vec3>();
-                                ofs.write((char*)&value, sizeof(glm::vec3));
-                                break;
-                            }
-                            case ScriptVariableType::Vec4:
-                            {
-                                glm::vec4 value = variable.GetValue<glm::vec4>();
-                                ofs.write((char*)&value, sizeof(glm::vec4));
-                                break;
-                            }
-                            case ScriptVariableType::Entity:
-                            case ScriptVariableType::Material:
-                            case ScriptVariableType::Mesh:
-                            case ScriptVariableType::Texture2D:
-                            case ScriptVariableType::TextureCube:
-                            {
-                                UUID value = variable.GetValue<UUID>();
-                                ofs.write((char*)&value, sizeof(UUID));
-                                break;
-                            }
+                            UUID value = variable.GetValue<UUID>();
+                            writer.Write(&value, sizeof(UUID));
+                            dependencies.push_back(value);
+                            break;
                         }
                     }
                 }
             }
 
-            bool hasRigidbodyComponent = entity.HasComponent<RigidbodyComponent>();
-            ofs.write((char*)&hasRigidbodyComponent, sizeof(bool));
-
-            if (hasRigidbodyComponent)
-            {
-                auto& rbc = entity.GetComponent<RigidbodyComponent>();
-                ofs.write((char*)&rbc, sizeof(RigidbodyComponent));
-            }
-
-            bool hasBoxColliderComponent = entity.HasComponent<BoxColliderComponent>();
-            ofs.write((char*)&hasBoxColliderComponent, sizeof(bool));
-
-            if (hasBoxColliderComponent)
-            {
-                auto& bcc = entity.GetComponent<BoxColliderComponent>();
-                ofs.write((char*)&bcc, sizeof(BoxColliderComponent));
-            }
-
-            bool hasSphereColliderComponent = entity.HasComponent<SphereColliderComponent>();
-            ofs.write((char*)&hasSphereColliderComponent, sizeof(bool));
-
-            if (hasSphereColliderComponent)
-            {
-                auto& scc = entity.GetComponent<SphereColliderComponent>();
-                ofs.write((char*)&scc, sizeof(SphereColliderComponent));
-            }
+            writer.EndChunk();
+        }
 
-            bool hasCapsuleColliderComponent = entity.HasComponent<CapsuleColliderComponent>();
-            ofs.write((char*)&hasCapsuleColliderComponent, sizeof(bool));
+        Utils::SerializeRawComponentPool<RigidbodyComponent>(writer, Utils::SceneComponentPool::Rigidbody, registry, entityIndices);
+        Utils::SerializeRawComponentPool<BoxColliderComponent>(writer, Utils::SceneComponentPool::BoxCollider, registry, entityIndices);
+        Utils::SerializeRawComponentPool<SphereColliderComponent>(writer, Utils::SceneComponentPool::SphereCollider, registry, entityIndices);
+        Utils::SerializeRawComponentPool<CapsuleColliderComponent>(writer, Utils::SceneComponentPool::CapsuleCollider, registry, entityIndices);
 
-            if (hasCapsuleColliderComponent)
-            {
-                auto& ccc = entity.GetComponent<CapsuleColliderComponent>();
-                ofs.write((char*)&ccc, sizeof(CapsuleColliderComponent));
-            }
-        });
+        SerializeDependencies(writer, dependencies);
 
-        return true;
+        return writer.Finalize();
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
     template<>
     static bool AssetSerializer::Serialize(const std::filesystem::path& filepath, Ref<Animation> asset)
     {
-        std::ofstream ofs(filepath, std::ios::out | std::ios::binary);
+        AssetFileWriter writer(filepath, GetCompression(AssetType::Animation));
 
-        if (!ofs)
+        if (!writer.IsValid())
             return false;
 
         std::filesystem::path absolutePath = std::filesystem::canonical(filepath);
@@ -571,45 +842,87 @@ namespace Atom
             AssetMetaData newMetaData = asset->m_MetaData;
             newMetaData.UUID = UUID();
             newMetaData.AssetFilepath = absolutePath;
-            SerializeMetaData(ofs, newMetaData);
+            SerializeMetaData(writer, newMetaData);
         }
         else
         {
             asset->m_MetaData.AssetFilepath = absolutePath;
             asset->SetAssetFlag(AssetFlags::Serialized);
-            SerializeMetaData(ofs, asset->m_MetaData);
+            SerializeMetaData(writer, asset->m_MetaData);
         }
 
-        ofs.write((char*)&asset->m_Duration, sizeof(f32));
-        ofs.write((char*)&asset->m_TicksPerSecond, sizeof(f32));
+        writer.BeginChunk(AssetChunkType::Data);
+        writer.Write(&asset->m_Duration, sizeof(f32));
+        writer.Write(&asset->m_TicksPerSecond, sizeof(f32));
+        writer.Write(&asset->m_IsQuantized, sizeof(bool));
 
-        u32 keyFrameCount = asset->m_KeyFrames.size();
-        ofs.write((char*)&keyFrameCount, sizeof(u32));
-
-        for (auto& keyFrame : asset->m_KeyFrames)
+        if (asset->m_IsQuantized)
         {
-            ofs.write((char*)&keyFrame.TimeStamp, sizeof(f32));
+            u32 trackCount = asset->m_Tracks.size();
+            writer.Write(&trackCount, sizeof(u32));
 
-            u32 boneCount = keyFrame.BoneTransforms.size();
-            ofs.write((char*)&boneCount, sizeof(u32));
+            for (auto& track : asset->m_Tracks)
+            {
+                writer.Write(&track.BoneID, sizeof(u32));
+
+                u32 positionKeyCount = track.Positions.size();
+                writer.Write(&positionKeyCount, sizeof(u32));
+                writer.Write(track.PositionTimeStamps.data(), sizeof(f32) * positionKeyCount);
+                writer.Write(track.Positions.data(), sizeof(Animation::QuantizedVec3) * positionKeyCount);
+                writer.Write(&track.PositionRangeMin, sizeof(glm::vec3));
+                writer.Write(&track.PositionRangeExtent, sizeof(glm::vec3));
+
+                u32 rotationKeyCount = track.Rotations.size();
+                writer.Write(&rotationKeyCount, sizeof(u32));
+                writer.Write(track.RotationTimeStamps.data(), sizeof(f32) * rotationKeyCount);
+                writer.Write(track.Rotations.data(), sizeof(Animation::QuantizedQuat) * rotationKeyCount);
+
+                u32 scaleKeyCount = track.Scales.size();
+                writer.Write(&scaleKeyCount, sizeof(u32));
+                writer.Write(track.ScaleTimeStamps.data(), sizeof(f32) * scaleKeyCount);
+                writer.Write(track.Scales.data(), sizeof(Animation::QuantizedVec3) * scaleKeyCount);
+                writer.Write(&track.ScaleRangeMin, sizeof(glm::vec3));
+                writer.Write(&track.ScaleRangeExtent, sizeof(glm::vec3));
+            }
+        }
+        else
+        {
+            u32 trackCount = asset->m_UncompressedTracks.size();
+            writer.Write(&trackCount, sizeof(u32));
 
-            for (auto& [boneID, boneTransform] : keyFrame.BoneTransforms)
+            for (auto& track : asset->m_UncompressedTracks)
             {
-                ofs.write((char*)&boneID, sizeof(u32));
-                ofs.write((char*)&boneTransform, sizeof(Animation::BoneTransform));
+                writer.Write(&track.BoneID, sizeof(u32));
+
+                u32 positionKeyCount = track.Positions.size();
+                writer.Write(&positionKeyCount, sizeof(u32));
+                writer.Write(track.PositionTimeStamps.data(), sizeof(f32) * positionKeyCount);
+                writer.Write(track.Positions.data(), sizeof(glm::vec3) * positionKeyCount);
+
+                u32 rotationKeyCount = track.Rotations.size();
+                writer.Write(&rotationKeyCount, sizeof(u32));
+                writer.Write(track.RotationTimeStamps.data(), sizeof(f32) * rotationKeyCount);
+                writer.Write(track.Rotations.data(), sizeof(glm::quat) * rotationKeyCount);
+
+                u32 scaleKeyCount = track.Scales.size();
+                writer.Write(&scaleKeyCount, sizeof(u32));
+                writer.Write(track.ScaleTimeStamps.data(), sizeof(f32) * scaleKeyCount);
+                writer.Write(track.Scales.data(), sizeof(glm::vec3) * scaleKeyCount);
             }
         }
 
-        return true;
+        writer.EndChunk();
+
+        return writer.Finalize();
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
     template<>
     static bool AssetSerializer::Serialize(const std::filesystem::path& filepath, Ref<AnimationController> asset)
     {
-        std::ofstream ofs(filepath, std::ios::out | std::ios::binary);
+        AssetFileWriter writer(filepath, GetCompression(AssetType::AnimationController));
 
-        if (!ofs)
+        if (!writer.IsValid())
             return false;
 
         std::filesystem::path absolutePath = std::filesystem::canonical(filepath);
@@ -620,36 +933,57 @@ namespace Atom
             AssetMetaData newMetaData = asset->m_MetaData;
             newMetaData.UUID = UUID();
             newMetaData.AssetFilepath = absolutePath;
-            SerializeMetaData(ofs, newMetaData);
+            SerializeMetaData(writer, newMetaData);
         }
         else
         {
             asset->m_MetaData.AssetFilepath = absolutePath;
             asset->SetAssetFlag(AssetFlags::Serialized);
-            SerializeMetaData(ofs, asset->m_MetaData);
+            SerializeMetaData(writer, asset->m_MetaData);
         }
 
-        ofs.write((char*)&asset->m_InitialStateIdx, sizeof(u16));
+        writer.BeginChunk(AssetChunkType::Data);
+        writer.Write(&asset->m_InitialStateIdx, sizeof(u16));
 
         u32 animationStatesCount = asset->m_AnimationStates.size();
-        ofs.write((char*)&animationStatesCount, sizeof(u32));
+        writer.Write(&animationStatesCount, sizeof(u32));
+
+        Vector<UUID> dependencies;
 
         for (const auto& animState : asset->m_AnimationStates)
         {
-            UUID uuid = animState->GetUUID();
-            ofs.write((char*)&uuid, sizeof(UUID));
+            writer.Write(&animState.Type, sizeof(AnimationStateType));
+
+            u32 animationCount = animState.Animations.size();
+            writer.Write(&animationCount, sizeof(u32));
+
+            for (u32 i = 0; i < animationCount; i++)
+            {
+                UUID uuid = animState.Animations[i] ? animState.Animations[i]->GetUUID() : UUID(0);
+                writer.Write(&uuid, sizeof(UUID));
+                writer.Write(&animState.BlendPositions[i], sizeof(glm::vec2));
+                dependencies.push_back(uuid);
+            }
         }
 
-        return true;
+        const BakedPaletteSettings& bakedPaletteSettings = asset->m_BakedPaletteSettings;
+        writer.Write(&bakedPaletteSettings.Enabled, sizeof(bool));
+        writer.Write(&bakedPaletteSettings.SampleRate, sizeof(u32));
+        writer.Write(&bakedPaletteSettings.Interpolate, sizeof(bool));
+
+        writer.EndChunk();
+        SerializeDependencies(writer, dependencies);
+
+        return writer.Finalize();
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
     template<>
     static bool AssetSerializer::Serialize(const std::filesystem::path& filepath, Ref<Skeleton> asset)
     {
-        std::ofstream ofs(filepath, std::ios::out | std::ios::binary);
+        AssetFileWriter writer(filepath, GetCompression(AssetType::Skeleton));
 
-        if (!ofs)
+        if (!writer.IsValid())
             return false;
 
         std::filesystem::path absolutePath = std::filesystem::canonical(filepath);
@@ -660,76 +994,89 @@ namespace Atom
             AssetMetaData newMetaData = asset->m_MetaData;
             newMetaData.UUID = UUID();
             newMetaData.AssetFilepath = absolutePath;
-            SerializeMetaData(ofs, newMetaData);
+            SerializeMetaData(writer, newMetaData);
         }
         else
         {
             asset->m_MetaData.AssetFilepath = absolutePath;
             asset->SetAssetFlag(AssetFlags::Serialized);
-            SerializeMetaData(ofs, asset->m_MetaData);
+            SerializeMetaData(writer, asset->m_MetaData);
         }
 
+        writer.BeginChunk(AssetChunkType::Data);
         u32 boneCount = asset->m_Bones.size();
-        ofs.write((char*)&boneCount, sizeof(u32));
+        writer.Write(&boneCount, sizeof(u32));
 
         for (auto& bone : asset->m_Bones)
         {
-            ofs.write((char*)&bone.ID, sizeof(u32));
-            ofs.write((char*)&bone.ParentID, sizeof(u32));
-
-            u32 childrenCount = bone.ChildrenIDs.size();
-            ofs.write((char*)&childrenCount, sizeof(u32));
-            ofs.write((char*)bone.ChildrenIDs.data(), childrenCount * sizeof(u32));
-
-            ofs.write((char*)&bone.InverseBindTransform, sizeof(glm::mat4));
+            writer.Write(&bone.ID, sizeof(u32));
+            writer.Write(&bone.ParentID, sizeof(u32));
+            writer.Write(&bone.InverseBindTransform, sizeof(glm::mat4));
+            writer.Write(&bone.BoundsMin, sizeof(glm::vec3));
+            writer.Write(&bone.BoundsMax, sizeof(glm::vec3));
         }
 
-        return true;
+        writer.EndChunk();
+
+        return writer.Finalize();
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
     template<>
     Ref<Texture2D> AssetSerializer::Deserialize(const std::filesystem::path& filepath)
     {
-        std::ifstream ifs(filepath, std::ios::in | std::ios::binary);
+        AssetFileReader file(filepath);
 
-        if (!ifs)
+        if (!file.IsValid())
             return nullptr;
 
         AssetMetaData metaData;
-        metaData.AssetFilepath = std::filesystem::canonical(filepath);
-        DeserializeMetaData(ifs, metaData);
+        if (!DeserializeMetaData(file, metaData))
+            return nullptr;
+
         ATOM_ENGINE_ASSERT(metaData.Type == AssetType::Texture2D);
 
-        TextureFormat format;
-        u32 width, height, mipLevels;
-        TextureFilter filter;
-        TextureWrap wrap;
-        bool isCpuReadable, isGpuWritable;
-        Vector<Vector<byte>> pixelData;
+        Utils::TextureFileHeader header;
+        if (!file.GetChunk(AssetChunkType::TextureHeader).Read(header))
+            return nullptr;
 
-        ifs.read((char*)&format, sizeof(TextureFormat));
-        ifs.read((char*)&width, sizeof(u32));
-        ifs.read((char*)&height, sizeof(u32));
-        ifs.read((char*)&mipLevels, sizeof(u32));
-        ifs.read((char*)&filter, sizeof(TextureFilter));
-        ifs.read((char*)&wrap, sizeof(TextureWrap));
-        ifs.read((char*)&isCpuReadable, sizeof(bool));
-        ifs.read((char*)&isGpuWritable, sizeof(bool));
+        // Streamed textures are created with their mip tail only, the rest is loaded once the renderer needs it
+        u32 tailMip = 0;
+        if (TextureStreamer::IsEnabled() && !header.IsCpuReadable && !header.IsGpuWritable)
+            tailMip = TextureStreamer::GetTailMip(header.Width, header.Height, header.MipLevels);
 
-        pixelData.resize(mipLevels);
-        for (u32 mip = 0; mip < mipLevels; mip++)
-        {
-            u32 pixelDataSize;
-            ifs.read((char*)&pixelDataSize, sizeof(u32));
-            pixelData[mip].resize(pixelDataSize);
-            ifs.read((char*)pixelData[mip].data(), pixelDataSize);
-        }
+        Vector<PixelDataView> pixelData;
+        if (!Utils::DeserializeTextureSubresources(file, tailMip, header.MipLevels - tailMip, pixelData))
+            return nullptr;
 
-        Ref<Texture2D> asset = CreateRef<Texture2D>(width, height, format, mipLevels, isCpuReadable, isGpuWritable, pixelData);
+        u32 residentWidth = std::max(header.Width >> tailMip, 1u);
+        u32 residentHeight = std::max(header.Height >> tailMip, 1u);
+
+        Ref<Texture2D> asset = CreateRef<Texture2D>(residentWidth, residentHeight, (TextureFormat)header.Format, header.MipLevels - tailMip, header.IsCpuReadable, header.IsGpuWritable, pixelData);
         asset->m_MetaData = metaData;
-        asset->SetFilter(filter);
-        asset->SetWrap(wrap);
+        asset->m_MemorySize = file.GetUncompressedSize();
+        asset->m_Chunks = file.GetChunks();
+        asset->SetFilter((TextureFilter)header.Filter);
+        asset->SetWrap((TextureWrap)header.Wrap);
+
+        if (tailMip > 0)
+        {
+            asset->m_Description.Width = header.Width;
+            asset->m_Description.Height = header.Height;
+            asset->m_Description.MipLevels = header.MipLevels;
+            asset->m_ResidentMip = tailMip;
+
+            // The streamed mips are neither read nor decompressed here
+            Vector<u64> mipSizes(header.MipLevels, 0);
+
+            for (u32 mip = 0; mip < header.MipLevels; mip++)
+            {
+                if (const AssetChunkEntry* chunk = file.FindChunk(AssetChunkType::Subresource, mip))
+                    mipSizes[mip] = chunk->UncompressedSize;
+            }
+
+            TextureStreamer::RegisterTexture(asset, mipSizes, tailMip);
+        }
 
         return asset;
     }
@@ -738,49 +1085,31 @@ namespace Atom
     template<>
     Ref<TextureCube> AssetSerializer::Deserialize(const std::filesystem::path& filepath)
     {
-        std::ifstream ifs(filepath, std::ios::in | std::ios::binary);
+        AssetFileReader file(filepath);
 
-        if (!ifs)
+        if (!file.IsValid())
             return nullptr;
 
         AssetMetaData metaData;
-        metaData.AssetFilepath = std::filesystem::canonical(filepath);
-        DeserializeMetaData(ifs, metaData);
+        if (!DeserializeMetaData(file, metaData))
+            return nullptr;
+
         ATOM_ENGINE_ASSERT(metaData.Type == AssetType::TextureCube);
 
-        TextureFormat format;
-        u32 size, mipLevels;
-        TextureFilter filter;
-        TextureWrap wrap;
-        bool isCpuReadable, isGpuWritable;
-        Vector<Vector<byte>> pixelData;
+        Utils::TextureFileHeader header;
+        if (!file.GetChunk(AssetChunkType::TextureHeader).Read(header))
+            return nullptr;
 
-        ifs.read((char*)&format, sizeof(TextureFormat));
-        ifs.read((char*)&size, sizeof(u32));
-        ifs.read((char*)&mipLevels, sizeof(u32));
-        ifs.read((char*)&filter, sizeof(TextureFilter));
-        ifs.read((char*)&wrap, sizeof(TextureWrap));
-        ifs.read((char*)&isCpuReadable, sizeof(bool));
-        ifs.read((char*)&isGpuWritable, sizeof(bool));
+        Vector<PixelDataView> pixelData;
+        if (!Utils::DeserializeTextureSubresources(file, 0, header.MipLevels * 6, pixelData))
+            return nullptr;
 
-        pixelData.resize(mipLevels * 6);
-
-        for (u32 face = 0; face < 6; face++)
-        {
-            for (u32 mip = 0; mip < mipLevels; mip++)
-            {
-                u32 subresource = Texture::CalculateSubresource(mip, face, mipLevels, 6);
-                u32 pixelDataSize;
-                ifs.read((char*)&pixelDataSize, sizeof(u32));
-                pixelData[subresource].resize(pixelDataSize, 0);
-                ifs.read((char*)pixelData[subresource].data(), pixelDataSize);
-            }
-        }
-
-        Ref<TextureCube> asset = CreateRef<TextureCube>(size, format, mipLevels, isCpuReadable, isGpuWritable, pixelData);
-        asset->m_MetaData = metaData;
-        asset->SetFilter(filter);
-        asset->SetWrap(wrap);
+        Ref<TextureCube> asset = CreateRef<TextureCube>(header.Width, (TextureFormat)header.Format, header.MipLevels, header.IsCpuReadable, header.IsGpuWritable, pixelData);
+        asset->m_MetaData = metaData;
+        asset->m_MemorySize = file.GetUncompressedSize();
+        asset->m_Chunks = file.GetChunks();
+        asset->SetFilter((TextureFilter)header.Filter);
+        asset->SetWrap((TextureWrap)header.Wrap);
 
         return asset;
     }
@@ -789,51 +1118,76 @@ namespace Atom
     template<>
     Ref<Material> AssetSerializer::Deserialize(const std::filesystem::path& filepath)
     {
-        std::ifstream ifs(filepath, std::ios::in | std::ios::binary);
+        AssetFileReader file(filepath);
 
-        if (!ifs)
+        if (!file.IsValid())
             return nullptr;
 
         AssetMetaData metaData;
-        metaData.AssetFilepath = std::filesystem::canonical(filepath);
-        DeserializeMetaData(ifs, metaData);
+        if (!DeserializeMetaData(file, metaData))
+            return nullptr;
+
         ATOM_ENGINE_ASSERT(metaData.Type == AssetType::Material);
 
+        AssetChunkReader stream = file.GetChunk(AssetChunkType::Data);
+
+        if (!stream.IsValid())
+            return nullptr;
+
         // Deserialize shader name
         u32 shaderNameLength;
-        ifs.read((char*)&shaderNameLength, sizeof(u32));
+        stream.Read(&shaderNameLength, sizeof(u32));
 
         String shaderName(shaderNameLength, '\0');
-        ifs.read(shaderName.data(), shaderNameLength);
+        stream.Read(shaderName.data(), shaderNameLength);
 
         Ref<Material> asset = CreateRef<Material>(ShaderLibrary::Get().Get<GraphicsShader>(shaderName), MaterialFlags::None);
         asset->m_MetaData = metaData;
+        asset->m_MemorySize = file.GetUncompressedSize();
 
         // Deserialize flags
         MaterialFlags flags;
-        ifs.read((char*)&flags, sizeof(MaterialFlags));
+        stream.Read(&flags, sizeof(MaterialFlags));
         asset->SetFlags(flags);
 
         // Deserialize uniform buffers
-        ifs.read((char*)asset->GetConstantsData().data(), asset->GetConstantsData().size());
+        stream.Read(asset->m_ConstantsData.data(), asset->m_ConstantsData.size());
 
         // Deserialize textures
         u32 textureCount;
-        ifs.read((char*)&textureCount, sizeof(u32));
+        stream.Read(&textureCount, sizeof(u32));
 
         for (u32 i = 0; i < textureCount; i++)
         {
             u32 textureRegister;
-            ifs.read((char*)&textureRegister, sizeof(u32));
+            stream.Read(&textureRegister, sizeof(u32));
 
             UUID textureHandle;
-            ifs.read((char*)&textureHandle, sizeof(u64));
-            
-            Ref<TextureAsset> texture = textureHandle != 0 ? AssetManager::GetAsset<TextureAsset>(textureHandle, true) : nullptr;
-            if (texture)
+            stream.Read(&textureHandle, sizeof(u64));
+
+            if (textureHandle == 0)
+                continue;
+
+            // Textures stream in after the material which renders with a placeholder in the meantime
+            AssetLoadHandle textureLoadHandle = AssetManager::LoadAssetAsync(textureHandle);
+            Ref<TextureAsset> texture = AssetManager::GetAssetOrPlaceholder<TextureAsset>(textureLoadHandle);
+
+            if (!texture)
+                continue;
+
+            asset->m_Textures[textureRegister] = texture;
+
+            std::weak_ptr<Material> materialRef = asset;
+            textureLoadHandle.OnLoaded([materialRef, textureRegister, texture](const Ref<Asset>& loadedAsset)
             {
-                asset->m_Textures[textureRegister] = texture;
-            }
+                Ref<Material> material = materialRef.lock();
+
+                if (material && material->m_Textures[textureRegister] == texture)
+                {
+                    material->m_Textures[textureRegister] = std::dynamic_pointer_cast<TextureAsset>(loadedAsset);
+                    material->m_Dirty = true;
+                }
+            });
         }
 
         asset->UpdateForRendering();
@@ -845,67 +1199,87 @@ namespace Atom
     template<>
     Ref<Mesh> AssetSerializer::Deserialize(const std::filesystem::path& filepath)
     {
-        std::ifstream ifs(filepath, std::ios::in | std::ios::binary);
+        AssetFileReader file(filepath);
 
-        if (!ifs)
+        if (!file.IsValid())
             return nullptr;
 
         AssetMetaData metaData;
-        metaData.AssetFilepath = std::filesystem::canonical(filepath);
-        DeserializeMetaData(ifs, metaData);
-        ATOM_ENGINE_ASSERT(metaData.Type == AssetType::Mesh);
-
-        u32 vertexCount;
-        ifs.read((char*)&vertexCount, sizeof(u32));
-
-        MeshDescription meshDesc;
-
-        meshDesc.Positions.resize(vertexCount);
-        ifs.read((char*)meshDesc.Positions.data(), sizeof(glm::vec3) * vertexCount);
+        if (!DeserializeMetaData(file, metaData))
+            return nullptr;
 
-        meshDesc.UVs.resize(vertexCount);
-        ifs.read((char*)meshDesc.UVs.data(), sizeof(glm::vec2) * vertexCount);
+        ATOM_ENGINE_ASSERT(metaData.Type == AssetType::Mesh);
 
-        meshDesc.Normals.resize(vertexCount);
-        ifs.read((char*)meshDesc.Normals.data(), sizeof(glm::vec3) * vertexCount);
+        Utils::MeshFileHeader header;
+        if (!file.GetChunk(AssetChunkType::MeshHeader).Read(header))
+            return nullptr;
 
-        meshDesc.Tangents.resize(vertexCount);
-        ifs.read((char*)meshDesc.Tangents.data(), sizeof(glm::vec3) * vertexCount);
+        AssetChunkReader vertexChunk = file.GetChunk(AssetChunkType::VertexData);
+        AssetChunkReader indexChunk = file.GetChunk(AssetChunkType::IndexData);
+        AssetChunkReader submeshChunk = file.GetChunk(AssetChunkType::Submeshes);
+        AssetChunkReader materialChunk = file.GetChunk(AssetChunkType::Materials);
 
-        meshDesc.Bitangents.resize(vertexCount);
-        ifs.read((char*)meshDesc.Bitangents.data(), sizeof(glm::vec3) * vertexCount);
+        const byte* vertexData = vertexChunk.ReadView((u64)header.VertexCount * header.VertexStride);
+        const u32* indices = (const u32*)indexChunk.ReadView((u64)header.IndexCount * sizeof(u32));
 
-        meshDesc.BoneWeights.resize(vertexCount);
-        ifs.read((char*)meshDesc.BoneWeights.data(), sizeof(BoneWeight) * vertexCount);
+        Vector<Submesh> submeshes(header.SubmeshCount);
+        submeshChunk.Read(submeshes.data(), sizeof(Submesh) * header.SubmeshCount);
 
-        u32 indexCount;
-        ifs.read((char*)&indexCount, sizeof(u32));
+        Vector<UUID> materialUUIDs(header.SubmeshCount);
+        materialChunk.Read(materialUUIDs.data(), sizeof(u64) * header.SubmeshCount);
 
-        meshDesc.Indices.resize(indexCount);
-        ifs.read((char*)meshDesc.Indices.data(), sizeof(u32) * indexCount);
+        if (header.VertexStride != Mesh::GetVertexStride(header.IsAnimated) || !vertexChunk.IsValid() || !indexChunk.IsValid() || !submeshChunk.IsValid() || !materialChunk.IsValid())
+        {
+            ATOM_ERROR("Mesh file {} is corrupted", filepath);
+            return nullptr;
+        }
 
-        u32 submeshCount;
-        ifs.read((char*)&submeshCount, sizeof(u32));
+        Ref<MaterialTable> materialTable = CreateRef<MaterialTable>();
+        for (u32 submeshIdx = 0; submeshIdx < header.SubmeshCount; submeshIdx++)
+            materialTable->SetMaterial(submeshIdx, AssetManager::GetAsset<Material>(materialUUIDs[submeshIdx], true));
 
-        meshDesc.Submeshes.resize(submeshCount);
-        ifs.read((char*)meshDesc.Submeshes.data(), sizeof(Submesh) * submeshCount);
+        // The interleaved vertices and the indices are uploaded straight from the mapped file
+        Ref<Mesh> asset = CreateRef<Mesh>(vertexData, header.VertexCount, header.VertexStride, indices, header.IndexCount, submeshes, materialTable);
+        asset->m_MetaData = metaData;
+        asset->m_MemorySize = file.GetUncompressedSize();
+        asset->m_Chunks = file.GetChunks();
 
-        bool isReadable;
-        ifs.read((char*)&isReadable, sizeof(bool));
+        if (header.IsReadable)
+        {
+            AssetChunkReader streamChunk = file.GetChunk(AssetChunkType::VertexStreams);
+            auto readStream = [&streamChunk, &header](auto& stream)
+            {
+                using ElementType = typename std::decay_t<decltype(stream)>::value_type;
+                stream.resize(header.VertexCount);
+                streamChunk.Read(stream.data(), sizeof(ElementType) * header.VertexCount);
+            };
 
-        meshDesc.MaterialTable = CreateRef<MaterialTable>();
+            readStream(asset->m_Positions);
+            readStream(asset->m_UVs);
+            readStream(asset->m_Normals);
+            readStream(asset->m_Tangents);
+            readStream(asset->m_Bitangents);
 
-        for (u32 submeshIdx = 0; submeshIdx < submeshCount; submeshIdx++)
-        {
-            UUID materialUUID;
-            ifs.read((char*)&materialUUID, sizeof(u64));
+            if (header.IsAnimated)
+                readStream(asset->m_BoneWeights);
 
-            meshDesc.MaterialTable->SetMaterial(submeshIdx, AssetManager::GetAsset<Material>(materialUUID, true));
+            if (streamChunk.IsValid())
+            {
+                asset->m_Indices.assign(indices, indices + header.IndexCount);
+                asset->m_IsReadable = true;
+            }
+            else
+            {
+                ATOM_WARNING("Mesh file {} has no valid vertex streams. The mesh is loaded as non readable", filepath);
+                asset->m_Positions.clear();
+                asset->m_UVs.clear();
+                asset->m_Normals.clear();
+                asset->m_Tangents.clear();
+                asset->m_Bitangents.clear();
+                asset->m_BoneWeights.clear();
+            }
         }
 
-        Ref<Mesh> asset = CreateRef<Mesh>(meshDesc, isReadable);
-        asset->m_MetaData = metaData;
-
         return asset;
     }
 
@@ -913,298 +1287,351 @@ namespace Atom
     template<>
     Ref<Scene> AssetSerializer::Deserialize(const std::filesystem::path& filepath)
     {
-        std::ifstream ifs(filepath, std::ios::in | std::ios::binary);
+        AssetFileReader file(filepath);
 
-        if (!ifs)
+        if (!file.IsValid())
             return nullptr;
 
         AssetMetaData metaData;
-        metaData.AssetFilepath = std::filesystem::canonical(filepath);
-        DeserializeMetaData(ifs, metaData);
+        if (!DeserializeMetaData(file, metaData))
+            return nullptr;
+
         ATOM_ENGINE_ASSERT(metaData.Type == AssetType::Scene);
 
+        AssetChunkReader stream = file.GetChunk(AssetChunkType::Data);
+        AssetChunkReader entityStream = file.GetChunk(AssetChunkType::SceneEntities);
+
+        if (!stream.IsValid() || !entityStream.IsValid())
+            return nullptr;
+
         Ref<Scene> asset = CreateRef<Scene>();
         asset->m_MetaData = metaData;
+        asset->m_MemorySize = file.GetUncompressedSize();
+
+        entt::registry& registry = asset->m_Registry;
 
         u32 nameSize;
-        ifs.read((char*)&nameSize, sizeof(u32));
+        stream.Read(&nameSize, sizeof(u32));
 
         asset->m_Name.resize(nameSize);
-        ifs.read((char*)asset->m_Name.data(), nameSize);
-
-        u32 entityCount;
-        ifs.read((char*)&entityCount, sizeof(u32));
+        stream.Read(asset->m_Name.data(), nameSize);
 
-        for (u32 i = 0; i < entityCount; i++)
+        // Create all entities at once, the component pools are then inserted into the registry one by one
+        u32 entityCount = 0;
+        if (!entityStream.Read(entityCount) || entityCount > entityStream.GetRemainingSize() / sizeof(UUID))
         {
-            bool isValid;
-            ifs.read((char*)&isValid, sizeof(bool));
+            ATOM_ERROR("Scene file {} has a corrupted entity column", filepath);
+            return nullptr;
+        }
 
-            if (!isValid)
-                continue;
+        static_assert(sizeof(IDComponent) == sizeof(UUID));
+        Vector<IDComponent> ids(entityCount);
+        entityStream.Read(ids.data(), sizeof(UUID) * entityCount);
+
+        Vector<entt::entity> sceneEntities(entityCount);
+        registry.create(sceneEntities.begin(), sceneEntities.end());
+        registry.insert<IDComponent>(sceneEntities.begin(), sceneEntities.end(), ids.begin());
+
+        asset->m_EntitiesByID.reserve(entityCount);
 
-            UUID uuid;
-            ifs.read((char*)&uuid, sizeof(UUID));
+        for (u32 i = 0; i < entityCount; i++)
+            asset->m_EntitiesByID[ids[i].ID] = { sceneEntities[i], asset.get() };
 
-            Entity entity = asset->CreateEntityFromUUID(uuid);
+        AssetChunkReader pool;
+        Vector<entt::entity> entities;
 
-            bool hasTagComponent;
-            ifs.read((char*)&hasTagComponent, sizeof(bool));
+        if (!Utils::ReadComponentPool(file, Utils::SceneComponentPool::Tag, sceneEntities, pool, entities))
+            return nullptr;
 
-            if (hasTagComponent)
+        if (!entities.empty())
+        {
+            const u32* tagSizes = (const u32*)pool.ReadView(sizeof(u32) * entities.size());
+            Vector<TagComponent> tags(entities.size());
+
+            for (u32 i = 0; tagSizes && i < entities.size(); i++)
             {
-                auto& tc = entity.AddOrReplaceComponent<TagComponent>();
+                const byte* tag = pool.ReadView(tagSizes[i]);
 
-                u32 tagSize;
-                ifs.read((char*)&tagSize, sizeof(u32));
+                if (!tag)
+                    break;
 
-                tc.Tag.resize(tagSize);
-                ifs.read((char*)tc.Tag.data(), tagSize);
+                tags[i].Tag.assign((const char*)tag, tagSizes[i]);
             }
 
-            bool hasSceneHierarchyComponent;
-            ifs.read((char*)&hasSceneHierarchyComponent, sizeof(bool));
-
-            if (hasSceneHierarchyComponent)
+            if (!pool.IsValid())
             {
-                auto& shc = entity.AddOrReplaceComponent<SceneHierarchyComponent>();
-                ifs.read((char*)&shc, sizeof(SceneHierarchyComponent));
+                ATOM_ERROR("Scene file {} has corrupted tags", filepath);
+                return nullptr;
             }
 
-            bool hasTransformComponent;
-            ifs.read((char*)&hasTransformComponent, sizeof(bool));
+            registry.insert<TagComponent>(entities.begin(), entities.end(), tags.begin());
+        }
+
+        if (!Utils::DeserializeRawComponentPool<SceneHierarchyComponent>(file, Utils::SceneComponentPool::SceneHierarchy, registry, sceneEntities) ||
+            !Utils::DeserializeRawComponentPool<TransformComponent>(file, Utils::SceneComponentPool::Transform, registry, sceneEntities) ||
+            !Utils::DeserializeRawComponentPool<DirectionalLightComponent>(file, Utils::SceneComponentPool::DirectionalLight, registry, sceneEntities) ||
+            !Utils::DeserializeRawComponentPool<PointLightComponent>(file, Utils::SceneComponentPool::PointLight, registry, sceneEntities) ||
+            !Utils::DeserializeRawComponentPool<SpotLightComponent>(file, Utils::SceneComponentPool::SpotLight, registry, sceneEntities) ||
+            !Utils::DeserializeRawComponentPool<RigidbodyComponent>(file, Utils::SceneComponentPool::Rigidbody, registry, sceneEntities) ||
+            !Utils::DeserializeRawComponentPool<BoxColliderComponent>(file, Utils::SceneComponentPool::BoxCollider, registry, sceneEntities) ||
+            !Utils::DeserializeRawComponentPool<SphereColliderComponent>(file, Utils::SceneComponentPool::SphereCollider, registry, sceneEntities) ||
+            !Utils::DeserializeRawComponentPool<CapsuleColliderComponent>(file, Utils::SceneComponentPool::CapsuleCollider, registry, sceneEntities))
+        {
+            return nullptr;
+        }
+
+        if (!Utils::ReadComponentPool(file, Utils::SceneComponentPool::Camera, sceneEntities, pool, entities))
+            return nullptr;
+
+        if (!entities.empty())
+        {
+            const Utils::SerializedCamera* cameras = (const Utils::SerializedCamera*)pool.ReadView(sizeof(Utils::SerializedCamera) * entities.size());
 
-            if (hasTransformComponent)
+            if (!cameras)
             {
-                auto& tc = entity.AddOrReplaceComponent<TransformComponent>();
-                ifs.read((char*)&tc, sizeof(TransformComponent));
+                ATOM_ERROR("Scene file {} has corrupted cameras", filepath);
+                return nullptr;
             }
 
-            bool hasCameraComponent;
-            ifs.read((char*)&hasCameraComponent, sizeof(bool));
+            Vector<CameraComponent> cameraComponents(entities.size());
 
-            if (hasCameraComponent)
+            for (u32 i = 0; i < entities.size(); i++)
             {
-                auto& cc = entity.AddOrReplaceComponent<CameraComponent>();
-                ifs.read((char*)&cc, sizeof(CameraComponent));
+                auto& cc = cameraComponents[i];
+                cc.Camera.SetProjectionType((SceneCamera::ProjectionType)cameras[i].ProjectionType);
+                cc.Camera.SetPerspective(cameras[i].PerspectiveFOV, cameras[i].PerspectiveNear, cameras[i].PerspectiveFar);
+                cc.Camera.SetOrthographic(cameras[i].OrthographicSize, cameras[i].OrthographicNear, cameras[i].OrthographicFar);
+                cc.Primary = cameras[i].Primary;
+                cc.FixedAspectRatio = cameras[i].FixedAspectRatio;
             }
 
-            bool hasMeshComponent;
-            ifs.read((char*)&hasMeshComponent, sizeof(bool));
+            registry.insert<CameraComponent>(entities.begin(), entities.end(), cameraComponents.begin());
+        }
 
-            if (hasMeshComponent)
-            {
-                auto& mc = entity.AddOrReplaceComponent<MeshComponent>();
+        // Components referencing assets are inserted empty and get their assets once those are loaded
+        auto getEntityUUIDs = [&registry](const Vector<entt::entity>& entities)
+        {
+            Vector<UUID> entityUUIDs;
+            entityUUIDs.reserve(entities.size());
 
-                UUID uuid;
-                ifs.read((char*)&uuid, sizeof(UUID));
+            for (entt::entity entity : entities)
+                entityUUIDs.push_back(registry.get<IDComponent>(entity).ID);
 
-                mc.Mesh = AssetManager::GetAsset<Mesh>(uuid, true);
-            }
+            return entityUUIDs;
+        };
 
-            bool hasAnimatedMeshComponent;
-            ifs.read((char*)&hasAnimatedMeshComponent, sizeof(bool));
+        auto readAssetUUIDs = [&pool, &filepath](u32 count, Vector<UUID>& assetUUIDs)
+        {
+            assetUUIDs.resize(count);
 
-            if (hasAnimatedMeshComponent)
+            if (!pool.Read(assetUUIDs.data(), sizeof(UUID) * count))
             {
-                auto& amc = entity.AddOrReplaceComponent<AnimatedMeshComponent>();
+                ATOM_ERROR("Scene file {} has corrupted asset references", filepath);
+                return false;
+            }
 
-                UUID meshUUID;
-                ifs.read((char*)&meshUUID, sizeof(UUID));
+            return true;
+        };
 
-                UUID skeletonUUID;
-                ifs.read((char*)&skeletonUUID, sizeof(UUID));
+        if (!Utils::ReadComponentPool(file, Utils::SceneComponentPool::Mesh, sceneEntities, pool, entities))
+            return nullptr;
 
-                amc.Mesh = AssetManager::GetAsset<Mesh>(meshUUID, true);
-                amc.Skeleton = AssetManager::GetAsset<Skeleton>(skeletonUUID, true);
-            }
+        if (!entities.empty())
+        {
+            Vector<UUID> meshUUIDs;
+            if (!readAssetUUIDs(entities.size(), meshUUIDs))
+                return nullptr;
 
-            bool hasAnimatorComponent;
-            ifs.read((char*)&hasAnimatorComponent, sizeof(bool));
+            registry.insert<MeshComponent>(entities.begin(), entities.end());
 
-            if (hasAnimatorComponent)
+            Utils::LoadSceneAssetsAsync(asset, getEntityUUIDs(entities), meshUUIDs, [](Entity entity, const Ref<Asset>& loadedAsset)
             {
-                auto& ac = entity.AddOrReplaceComponent<AnimatorComponent>();
+                if (entity.HasComponent<MeshComponent>() && !entity.GetComponent<MeshComponent>().Mesh)
+                    entity.GetComponent<MeshComponent>().Mesh = std::dynamic_pointer_cast<Mesh>(loadedAsset);
+            });
+        }
+
+        if (!Utils::ReadComponentPool(file, Utils::SceneComponentPool::AnimatedMesh, sceneEntities, pool, entities))
+            return nullptr;
 
-                UUID animationControllerUUID;
-                ifs.read((char*)&animationControllerUUID, sizeof(UUID));
+        if (!entities.empty())
+        {
+            Vector<UUID> meshUUIDs;
+            Vector<UUID> skeletonUUIDs;
+            if (!readAssetUUIDs(entities.size(), meshUUIDs) || !readAssetUUIDs(entities.size(), skeletonUUIDs))
+                return nullptr;
 
-                ac.AnimationController = AssetManager::GetAsset<AnimationController>(animationControllerUUID, true);
+            registry.insert<AnimatedMeshComponent>(entities.begin(), entities.end());
 
-                ifs.read((char*)&ac.Play, sizeof(bool));
-            }
+            Vector<UUID> entityUUIDs = getEntityUUIDs(entities);
 
-            bool hasSkyLightComponent;
-            ifs.read((char*)&hasSkyLightComponent, sizeof(bool));
+            Utils::LoadSceneAssetsAsync(asset, entityUUIDs, meshUUIDs, [](Entity entity, const Ref<Asset>& loadedAsset)
+            {
+                if (entity.HasComponent<AnimatedMeshComponent>() && !entity.GetComponent<AnimatedMeshComponent>().Mesh)
+                    entity.GetComponent<AnimatedMeshComponent>().Mesh = std::dynamic_pointer_cast<Mesh>(loadedAsset);
+            });
 
-            if (hasSkyLightComponent)
+            Utils::LoadSceneAssetsAsync(asset, entityUUIDs, skeletonUUIDs, [](Entity entity, const Ref<Asset>& loadedAsset)
             {
-                auto& slc = entity.AddOrReplaceComponent<SkyLightComponent>();
+                if (entity.HasComponent<AnimatedMeshComponent>() && !entity.GetComponent<AnimatedMeshComponent>().Skeleton)
+                    entity.GetComponent<AnimatedMeshComponent>().Skeleton = std::dynamic_pointer_cast<Skeleton>(loadedAsset);
+            });
+        }
 
-                UUID uuid;
-                ifs.read((char*)&uuid, sizeof(UUID));
+        if (!Utils::ReadComponentPool(file, Utils::SceneComponentPool::Animator, sceneEntities, pool, entities))
+            return nullptr;
 
-                slc.EnvironmentMap = AssetManager::GetAsset<TextureCube>(uuid, true);
-                slc.IrradianceMap = slc.EnvironmentMap ? Renderer::CreateIrradianceMap(slc.EnvironmentMap->GetResource(), 32, "") : nullptr;
-            }
+        if (!entities.empty())
+        {
+            Vector<UUID> animationControllerUUIDs;
+            if (!readAssetUUIDs(entities.size(), animationControllerUUIDs))
+                return nullptr;
 
-            bool hasDirectionalLightComponent;
-            ifs.read((char*)&hasDirectionalLightComponent, sizeof(bool));
+            const u8* play = pool.ReadView(sizeof(u8) * entities.size());
 
-            if (hasDirectionalLightComponent)
+            if (!play)
             {
-                auto& dlc = entity.AddOrReplaceComponent<DirectionalLightComponent>();
-                ifs.read((char*)&dlc, sizeof(DirectionalLightComponent));
+                ATOM_ERROR("Scene file {} has corrupted animators", filepath);
+                return nullptr;
             }
 
-            bool hasPointLightComponent;
-            ifs.read((char*)&hasPointLightComponent, sizeof(bool));
+            Vector<AnimatorComponent> animators(entities.size());
 
-            if (hasPointLightComponent)
-            {
-                auto& plc = entity.AddOrReplaceComponent<PointLightComponent>();
-                ifs.read((char*)&plc, sizeof(PointLightComponent));
-            }
+            for (u32 i = 0; i < entities.size(); i++)
+                animators[i].Play = play[i];
 
-            bool hasSpotLightComponent;
-            ifs.read((char*)&hasSpotLightComponent, sizeof(bool));
+            registry.insert<AnimatorComponent>(entities.begin(), entities.end(), animators.begin());
 
-            if (hasSpotLightComponent)
+            Utils::LoadSceneAssetsAsync(asset, getEntityUUIDs(entities), animationControllerUUIDs, [](Entity entity, const Ref<Asset>& loadedAsset)
             {
-                auto& slc = entity.AddOrReplaceComponent<SpotLightComponent>();
-                ifs.read((char*)&slc, sizeof(SpotLightComponent));
-            }
+                if (entity.HasComponent<AnimatorComponent>() && !entity.GetComponent<AnimatorComponent>().AnimationController)
+                    entity.GetComponent<AnimatorComponent>().AnimationController = std::dynamic_pointer_cast<AnimationController>(loadedAsset);
+            });
+        }
 
-            bool hasScriptComponent;
-            ifs.read((char*)&hasScriptComponent, sizeof(bool));
+        if (!Utils::ReadComponentPool(file, Utils::SceneComponentPool::SkyLight, sceneEntities, pool, entities))
+            return nullptr;
 
-            if (hasScriptComponent)
+        if (!entities.empty())
+        {
+            Vector<UUID> environmentMapUUIDs;
+            if (!readAssetUUIDs(entities.size(), environmentMapUUIDs))
+                return nullptr;
+
+            registry.insert<SkyLightComponent>(entities.begin(), entities.end());
+
+            // The irradiance map is generated on the main thread once the environment map is there
+            Utils::LoadSceneAssetsAsync(asset, getEntityUUIDs(entities), environmentMapUUIDs, [](Entity entity, const Ref<Asset>& loadedAsset)
             {
-                auto& sc = entity.AddOrReplaceComponent<ScriptComponent>();
+                if (entity.HasComponent<SkyLightComponent>() && !entity.GetComponent<SkyLightComponent>().EnvironmentMap)
+                {
+                    auto& slc = entity.GetComponent<SkyLightComponent>();
+                    slc.EnvironmentMap = std::dynamic_pointer_cast<TextureCube>(loadedAsset);
+                    slc.IrradianceMap = slc.EnvironmentMap ? Renderer::CreateIrradianceMap(slc.EnvironmentMap->GetResource(), 32, "") : nullptr;
+                }
+            });
+        }
 
-                u32 scriptClassSize;
-                ifs.read((char*)&scriptClassSize, sizeof(u32));
+        if (!Utils::ReadComponentPool(file, Utils::SceneComponentPool::Script, sceneEntities, pool, entities))
+            return nullptr;
 
-                sc.ScriptClass.resize(scriptClassSize);
-                ifs.read((char*)sc.ScriptClass.data(), scriptClassSize);
+        if (!entities.empty())
+        {
+            Vector<ScriptComponent> scripts(entities.size());
 
-                if (Ref<ScriptClass> scriptClass = ScriptEngine::GetScriptClass(sc.ScriptClass))
-                {
-                    ScriptVariableMap& scriptInstanceVarMap = ScriptEngine::GetScriptVariableMap(entity);
+            for (u32 i = 0; i < entities.size() && pool.IsValid(); i++)
+            {
+                ScriptComponent& sc = scripts[i];
 
-                    u32 scriptVariableCount;
-                    ifs.read((char*)&scriptVariableCount, sizeof(u32));
+                u32 scriptVariableCount = 0;
+                if (!Utils::ReadString(pool, sc.ScriptClass) || !pool.Read(scriptVariableCount))
+                    break;
 
-                    for (u32 i = 0; i < scriptVariableCount; i++)
-                    {
-                        u32 varNameSize;
-                        ifs.read((char*)&varNameSize, sizeof(u32));
+                // Variables of scripts whose class no longer exists are skipped
+                ScriptVariableMap* scriptInstanceVarMap = nullptr;
+                if (ScriptEngine::GetScriptClass(sc.ScriptClass))
+                    scriptInstanceVarMap = &ScriptEngine::GetScriptVariableMap({ entities[i], asset.get() });
 
-                        String varName(varNameSize, '\0');
-                        ifs.read((char*)varName.data(), varNameSize);
+                for (u32 j = 0; j < scriptVariableCount; j++)
+                {
+                    String varName;
+                    if (!Utils::ReadString(pool, varName))
+                        break;
 
-                        ScriptVariableType type;
-                        ifs.read((char*)&type, sizeof(ScriptVariableType));
+                    ScriptVariableType type;
+                    pool.Read(&type, sizeof(ScriptVariableType));
 
-                        ScriptVariable variable(varName, type);
+                    ScriptVariable variable(varName, type);
 
-                        switch (type)
+                    switch (type)
+                    {
+                        case ScriptVariableType::Int:
                         {
-                            case ScriptVariableType::Int:
-                            {
-                                s32 value;
-                                ifs.read((char*)&value, sizeof(s32));
-                                variable.SetValue(value);
-                                break;
-                            }
-                            case ScriptVariableType::Float:
-                            {
-                                f32 value;
-                                ifs.read((char*)&value, sizeof(f32));
-                                variable.SetValue(value);
-                                break;
-                            }
-                            case ScriptVariableType::Bool:
-                            {
-                                bool value;
-                                ifs.read((char*)&value, sizeof(bool));
-                                variable.SetValue(value);
-                                break;
-                            }
-                            case ScriptVariableType::Vec2:
-                            {
-                                glm::vec2 value;
-                                ifs.read((char*)&value, sizeof(glm::vec2));
-                                variable.SetValue(value);
-                                break;
-                            }
-                            case ScriptVariableType::Vec3:
-                            {
-                                glm::vec3 value;
-                                ifs.read((char*)&value, sizeof(glm::vec3));
-                                variable.SetValue(value);
-                                break;
-                            }
-                            case ScriptVariableType::Vec4:
-                            {
-                                glm::vec4 value;
-                                ifs.read((char*)&value, sizeof(glm::vec4));
-                                variable.SetValue(value);
-                                break;
-                            }
-                            case ScriptVariableType::Entity:
-                            case ScriptVariableType::Material:
-                            case ScriptVariableType::Mesh:
-                            case ScriptVariableType::Texture2D:
-                            case ScriptVariableType::TextureCube:
-                            {
-                                UUID value;
-                                ifs.read((char*)&value, sizeof(UUID));
-                                variable.SetValue(value);
-                                break;
-                            }
+                            s32 value;
+                            pool.Read(&value, sizeof(s32));
+                            variable.SetValue(value);
+                            break;
+                        }
+                        case ScriptVariableType::Float:
+                        {
+                            f32 value;
+                            pool.Read(&value, sizeof(f32));
+                            variable.SetValue(value);
+                            break;
+                        }
+                        case ScriptVariableType::Bool:
+                        {
+                            bool value;
+                            pool.Read(&value, sizeof(bool));
+                            variable.SetValue(value);
+                            break;
+                        }
+                        case ScriptVariableType::Vec2:
+                        {
+                            glm::vec2 value;
+                            pool.Read(&value, sizeof(glm::vec2));
+                            variable.SetValue(value);
+                            break;
+                        }
+                        case ScriptVariableType::Vec3:
+                        {
+                            glm::vec3 value;
+                            pool.Read(&value, sizeof(glm::vec3));
+                            variable.SetValue(value);
+                            break;
+                        }
+                        case ScriptVariableType::Vec4:
+                        {
+                            glm::vec4 value;
+                            pool.Read(&value, sizeof(glm::vec4));
+                            variable.SetValue(value);
+                            break;
+                        }
+                        case ScriptVariableType::Entity:
+                        case ScriptVariableType::Material:
+                        case ScriptVariableType::Mesh:
+                        case ScriptVariableType::Texture2D:
+                        case ScriptVariableType::TextureCube:
+                        {
+                            UUID value;
+                            pool.Read(&value, sizeof(UUID));
+                            variable.SetValue(value);
+                            break;
                         }
-
-                        scriptInstanceVarMap[varName] = variable;
                     }
-                }
-            }
-
-            bool hasRigidbodyComponent;
-            ifs.read((char*)&hasRigidbodyComponent, sizeof(bool));
-
-            if (hasRigidbodyComponent)
-            {
-                auto& rbc = entity.AddOrReplaceComponent<RigidbodyComponent>();
-                ifs.read((char*)&rbc, sizeof(RigidbodyComponent));
-            }
 
-            bool hasBoxColliderComponent;
-            ifs.read((char*)&hasBoxColliderComponent, sizeof(bool));
-
-            if (hasBoxColliderComponent)
-            {
-                auto& bcc = entity.AddOrReplaceComponent<BoxColliderComponent>();
-                ifs.read((char*)&bcc, sizeof(BoxColliderComponent));
+                    if (scriptInstanceVarMap)
+                        (*scriptInstanceVarMap)[varName] = variable;
+                }
             }
 
-            bool hasSphereColliderComponent;
-            ifs.read((char*)&hasSphereColliderComponent, sizeof(bool));
-
-            if (hasSphereColliderComponent)
+            if (!pool.IsValid())
             {
-                auto& scc = entity.AddOrReplaceComponent<SphereColliderComponent>();
-                ifs.read((char*)&scc, sizeof(SphereColliderComponent));
+                ATOM_ERROR("Scene file {} has corrupted scripts", filepath);
+                return nullptr;
             }
 
-            bool hasCapsuleColliderComponent;
-            ifs.read((char*)&hasCapsuleColliderComponent, sizeof(bool));
-            
-            if (hasCapsuleColliderComponent)
-            {
-                auto& ccc = entity.AddOrReplaceComponent<CapsuleColliderComponent>();
-                ifs.read((char*)&ccc, sizeof(CapsuleColliderComponent));
-            }
+            registry.insert<ScriptComponent>(entities.begin(), entities.end(), scripts.begin());
         }
 
         return asset;
@@ -1214,52 +1641,107 @@ namespace Atom
     template<>
     Ref<Animation> AssetSerializer::Deserialize(const std::filesystem::path& filepath)
     {
-        std::ifstream ifs(filepath, std::ios::in | std::ios::binary);
+        AssetFileReader file(filepath);
 
-        if (!ifs)
+        if (!file.IsValid())
             return nullptr;
 
         AssetMetaData metaData;
-        metaData.AssetFilepath = std::filesystem::canonical(filepath);
-        DeserializeMetaData(ifs, metaData);
+        if (!DeserializeMetaData(file, metaData))
+            return nullptr;
+
         ATOM_ENGINE_ASSERT(metaData.Type == AssetType::Animation);
 
+        AssetChunkReader stream = file.GetChunk(AssetChunkType::Data);
+
+        if (!stream.IsValid())
+            return nullptr;
+
         f32 duration;
-        ifs.read((char*)&duration, sizeof(f32));
+        stream.Read(&duration, sizeof(f32));
 
         f32 ticksPerSecond;
-        ifs.read((char*)&ticksPerSecond, sizeof(f32));
+        stream.Read(&ticksPerSecond, sizeof(f32));
 
-        u32 keyFrameCount;
-        ifs.read((char*)&keyFrameCount, sizeof(u32));
+        bool isQuantized;
+        stream.Read(&isQuantized, sizeof(bool));
 
-        Set<Animation::KeyFrame> keyFrames;
+        u32 trackCount;
+        stream.Read(&trackCount, sizeof(u32));
 
-        for (u32 keyFrameIdx = 0; keyFrameIdx < keyFrameCount; keyFrameIdx++)
-        {
-            Animation::KeyFrame keyFrame;
-            ifs.read((char*)&keyFrame.TimeStamp, sizeof(f32));
+        Ref<Animation> asset = nullptr;
 
-            u32 boneCount;
-            ifs.read((char*)&boneCount, sizeof(u32));
-            keyFrame.BoneTransforms.reserve(boneCount);
+        if (isQuantized)
+        {
+            Vector<Animation::CompressedBoneTrack> tracks(trackCount);
 
-            for (u32 boneIdx = 0; boneIdx < boneCount; boneIdx++)
+            for (auto& track : tracks)
             {
-                u32 boneID;
-                ifs.read((char*)&boneID, sizeof(u32));
+                stream.Read(&track.BoneID, sizeof(u32));
+
+                u32 positionKeyCount;
+                stream.Read(&positionKeyCount, sizeof(u32));
+                track.PositionTimeStamps.resize(positionKeyCount);
+                track.Positions.resize(positionKeyCount);
+                stream.Read(track.PositionTimeStamps.data(), sizeof(f32) * positionKeyCount);
+                stream.Read(track.Positions.data(), sizeof(Animation::QuantizedVec3) * positionKeyCount);
+                stream.Read(&track.PositionRangeMin, sizeof(glm::vec3));
+                stream.Read(&track.PositionRangeExtent, sizeof(glm::vec3));
+
+                u32 rotationKeyCount;
+                stream.Read(&rotationKeyCount, sizeof(u32));
+                track.RotationTimeStamps.resize(rotationKeyCount);
+                track.Rotations.resize(rotationKeyCount);
+                stream.Read(track.RotationTimeStamps.data(), sizeof(f32) * rotationKeyCount);
+                stream.Read(track.Rotations.data(), sizeof(Animation::QuantizedQuat) * rotationKeyCount);
+
+                u32 scaleKeyCount;
+                stream.Read(&scaleKeyCount, sizeof(u32));
+                track.ScaleTimeStamps.resize(scaleKeyCount);
+                track.Scales.resize(scaleKeyCount);
+                stream.Read(track.ScaleTimeStamps.data(), sizeof(f32) * scaleKeyCount);
+                stream.Read(track.Scales.data(), sizeof(Animation::QuantizedVec3) * scaleKeyCount);
+                stream.Read(&track.ScaleRangeMin, sizeof(glm::vec3));
+                stream.Read(&track.ScaleRangeExtent, sizeof(glm::vec3));
+            }
 
-                Animation::BoneTransform boneTransform;
-                ifs.read((char*)&boneTransform, sizeof(Animation::BoneTransform));
+            asset = CreateRef<Animation>(duration, ticksPerSecond, tracks);
+        }
+        else
+        {
+            Vector<Animation::BoneTrack> tracks(trackCount);
 
-                keyFrame.BoneTransforms[boneID] = boneTransform;
+            for (auto& track : tracks)
+            {
+                stream.Read(&track.BoneID, sizeof(u32));
+
+                u32 positionKeyCount;
+                stream.Read(&positionKeyCount, sizeof(u32));
+                track.PositionTimeStamps.resize(positionKeyCount);
+                track.Positions.resize(positionKeyCount);
+                stream.Read(track.PositionTimeStamps.data(), sizeof(f32) * positionKeyCount);
+                stream.Read(track.Positions.data(), sizeof(glm::vec3) * positionKeyCount);
+
+                u32 rotationKeyCount;
+                stream.Read(&rotationKeyCount, sizeof(u32));
+                track.RotationTimeStamps.resize(rotationKeyCount);
+                track.Rotations.resize(rotationKeyCount);
+                stream.Read(track.RotationTimeStamps.data(), sizeof(f32) * rotationKeyCount);
+                stream.Read(track.Rotations.data(), sizeof(glm::quat) * rotationKeyCount);
+
+                u32 scaleKeyCount;
+                stream.Read(&scaleKeyCount, sizeof(u32));
+                track.ScaleTimeStamps.resize(scaleKeyCount);
+                track.Scales.resize(scaleKeyCount);
+                stream.Read(track.ScaleTimeStamps.data(), sizeof(f32) * scaleKeyCount);
+                stream.Read(track.Scales.data(), sizeof(glm::vec3) * scaleKeyCount);
             }
 
-            keyFrames.insert(keyFrame);
+            asset = CreateRef<Animation>(duration, ticksPerSecond, tracks, false);
         }
 
-        Ref<Animation> asset = CreateRef<Animation>(duration, ticksPerSecond, keyFrames);
         asset->m_MetaData = metaData;
+        asset->m_MemorySize = file.GetUncompressedSize();
 
         return asset;
     }
@@ -1268,34 +1750,58 @@ namespace Atom
     template<>
     Ref<AnimationController> AssetSerializer::Deserialize(const std::filesystem::path& filepath)
     {
-        std::ifstream ifs(filepath, std::ios::in | std::ios::binary);
+        AssetFileReader file(filepath);
 
-        if (!ifs)
+        if (!file.IsValid())
             return nullptr;
 
         AssetMetaData metaData;
-        metaData.AssetFilepath = std::filesystem::canonical(filepath);
-        DeserializeMetaData(ifs, metaData);
+        if (!DeserializeMetaData(file, metaData))
+            return nullptr;
+
         ATOM_ENGINE_ASSERT(metaData.Type == AssetType::AnimationController);
 
+        AssetChunkReader stream = file.GetChunk(AssetChunkType::Data);
+
+        if (!stream.IsValid())
+            return nullptr;
+
         u16 initialStateIdx;
-        ifs.read((char*)&initialStateIdx, sizeof(u16));
+        stream.Read(&initialStateIdx, sizeof(u16));
 
         u32 animationStatesCount;
-        ifs.read((char*)&animationStatesCount, sizeof(u32));
+        stream.Read(&animationStatesCount, sizeof(u32));
 
-        Vector<Ref<Animation>> animationStates;
-        animationStates.reserve(animationStatesCount);
+        Vector<AnimationState> animationStates(animationStatesCount);
 
-        for (u32 i = 0 ; i < animationStatesCount; i++)
+        for (auto& animState : animationStates)
         {
-            UUID uuid;
-            ifs.read((char*)&uuid, sizeof(UUID));
-            animationStates.push_back(AssetManager::GetAsset<Animation>(uuid, true));
+            stream.Read(&animState.Type, sizeof(AnimationStateType));
+
+            u32 animationCount;
+            stream.Read(&animationCount, sizeof(u32));
+
+            animState.Animations.resize(animationCount);
+            animState.BlendPositions.resize(animationCount);
+
+            for (u32 i = 0; i < animationCount; i++)
+            {
+                UUID uuid;
+                stream.Read(&uuid, sizeof(UUID));
+                stream.Read(&animState.BlendPositions[i], sizeof(glm::vec2));
+                animState.Animations[i] = AssetManager::GetAsset<Animation>(uuid, true);
+            }
         }
 
+        BakedPaletteSettings bakedPaletteSettings;
+        stream.Read(&bakedPaletteSettings.Enabled, sizeof(bool));
+        stream.Read(&bakedPaletteSettings.SampleRate, sizeof(u32));
+        stream.Read(&bakedPaletteSettings.Interpolate, sizeof(bool));
+
         Ref<AnimationController> asset = CreateRef<AnimationController>(animationStates, initialStateIdx);
         asset->m_MetaData = metaData;
+        asset->m_MemorySize = file.GetUncompressedSize();
+        asset->m_BakedPaletteSettings = bakedPaletteSettings;
 
         return asset;
     }
@@ -1304,18 +1810,24 @@ namespace Atom
     template<>
     Ref<Skeleton> AssetSerializer::Deserialize(const std::filesystem::path& filepath)
     {
-        std::ifstream ifs(filepath, std::ios::in | std::ios::binary);
+        AssetFileReader file(filepath);
 
-        if (!ifs)
+        if (!file.IsValid())
             return nullptr;
 
         AssetMetaData metaData;
-        metaData.AssetFilepath = std::filesystem::canonical(filepath);
-        DeserializeMetaData(ifs, metaData);
+        if (!DeserializeMetaData(file, metaData))
+            return nullptr;
+
         ATOM_ENGINE_ASSERT(metaData.Type == AssetType::Skeleton);
 
+        AssetChunkReader stream = file.GetChunk(AssetChunkType::Data);
+
+        if (!stream.IsValid())
+            return nullptr;
+
         u32 boneCount;
-        ifs.read((char*)&boneCount, sizeof(u32));
+        stream.Read(&boneCount, sizeof(u32));
 
         Vector<Skeleton::Bone> bones;
         bones.reserve(boneCount);
@@ -1323,62 +1835,316 @@ namespace Atom
         for (u32 i = 0; i < boneCount; i++)
         {
             Skeleton::Bone& bone = bones.emplace_back();
-            ifs.read((char*)&bone.ID, sizeof(u32));
-            ifs.read((char*)&bone.ParentID, sizeof(u32));
-
-            u32 childrenCount = bone.ChildrenIDs.size();
-            ifs.read((char*)&childrenCount, sizeof(u32));
+            stream.Read(&bone.ID, sizeof(u32));
+            stream.Read(&bone.ParentID, sizeof(u32));
+            stream.Read(&bone.InverseBindTransform, sizeof(glm::mat4));
+            stream.Read(&bone.BoundsMin, sizeof(glm::vec3));
+            stream.Read(&bone.BoundsMax, sizeof(glm::vec3));
 
-            bone.ChildrenIDs.resize(childrenCount);
-            ifs.read((char*)bone.ChildrenIDs.data(), childrenCount * sizeof(u32));
-
-            ifs.read((char*)&bone.InverseBindTransform, sizeof(glm::mat4));
+            if (bone.ID != i || (bone.ParentID != UINT32_MAX && bone.ParentID >= i))
+            {
+                ATOM_ERROR("Skeleton file \"{}\" does not store its bones parent before child. Reimport the mesh the skeleton was created from", filepath);
+                return nullptr;
+            }
         }
 
         Ref<Skeleton> asset = CreateRef<Skeleton>(bones);
         asset->m_MetaData = metaData;
+        asset->m_MemorySize = file.GetUncompressedSize();
 
         return asset;
     }
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetSerializer::SerializeTextureSubresources(AssetFileWriter& writer, const Ref<TextureAsset>& asset, u32 arraySize, const Vector<Vector<byte>>& nonResidentMips)
+    {
+        // Every subresource is a separate chunk so that single mips can be read without touching the rest of the file
+        for (u32 slice = 0; slice < arraySize; slice++)
+        {
+            for (u32 mip = 0; mip < asset->GetMipLevels(); mip++)
+            {
+                u32 subresource = Texture::CalculateSubresource(mip, slice, asset->GetMipLevels(), arraySize);
+
+                if (mip < asset->m_ResidentMip)
+                {
+                    const Vector<byte>& pixels = nonResidentMips[mip];
+                    writer.WriteChunk(AssetChunkType::Subresource, subresource, pixels.data(), pixels.size());
+                }
+                else if (asset->m_CpuReadable)
+                {
+                    const Vector<byte>& pixels = asset->m_PixelData[subresource];
+                    writer.WriteChunk(AssetChunkType::Subresource, subresource, pixels.data(), pixels.size());
+                }
+                else
+                {
+                    // The resource of a streamed texture starts at the first resident mip
+                    Ref<ReadbackBuffer> buffer = Renderer::ReadbackTextureData(asset->GetResource(), mip - asset->m_ResidentMip, slice);
+                    void* mappedData = buffer->Map(0, 0);
+                    writer.WriteChunk(AssetChunkType::Subresource, subresource, mappedData, buffer->GetSize());
+                    buffer->Unmap();
+                }
+            }
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetSerializer::SetCompression(AssetType type, AssetCompression compression)
+    {
+        ms_Compression[(u32)type] = compression;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    AssetCompression AssetSerializer::GetCompression(AssetType type)
+    {
+        return ms_Compression[(u32)type];
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    u32 AssetSerializer::GetDataVersion(AssetType type)
+    {
+        return Utils::AssetDataVersions[(u32)type];
+    }
+
     // -----------------------------------------------------------------------------------------------------------------------------
     bool AssetSerializer::DeserializeMetaData(const std::filesystem::path& filepath, AssetMetaData& assetMetaData)
     {
-        std::ifstream ifs(filepath, std::ios::in | std::ios::binary);
+        // Only the header, the table of contents and the metadata chunk are touched
+        AssetFileReader file(filepath);
+
+        if (!file.IsValid())
+            return false;
+
+        return DeserializeMetaData(file, assetMetaData);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool AssetSerializer::DeserializeDependencies(const std::filesystem::path& filepath, Vector<UUID>& dependencies)
+    {
+        AssetFileReader file(filepath);
+
+        if (!file.IsValid())
+            return false;
+
+        AssetMetaData metaData;
+        if (!DeserializeMetaData(file, metaData))
+            return false;
 
-        if (!ifs)
+        dependencies.clear();
+
+        // Only asset types that reference other assets have a dependencies chunk
+        if (!file.FindChunk(AssetChunkType::Dependencies))
+            return true;
+
+        AssetChunkReader stream = file.GetChunk(AssetChunkType::Dependencies);
+
+        u32 dependencyCount = 0;
+        if (!stream.Read(dependencyCount) || dependencyCount > stream.GetRemainingSize() / sizeof(UUID))
+        {
+            ATOM_ERROR("Asset file {} has invalid dependencies", filepath);
             return false;
+        }
 
-        DeserializeMetaData(ifs, assetMetaData);
-        assetMetaData.AssetFilepath = std::filesystem::canonical(filepath);
+        dependencies.resize(dependencyCount);
+        stream.Read(dependencies.data(), sizeof(UUID) * dependencyCount);
 
         return true;
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    void AssetSerializer::SerializeMetaData(std::ofstream& stream, const AssetMetaData& metaData)
+    bool AssetSerializer::DeserializeChangedChunks(const Ref<Asset>& asset, const std::filesystem::path& filepath, u32& changedChunkCount)
     {
+        // Only assets that store their bulk data in separate chunks keep the table of contents they were read from
+        if (asset->m_Chunks.empty())
+            return false;
+
+        AssetFileReader file(filepath);
+
+        if (!file.IsValid() || file.GetChunks().size() != asset->m_Chunks.size())
+            return false;
 
+        Vector<const AssetChunkEntry*> changedChunks;
+
+        for (const AssetChunkEntry& chunk : file.GetChunks())
+        {
+            auto it = std::find_if(asset->m_Chunks.begin(), asset->m_Chunks.end(), [&chunk](const AssetChunkEntry& loadedChunk)
+            {
+                return loadedChunk.Type == chunk.Type && loadedChunk.Index == chunk.Index;
+            });
+
+            // Added or resized chunks change the layout of the asset
+            if (it == asset->m_Chunks.end() || it->UncompressedSize != chunk.UncompressedSize)
+                return false;
+
+            if (it->Hash != chunk.Hash)
+                changedChunks.push_back(&chunk);
+        }
+
+        // All changed chunks are read before any of them is applied, so a chunk that can't be applied leaves the asset untouched
+        AssetMetaData metaData = asset->m_MetaData;
+        Utils::TextureFileHeader textureHeader;
+        bool isTextureHeaderChanged = false;
+        Vector<UUID> materialUUIDs;
+        Vector<std::pair<u32, PixelDataView>> subresources;
+
+        Ref<TextureAsset> texture = std::dynamic_pointer_cast<TextureAsset>(asset);
+        Ref<Mesh> mesh = std::dynamic_pointer_cast<Mesh>(asset);
+
+        for (const AssetChunkEntry* chunk : changedChunks)
+        {
+            switch (chunk->Type)
+            {
+                case AssetChunkType::MetaData:
+                {
+                    if (!DeserializeMetaData(file, metaData) || metaData.UUID != asset->GetUUID() || metaData.Type != asset->GetAssetType())
+                        return false;
+
+                    break;
+                }
+                case AssetChunkType::Dependencies:
+                {
+                    // The asset manager reads the dependencies again the next time they are queried
+                    break;
+                }
+                case AssetChunkType::TextureHeader:
+                {
+                    // Only the sampler settings can change without recreating the texture
+                    if (!texture || !file.GetChunk(AssetChunkType::TextureHeader).Read(textureHeader))
+                        return false;
+
+                    if ((TextureFormat)textureHeader.Format != texture->GetFormat() || textureHeader.Width != texture->GetWidth() || textureHeader.Height != texture->GetHeight() ||
+                        textureHeader.MipLevels != texture->GetMipLevels() || (bool)textureHeader.IsCpuReadable != texture->m_CpuReadable || (bool)textureHeader.IsGpuWritable != texture->IsGpuWritable())
+                        return false;
+
+                    isTextureHeaderChanged = true;
+                    break;
+                }
+                case AssetChunkType::Subresource:
+                {
+                    // Streamed textures read their mips from the file on demand, so they are deserialized again
+                    if (!texture || texture->m_ResidentMip > 0 || texture->m_StreamingID != UINT32_MAX)
+                        return false;
+
+                    AssetChunkReader stream = file.GetChunk(AssetChunkType::Subresource, chunk->Index);
+
+                    if (!stream.IsValid())
+                        return false;
+
+                    subresources.push_back({ chunk->Index, { stream.GetData(), (u32)stream.GetSize() } });
+                    break;
+                }
+                case AssetChunkType::Materials:
+                {
+                    if (!mesh)
+                        return false;
+
+                    materialUUIDs.resize(mesh->GetSubmeshes().size());
+
+                    if (!file.GetChunk(AssetChunkType::Materials).Read(materialUUIDs.data(), sizeof(u64) * materialUUIDs.size()))
+                        return false;
+
+                    break;
+                }
+                default:
+                {
+                    return false;
+                }
+            }
+        }
+
+        asset->m_MetaData = metaData;
+        asset->m_Chunks = file.GetChunks();
+
+        if (isTextureHeaderChanged)
+        {
+            texture->SetFilter((TextureFilter)textureHeader.Filter);
+            texture->SetWrap((TextureWrap)textureHeader.Wrap);
+        }
+
+        for (const auto& [subresource, pixels] : subresources)
+        {
+            if (texture->m_CpuReadable)
+                texture->m_PixelData[subresource].assign(pixels.Data, pixels.Data + pixels.Size);
+
+            // The pixels are uploaded straight from the mapped file
+            u32 mipLevels = texture->GetMipLevels();
+            Renderer::UploadTextureData(texture->m_TextureResource, pixels.Data, subresource % mipLevels, subresource / mipLevels);
+        }
+
+        for (u32 submeshIdx = 0; submeshIdx < materialUUIDs.size(); submeshIdx++)
+            mesh->SetMaterial(submeshIdx, AssetManager::GetAsset<Material>(materialUUIDs[submeshIdx], true));
+
+        changedChunkCount = changedChunks.size();
+        return true;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void AssetSerializer::SerializeMetaData(AssetFileWriter& writer, const AssetMetaData& metaData)
+    {
         String sourcePathStr = metaData.SourceFilepath.string();
         u32 sourcePathSize = sourcePathStr.size();
-        stream.write((char*)&metaData.UUID, sizeof(u64));
-        stream.write((char*)&metaData.Type, sizeof(AssetType));
-        stream.write((char*)&metaData.Flags, sizeof(AssetFlags));
-        stream.write((char*)&sourcePathSize, sizeof(u32));
-        stream.write(sourcePathStr.data(), sourcePathSize);
+
+        writer.BeginChunk(AssetChunkType::MetaData);
+        writer.Write(&metaData.UUID, sizeof(u64));
+        writer.Write(&metaData.Type, sizeof(AssetType));
+        writer.Write(&Utils::AssetDataVersions[(u32)metaData.Type], sizeof(u32));
+        writer.Write(&metaData.Flags, sizeof(AssetFlags));
+        writer.Write(&sourcePathSize, sizeof(u32));
+        writer.Write(sourcePathStr.data(), sourcePathSize);
+        writer.Write(metaData.ContentHash);
+        writer.EndChunk();
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    void AssetSerializer::DeserializeMetaData(std::ifstream& stream, AssetMetaData& metaData)
+    void AssetSerializer::SerializeDependencies(AssetFileWriter& writer, Vector<UUID>& dependencies)
     {
+        std::sort(dependencies.begin(), dependencies.end(), [](UUID a, UUID b) { return (u64)a < (u64)b; });
+        dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+        dependencies.erase(std::remove(dependencies.begin(), dependencies.end(), UUID(0)), dependencies.end());
+
+        u32 dependencyCount = dependencies.size();
+
+        writer.BeginChunk(AssetChunkType::Dependencies);
+        writer.Write(dependencyCount);
+        writer.Write(dependencies.data(), sizeof(UUID) * dependencyCount);
+        writer.EndChunk();
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool AssetSerializer::DeserializeMetaData(const AssetFileReader& file, AssetMetaData& metaData)
+    {
+        AssetChunkReader stream = file.GetChunk(AssetChunkType::MetaData);
+
+        u32 dataVersion;
         u32 sourcePathSize;
-        String sourcePathStr;
-        stream.read((char*)&metaData.UUID, sizeof(u64));
-        stream.read((char*)&metaData.Type, sizeof(AssetType));
-        stream.read((char*)&metaData.Flags, sizeof(AssetFlags));
-        stream.read((char*)&sourcePathSize, sizeof(u32));
-        sourcePathStr.resize(sourcePathSize);
-        stream.read(sourcePathStr.data(), sourcePathSize);
-        metaData.SourceFilepath = sourcePathStr;
+        stream.Read(&metaData.UUID, sizeof(u64));
+        stream.Read(&metaData.Type, sizeof(AssetType));
+        stream.Read(&dataVersion, sizeof(u32));
+        stream.Read(&metaData.Flags, sizeof(AssetFlags));
+        stream.Read(&sourcePathSize, sizeof(u32));
+
+        const byte* sourcePath = stream.ReadView(sourcePathSize);
+
+        if (!stream.IsValid() || (u32)metaData.Type >= (u32)AssetType::NumTypes)
+        {
+            ATOM_ERROR("Asset file {} has no valid metadata", file.GetFilepath());
+            return false;
+        }
+
+        if (dataVersion != Utils::AssetDataVersions[(u32)metaData.Type])
+        {
+            ATOM_ERROR("Asset file {} has an unsupported data version. Reimport the asset from its source file", file.GetFilepath());
+            return false;
+        }
+
+        metaData.SourceFilepath = String((const char*)sourcePath, sourcePathSize);
+
+        // Assets written before content hashes were added end after the source path
+        metaData.ContentHash = 0;
+        if (stream.GetRemainingSize() >= sizeof(u64))
+            stream.Read(metaData.ContentHash);
+
+        // Packed asset files don't exist on disk
+        metaData.AssetFilepath = std::filesystem::weakly_canonical(file.GetFilepath());
+        return true;
     }
 }
@@ -3,11 +3,15 @@
 #include "Atom/Core/Core.h"
 #include "Atom/Asset/Asset.h"
 #include "Atom/Asset/AssetManager.h"
+#include "Atom/Asset/AssetFile.h"
 
 namespace Atom
 {
+    class TextureAsset;
+
     class AssetSerializer
     {
+        friend class DerivedDataCache;
     public:
         template<typename T>
         static bool Serialize(const std::filesystem::path& filepath, Ref<T> asset);
@@ -15,8 +19,34 @@ namespace Atom
         template<typename T>
         static Ref<T> Deserialize(const std::filesystem::path& filepath);
         static bool DeserializeMetaData(const std::filesystem::path& filepath, AssetMetaData& assetMetaData);
+        static bool DeserializeDependencies(const std::filesystem::path& filepath, Vector<UUID>& dependencies); // Only the assets referenced directly
+
+        // Reads the chunks of the asset file that changed since the asset was read into the loaded asset. Returns false without modifying
+        // the asset if the changes can't be applied in place, e.g. because the layout of the asset changed, so it has to be deserialized again.
+        static bool DeserializeChangedChunks(const Ref<Asset>& asset, const std::filesystem::path& filepath, u32& changedChunkCount);
+
+        // Compression of the chunks of newly serialized assets. Files are readable regardless of the setting they were written with.
+        static void SetCompression(AssetType type, AssetCompression compression);
+        static AssetCompression GetCompression(AssetType type);
+
+        static u32 GetDataVersion(AssetType type); // Version of the chunk layout of the asset type, stored in the metadata of every asset file
+    private:
+        static void SerializeMetaData(AssetFileWriter& writer, const AssetMetaData& metaData);
+        static bool DeserializeMetaData(const AssetFileReader& file, AssetMetaData& metaData);
+        static void SerializeDependencies(AssetFileWriter& writer, Vector<UUID>& dependencies);
+        static void SerializeTextureSubresources(AssetFileWriter& writer, const Ref<TextureAsset>& asset, u32 arraySize, const Vector<Vector<byte>>& nonResidentMips = {});
     private:
-        static void SerializeMetaData(std::ofstream& stream, const AssetMetaData& metaData);
-        static void DeserializeMetaData(std::ifstream& stream, AssetMetaData& metaData);
+        // Bulk data compresses well, the remaining assets are small and stay uncompressed
+        inline static AssetCompression ms_Compression[(u32)AssetType::NumTypes] =
+        {
+            AssetCompression::LZ,   // Texture2D
+            AssetCompression::LZ,   // TextureCube
+            AssetCompression::LZ,   // Mesh
+            AssetCompression::None, // Material
+            AssetCompression::None, // Scene
+            AssetCompression::LZ,   // Animation
+            AssetCompression::None, // Skeleton
+            AssetCompression::None, // AnimationController
+        };
     };
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include "Atom/Renderer/Renderer.h"
 #include "Atom/Renderer/EngineResources.h"
+#include "Atom/Asset/AssetFile.h"
 
 namespace Atom
 {
@@ -74,13 +75,22 @@ namespace Atom
     // -----------------------------------------------------------------------------------------------------------------------------
     void Material::UpdateForRendering()
     {
+        for (auto& [slot, texture] : m_Textures)
+        {
+            const Texture* resource = texture ? texture->GetResource().get() : EngineResources::BlackTexture.get();
+
+            if (m_BoundResources[slot] != resource)
+                m_Dirty = true;
+        }
+
         if (m_Dirty)
         {
             m_MaterialSIG->SetConstant(0, m_ConstantsData.data(), m_ConstantsData.size());
 
             for (auto& [slot, texture] : m_Textures)
             {
-                m_MaterialSIG->SetROTexture(slot, texture ? texture->GetResource().get() : EngineResources::BlackTexture.get());
+                m_BoundResources[slot] = texture ? texture->GetResource().get() : EngineResources::BlackTexture.get();
+                m_MaterialSIG->SetROTexture(slot, m_BoundResources[slot]);
                 m_MaterialSIG->SetSampler(slot, texture ? Renderer::GetSampler(texture->GetFilter(), texture->GetWrap()).get() : EngineResources::LinearClampSampler.get());
             }
 
@@ -109,6 +119,29 @@ namespace Atom
             m_Flags &= ~flag;
     }
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    u64 Material::ComputeContentHash() const
+    {
+        Vector<byte> content;
+        auto Append = [&](const void* data, u64 size) { content.insert(content.end(), (const byte*)data, (const byte*)data + size); };
+
+        Append(m_Shader->GetName().data(), m_Shader->GetName().size());
+        Append(&m_Flags, sizeof(MaterialFlags));
+        Append(m_ConstantsData.data(), m_ConstantsData.size());
+
+        for (auto& [shaderRegister, texture] : m_Textures)
+        {
+            if (!texture)
+                continue;
+
+            u64 textureUUID = texture->GetUUID();
+            Append(&shaderRegister, sizeof(u32));
+            Append(&textureUUID, sizeof(u64));
+        }
+
+        return AssetFile::ComputeHash(content.data(), content.size());
+    }
+
     // -----------------------------------------------------------------------------------------------------------------------------
     const ShaderConstant* Material::FindUniformDeclaration(const char* name)
     {
@@ -77,6 +77,7 @@ namespace Atom
         bool HasTexture(const char* name);
 
         void UpdateForRendering();
+        u64 ComputeContentHash() const; // Hash of everything that is serialized, materials with the same hash are interchangeable
 
         void SetFlag(MaterialFlags flag, bool state);
         inline void SetFlags(MaterialFlags flags) { m_Flags = flags; }
@@ -95,6 +96,7 @@ namespace Atom
         MaterialFlags               m_Flags;
         Vector<byte>                m_ConstantsData;
         Map<u32, Ref<TextureAsset>> m_Textures;
+        Map<u32, const Texture*>    m_BoundResources; // Streamed textures replace their resource when mips are loaded or evicted
         Ref<MaterialSIG>            m_MaterialSIG;
         bool                        m_Dirty = true;
     };
@@ -21,79 +21,9 @@ namespace Atom
     Mesh::Mesh(const MeshDescription& desc, bool isReadable)
         : Asset(AssetType::Mesh), m_Submeshes(desc.Submeshes), m_MaterialTable(desc.MaterialTable), m_IsReadable(isReadable)
     {
-        if (!desc.BoneWeights.empty())
-        {
-            // Animated meshes
-            Vector<AnimatedVertex> vertices;
-            vertices.reserve(desc.Positions.size());
-
-            for (u32 i = 0; i < desc.Positions.size(); i++)
-            {
-                AnimatedVertex v;
-                v.Position = desc.Positions[i];
-                v.TexCoord = desc.UVs[i];
-                v.Normal = desc.Normals[i];
-                v.Tangent = desc.Tangents[i];
-                v.Bitangent = desc.Bitangents[i];
-                for (u32 weightIdx = 0; weightIdx < Skeleton::Bone::MAX_BONE_WEIGHTS; weightIdx++)
-                {
-                    auto& [boneID, weight] = desc.BoneWeights[i].Weights[weightIdx];
-                    v.BoneIDs[weightIdx] = boneID;
-                    v.BoneWeights[weightIdx] = weight;
-                }
-                vertices.push_back(std::move(v));
-            }
-
-            if (!vertices.empty())
-            {
-                BufferDescription vbDesc;
-                vbDesc.ElementCount = vertices.size();
-                vbDesc.ElementSize = sizeof(AnimatedVertex);
-                vbDesc.IsDynamic = false;
-
-                m_VertexBuffer = CreateRef<VertexBuffer>(vbDesc, "VB");
-                Renderer::UploadBufferData(m_VertexBuffer, vertices.data());
-            }
-        }
-        else
-        {
-            // Regular meshes
-            Vector<Vertex> vertices;
-            vertices.reserve(desc.Positions.size());
-
-            for (u32 i = 0; i < desc.Positions.size(); i++)
-            {
-                Vertex v;
-                v.Position = desc.Positions[i];
-                v.TexCoord = desc.UVs[i];
-                v.Normal = desc.Normals[i];
-                v.Tangent = desc.Tangents[i];
-                v.Bitangent = desc.Bitangents[i];
-                vertices.push_back(std::move(v));
-            }
-
-            if (!vertices.empty())
-            {
-                BufferDescription vbDesc;
-                vbDesc.ElementCount = vertices.size();
-                vbDesc.ElementSize = sizeof(Vertex);
-                vbDesc.IsDynamic = false;
-
-                m_VertexBuffer = CreateRef<VertexBuffer>(vbDesc, "VB");
-                Renderer::UploadBufferData(m_VertexBuffer, vertices.data());
-            }
-        }
-
-        if (!desc.Indices.empty())
-        {
-            BufferDescription ibDesc;
-            ibDesc.ElementCount = desc.Indices.size();
-            ibDesc.ElementSize = sizeof(u32);
-            ibDesc.IsDynamic = false;
-
-            m_IndexBuffer = CreateRef<IndexBuffer>(ibDesc, IndexBufferFormat::U32, "IB");
-            Renderer::UploadBufferData(m_IndexBuffer, desc.Indices.data());
-        }
+        Vector<byte> vertexData;
+        InterleaveVertices(desc.Positions, desc.UVs, desc.Normals, desc.Tangents, desc.Bitangents, desc.BoneWeights, vertexData);
+        CreateBuffers(vertexData.data(), desc.Positions.size(), GetVertexStride(!desc.BoneWeights.empty()), desc.Indices.data(), desc.Indices.size());
 
         if (m_IsReadable)
         {
@@ -107,6 +37,13 @@ namespace Atom
         }
     }
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    Mesh::Mesh(const void* vertexData, u32 vertexCount, u32 vertexStride, const u32* indexData, u32 indexCount, const Vector<Submesh>& submeshes, const Ref<MaterialTable>& materialTable)
+        : Asset(AssetType::Mesh), m_Submeshes(submeshes), m_MaterialTable(materialTable), m_IsReadable(false)
+    {
+        CreateBuffers(vertexData, vertexCount, vertexStride, indexData, indexCount);
+    }
+
     // -----------------------------------------------------------------------------------------------------------------------------
     Mesh::Mesh(Mesh&& rhs) noexcept
         : Asset(AssetType::Mesh), 
@@ -114,7 +51,8 @@ namespace Atom
         m_BoneWeights(std::move(rhs.m_BoneWeights)),
         m_Indices(std::move(rhs.m_Indices)),
         m_Submeshes(std::move(rhs.m_Submeshes)), m_MaterialTable(std::move(rhs.m_MaterialTable)),
-        m_VertexBuffer(std::move(rhs.m_VertexBuffer)), m_IndexBuffer(std::move(rhs.m_IndexBuffer)), m_IsReadable(rhs.m_IsReadable)
+        m_VertexBuffer(std::move(rhs.m_VertexBuffer)), m_IndexBuffer(std::move(rhs.m_IndexBuffer)), m_IsReadable(rhs.m_IsReadable),
+        m_BoundsMin(rhs.m_BoundsMin), m_BoundsMax(rhs.m_BoundsMax)
     {
     }
 
@@ -135,6 +73,8 @@ namespace Atom
             m_VertexBuffer = std::move(rhs.m_VertexBuffer);
             m_IndexBuffer = std::move(rhs.m_IndexBuffer);
             m_IsReadable = rhs.m_IsReadable;
+            m_BoundsMin = rhs.m_BoundsMin;
+            m_BoundsMax = rhs.m_BoundsMax;
         }
 
         return *this;
@@ -147,87 +87,33 @@ namespace Atom
         {
             m_IsReadable = !makeNonReadable;
 
-            if (!m_BoneWeights.empty())
-            {
-                // Animated meshes
-                Vector<AnimatedVertex> vertices;
-                vertices.reserve(m_Positions.size());
-
-                for (u32 i = 0; i < m_Positions.size(); i++)
-                {
-                    AnimatedVertex v;
-                    v.Position = m_Positions[i];
-                    v.TexCoord = m_UVs[i];
-                    v.Normal = m_Normals[i];
-                    v.Tangent = m_Tangents[i];
-                    v.Bitangent = m_Bitangents[i];
-                    for (u32 weightIdx = 0; weightIdx < Skeleton::Bone::MAX_BONE_WEIGHTS; weightIdx++)
-                    {
-                        auto& [boneID, weight] = m_BoneWeights[i].Weights[weightIdx];
-                        v.BoneIDs[weightIdx] = boneID;
-                        v.BoneWeights[weightIdx] = weight;
-                    }
-                    vertices.push_back(std::move(v));
-                }
-
-                if (!m_VertexBuffer || m_VertexBuffer->GetElementCount() != vertices.size())
-                {
-                    if (vertices.size() != 0)
-                    {
-                        BufferDescription vbDesc;
-                        vbDesc.ElementCount = vertices.size();
-                        vbDesc.ElementSize = sizeof(AnimatedVertex);
-                        vbDesc.IsDynamic = false;
+            Vector<byte> vertexData;
+            InterleaveVertices(m_Positions, m_UVs, m_Normals, m_Tangents, m_Bitangents, m_BoneWeights, vertexData);
 
-                        m_VertexBuffer = CreateRef<VertexBuffer>(vbDesc, "VB");
-                    }
-                    else
-                    {
-                        m_VertexBuffer = nullptr;
-                    }
-                }
+            u32 vertexStride = GetVertexStride(!m_BoneWeights.empty());
+            u32 vertexCount = m_Positions.size();
+            CalculateBounds(vertexData.data(), vertexCount, vertexStride);
 
-                if (vertices.size())
-                    Renderer::UploadBufferData(m_VertexBuffer, vertices.data());
-            }
-            else
+            if (!m_VertexBuffer || m_VertexBuffer->GetElementCount() != vertexCount || m_VertexBuffer->GetElementSize() != vertexStride)
             {
-                // Regular meshes
-                Vector<Vertex> vertices;
-                vertices.reserve(m_Positions.size());
-
-                for (u32 i = 0; i < m_Positions.size(); i++)
+                if (vertexCount != 0)
                 {
-                    Vertex v;
-                    v.Position = m_Positions[i];
-                    v.TexCoord = m_UVs[i];
-                    v.Normal = m_Normals[i];
-                    v.Tangent = m_Tangents[i];
-                    v.Bitangent = m_Bitangents[i];
-                    vertices.push_back(std::move(v));
-                }
+                    BufferDescription vbDesc;
+                    vbDesc.ElementCount = vertexCount;
+                    vbDesc.ElementSize = vertexStride;
+                    vbDesc.IsDynamic = false;
 
-                if (!m_VertexBuffer || m_VertexBuffer->GetElementCount() != vertices.size())
+                    m_VertexBuffer = CreateRef<VertexBuffer>(vbDesc, "VB");
+                }
+                else
                 {
-                    if (vertices.size() != 0)
-                    {
-                        BufferDescription vbDesc;
-                        vbDesc.ElementCount = vertices.size();
-                        vbDesc.ElementSize = sizeof(Vertex);
-                        vbDesc.IsDynamic = false;
-
-                        m_VertexBuffer = CreateRef<VertexBuffer>(vbDesc, "VB");
-                    }
-                    else
-                    {
-                        m_VertexBuffer = nullptr;
-                    }
+                    m_VertexBuffer = nullptr;
                 }
-
-                if (vertices.size())
-                    Renderer::UploadBufferData(m_VertexBuffer, vertices.data());
             }
 
+            if (vertexCount)
+                Renderer::UploadBufferData(m_VertexBuffer, vertexData.data());
+
             if (!m_IndexBuffer || m_IndexBuffer->GetElementCount() != m_Indices.size())
             {
                 if (m_Indices.size() != 0)
@@ -260,4 +146,92 @@ namespace Atom
             }
         }
     }
-}
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void Mesh::InterleaveVertices(const Vector<glm::vec3>& positions, const Vector<glm::vec2>& uvs, const Vector<glm::vec3>& normals, const Vector<glm::vec3>& tangents,
+                                  const Vector<glm::vec3>& bitangents, const Vector<BoneWeight>& boneWeights, Vector<byte>& vertexData)
+    {
+        if (!boneWeights.empty())
+        {
+            // Animated meshes
+            vertexData.resize(positions.size() * sizeof(AnimatedVertex));
+            AnimatedVertex* vertices = (AnimatedVertex*)vertexData.data();
+
+            for (u32 i = 0; i < positions.size(); i++)
+            {
+                AnimatedVertex& v = vertices[i];
+                v.Position = positions[i];
+                v.TexCoord = uvs[i];
+                v.Normal = normals[i];
+                v.Tangent = tangents[i];
+                v.Bitangent = bitangents[i];
+                for (u32 weightIdx = 0; weightIdx < Skeleton::Bone::MAX_BONE_WEIGHTS; weightIdx++)
+                {
+                    auto& [boneID, weight] = boneWeights[i].Weights[weightIdx];
+                    v.BoneIDs[weightIdx] = boneID;
+                    v.BoneWeights[weightIdx] = weight;
+                }
+            }
+        }
+        else
+        {
+            // Regular meshes
+            vertexData.resize(positions.size() * sizeof(Vertex));
+            Vertex* vertices = (Vertex*)vertexData.data();
+
+            for (u32 i = 0; i < positions.size(); i++)
+            {
+                Vertex& v = vertices[i];
+                v.Position = positions[i];
+                v.TexCoord = uvs[i];
+                v.Normal = normals[i];
+                v.Tangent = tangents[i];
+                v.Bitangent = bitangents[i];
+            }
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void Mesh::CreateBuffers(const void* vertexData, u32 vertexCount, u32 vertexStride, const u32* indexData, u32 indexCount)
+    {
+        CalculateBounds(vertexData, vertexCount, vertexStride);
+
+        if (vertexCount)
+        {
+            BufferDescription vbDesc;
+            vbDesc.ElementCount = vertexCount;
+            vbDesc.ElementSize = vertexStride;
+            vbDesc.IsDynamic = false;
+
+            m_VertexBuffer = CreateRef<VertexBuffer>(vbDesc, "VB");
+            Renderer::UploadBufferData(m_VertexBuffer, vertexData);
+        }
+
+        if (indexCount)
+        {
+            BufferDescription ibDesc;
+            ibDesc.ElementCount = indexCount;
+            ibDesc.ElementSize = sizeof(u32);
+            ibDesc.IsDynamic = false;
+
+            m_IndexBuffer = CreateRef<IndexBuffer>(ibDesc, IndexBufferFormat::U32, "IB");
+            Renderer::UploadBufferData(m_IndexBuffer, indexData);
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void Mesh::CalculateBounds(const void* vertexData, u32 vertexCount, u32 vertexStride)
+    {
+        m_BoundsMin = glm::vec3(FLT_MAX);
+        m_BoundsMax = glm::vec3(-FLT_MAX);
+
+        // The position is the first attribute of both vertex layouts
+        const byte* vertex = (const byte*)vertexData;
+        for (u32 i = 0; i < vertexCount; i++, vertex += vertexStride)
+        {
+            const glm::vec3& position = *(const glm::vec3*)vertex;
+            m_BoundsMin = glm::min(m_BoundsMin, position);
+            m_BoundsMax = glm::max(m_BoundsMax, position);
+        }
+    }
+}
\ No newline at end of file
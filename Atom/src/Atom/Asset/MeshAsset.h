@@ -64,6 +64,9 @@ namespace Atom
         Mesh();
         Mesh(const MeshDescription& desc, bool isReadable);
 
+        // Creates a non readable mesh from vertices that are already interleaved in the layout of the vertex buffer, e.g. by a mapped asset file
+        Mesh(const void* vertexData, u32 vertexCount, u32 vertexStride, const u32* indexData, u32 indexCount, const Vector<Submesh>& submeshes, const Ref<MaterialTable>& materialTable);
+
         Mesh(const Mesh& rhs) = delete;
         Mesh& operator=(const Mesh& rhs) = delete;
 
@@ -96,6 +99,17 @@ namespace Atom
         inline bool IsEmpty() const { return !m_VertexBuffer || !m_IndexBuffer || !m_Submeshes.size(); }
         inline Ref<VertexBuffer> GetVertexBuffer() const { return m_VertexBuffer; }
         inline Ref<IndexBuffer> GetIndexBuffer() const { return m_IndexBuffer; }
+        inline const glm::vec3& GetBoundsMin() const { return m_BoundsMin; }
+        inline const glm::vec3& GetBoundsMax() const { return m_BoundsMax; }
+        inline bool HasBounds() const { return m_BoundsMin.x <= m_BoundsMax.x; }
+
+        // Interleaves the vertex streams in the layout of the vertex buffer. The vertices are animated if there are bone weights.
+        static void InterleaveVertices(const Vector<glm::vec3>& positions, const Vector<glm::vec2>& uvs, const Vector<glm::vec3>& normals, const Vector<glm::vec3>& tangents,
+                                       const Vector<glm::vec3>& bitangents, const Vector<BoneWeight>& boneWeights, Vector<byte>& vertexData);
+        static u32 GetVertexStride(bool isAnimated) { return isAnimated ? sizeof(AnimatedVertex) : sizeof(Vertex); }
+    private:
+        void CreateBuffers(const void* vertexData, u32 vertexCount, u32 vertexStride, const u32* indexData, u32 indexCount);
+        void CalculateBounds(const void* vertexData, u32 vertexCount, u32 vertexStride);
     private:
         Vector<glm::vec3>  m_Positions;
         Vector<glm::vec2>  m_UVs;
@@ -109,5 +123,7 @@ namespace Atom
         bool               m_IsReadable = true;
         Ref<VertexBuffer>  m_VertexBuffer = nullptr;
         Ref<IndexBuffer>   m_IndexBuffer = nullptr;
+        glm::vec3          m_BoundsMin = glm::vec3(FLT_MAX); // Bind pose bounds in mesh space
+        glm::vec3          m_BoundsMax = glm::vec3(-FLT_MAX);
     };
 }
\ No newline at end of file
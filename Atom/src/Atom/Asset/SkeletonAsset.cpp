@@ -5,17 +5,72 @@ namespace Atom
 {
     // -----------------------------------------------------------------------------------------------------------------------------
     Skeleton::Skeleton(const Vector<Bone>& bones)
-        : Asset(AssetType::Skeleton), m_Bones(bones), m_RootBoneID(UINT32_MAX)
+        : Asset(AssetType::Skeleton), m_Bones(bones)
     {
-        for (auto& bone : bones)
+        m_ParentIDs.reserve(m_Bones.size());
+
+        for (u32 boneID = 0; boneID < m_Bones.size(); boneID++)
+        {
+            const Bone& bone = m_Bones[boneID];
+            ATOM_ENGINE_ASSERT(bone.ID == boneID && (bone.ParentID == UINT32_MAX || bone.ParentID < boneID), "Skeleton bones are not ordered parent before child");
+
+            m_ParentIDs.push_back(bone.ParentID);
+        }
+
+        // Children come after their parents so the heights can be accumulated in reverse order
+        m_BoneHeights.assign(m_Bones.size(), 0);
+
+        for (u32 boneID = m_Bones.size(); boneID-- > 0;)
+        {
+            u32 parentID = m_ParentIDs[boneID];
+
+            if (parentID != UINT32_MAX)
+                m_BoneHeights[parentID] = glm::max(m_BoneHeights[parentID], m_BoneHeights[boneID] + 1);
+        }
+
+        // Bring the bone space bounds to bind pose mesh space. Boxes rotated by the bind transform become oriented boxes.
+        glm::vec3 minPosition = glm::vec3(FLT_MAX);
+        glm::vec3 maxPosition = glm::vec3(-FLT_MAX);
+
+        for (auto& bone : m_Bones)
         {
-            if (bone.ParentID == UINT32_MAX)
+            if (glm::any(glm::greaterThan(bone.BoundsMin, bone.BoundsMax)))
+                continue;
+
+            glm::mat4 bindTransform = glm::inverse(bone.InverseBindTransform);
+            glm::vec3 halfExtent = (bone.BoundsMax - bone.BoundsMin) * 0.5f;
+
+            BoneBounds& bounds = m_BoneBounds.emplace_back();
+            bounds.BoneID = bone.ID;
+            bounds.Center = bindTransform * glm::vec4((bone.BoundsMin + bone.BoundsMax) * 0.5f, 1.0f);
+
+            glm::vec3 extent = glm::vec3(0.0f);
+            for (u32 axis = 0; axis < 3; axis++)
             {
-                m_RootBoneID = bone.ID;
-                break;
+                bounds.HalfAxes[axis] = glm::vec3(bindTransform[axis]) * halfExtent[axis];
+                extent += glm::abs(bounds.HalfAxes[axis]);
             }
+
+            minPosition = glm::min(minPosition, bounds.Center - extent);
+            maxPosition = glm::max(maxPosition, bounds.Center + extent);
+        }
+
+        if (!m_BoneBounds.empty())
+        {
+            m_BindPoseCenter = (minPosition + maxPosition) * 0.5f;
+            m_BindPoseRadius = glm::length(maxPosition - minPosition) * 0.5f;
+            return;
+        }
+
+        // Skeletons without bounds fall back to the bone positions. The skin extends past the bones so the radius is padded.
+        for (auto& bone : m_Bones)
+        {
+            glm::vec3 position = glm::inverse(bone.InverseBindTransform)[3];
+            minPosition = glm::min(minPosition, position);
+            maxPosition = glm::max(maxPosition, position);
         }
 
-        ATOM_ENGINE_ASSERT(m_RootBoneID != UINT32_MAX);
+        m_BindPoseCenter = (minPosition + maxPosition) * 0.5f;
+        m_BindPoseRadius = glm::length(maxPosition - minPosition) * 0.5f * 1.5f;
     }
 }
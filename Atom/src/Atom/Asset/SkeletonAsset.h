@@ -18,18 +18,36 @@ namespace Atom
 
             u32 ID = UINT32_MAX;
             u32 ParentID = UINT32_MAX;
-            Vector<u32> ChildrenIDs;
             glm::mat4 InverseBindTransform = glm::mat4(1.0f);
-            glm::mat4 AnimatedTransform = glm::mat4(1.0f);
+            glm::vec3 BoundsMin = glm::vec3(FLT_MAX);  // In bone space. Empty for bones that don't influence any vertices.
+            glm::vec3 BoundsMax = glm::vec3(-FLT_MAX);
+        };
 
+        // Bounds of a bone as an oriented box in bind pose mesh space
+        struct BoneBounds
+        {
+            u32       BoneID = UINT32_MAX;
+            glm::vec3 Center = glm::vec3(0.0f);
+            glm::vec3 HalfAxes[3];
         };
     public:
+        // Bones have to be ordered so that every parent comes before its children. The importer takes care of that.
         Skeleton(const Vector<Bone>& bones);
 
-        inline Bone& GetRootBone() { return m_Bones[m_RootBoneID]; }
-        inline Vector<Bone>& GetBones() { return m_Bones; }
+        inline const Bone& GetRootBone() const { return m_Bones[0]; }
+        inline const Vector<Bone>& GetBones() const { return m_Bones; }
+        inline u32 GetBoneCount() const { return m_Bones.size(); }
+        inline const Vector<u32>& GetParentIDs() const { return m_ParentIDs; }
+        inline const Vector<u32>& GetBoneHeights() const { return m_BoneHeights; }
+        inline const Vector<BoneBounds>& GetBoneBounds() const { return m_BoneBounds; }
+        inline const glm::vec3& GetBindPoseCenter() const { return m_BindPoseCenter; }
+        inline f32 GetBindPoseRadius() const { return m_BindPoseRadius; }
     private:
-        u32          m_RootBoneID;
-        Vector<Bone> m_Bones;
+        Vector<Bone>       m_Bones;
+        Vector<u32>        m_ParentIDs;   // Parent of every bone indexed by bone ID. UINT32_MAX for root bones.
+        Vector<u32>        m_BoneHeights; // Number of levels of children below each bone. Leaf bones have 0.
+        Vector<BoneBounds> m_BoneBounds;  // Only bones that influence vertices have bounds
+        glm::vec3          m_BindPoseCenter = glm::vec3(0.0f);
+        f32                m_BindPoseRadius = 0.0f;
     };
 }
\ No newline at end of file
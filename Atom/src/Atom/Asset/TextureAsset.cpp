@@ -8,7 +8,7 @@ namespace Atom
     // ------------------------------------------------ TextureAsset -----------------------------------------------------------
     // -----------------------------------------------------------------------------------------------------------------------------
     TextureAsset::TextureAsset(AssetType type, const TextureDescription& description, bool cpuReadable)
-        : Asset(type), m_CpuReadable(cpuReadable)
+        : Asset(type), m_Description(description), m_CpuReadable(cpuReadable)
     {
         m_TextureResource = CreateRef<Texture>(description, fmt::format("TextureAsset_{:#x}", m_MetaData.UUID).c_str());
 
@@ -18,12 +18,19 @@ namespace Atom
 
     // -----------------------------------------------------------------------------------------------------------------------------
     TextureAsset::TextureAsset(AssetType type, const TextureDescription& description, bool cpuReadable, const Vector<Vector<byte>>& pixelData)
-        : Asset(type), m_CpuReadable(cpuReadable)
+        : TextureAsset(type, description, cpuReadable, GetPixelDataViews(pixelData))
+    {
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    TextureAsset::TextureAsset(AssetType type, const TextureDescription& description, bool cpuReadable, const Vector<PixelDataView>& pixelData)
+        : Asset(type), m_Description(description), m_CpuReadable(cpuReadable)
     {
         // Create resource
         m_TextureResource = CreateRef<Texture>(description, fmt::format("TextureAsset_{:#x}", m_MetaData.UUID).c_str());
 
-        // Copy the data if any is provided
+        // Copy the data if any is provided. The views may point directly into a mapped file so the pixels are uploaded from there
+        // and only copied to the CPU side when the texture is readable.
         u32 subresourceCount = description.Type == TextureType::Texture3D ? description.MipLevels : description.MipLevels * description.ArraySize;
         ATOM_ENGINE_ASSERT(pixelData.size() == subresourceCount);
 
@@ -34,10 +41,10 @@ namespace Atom
             for (u32 mip = 0; mip < description.MipLevels; mip++)
             {
                 u32 subresource = D3D12CalcSubresource(mip, 0, 0, description.MipLevels, 1);
-                Renderer::UploadTextureData(m_TextureResource, pixelData[subresource].data(), mip);
+                Renderer::UploadTextureData(m_TextureResource, pixelData[subresource].Data, mip);
 
                 if (m_CpuReadable)
-                    m_PixelData[subresource] = pixelData[subresource];
+                    m_PixelData[subresource].assign(pixelData[subresource].Data, pixelData[subresource].Data + pixelData[subresource].Size);
             }
         }
         else
@@ -47,10 +54,10 @@ namespace Atom
                 for (u32 mip = 0; mip < description.MipLevels; mip++)
                 {
                     u32 subresource = D3D12CalcSubresource(mip, slice, 0, description.MipLevels, description.ArraySize);
-                    Renderer::UploadTextureData(m_TextureResource, pixelData[subresource].data(), mip, slice);
+                    Renderer::UploadTextureData(m_TextureResource, pixelData[subresource].Data, mip, slice);
 
                     if (m_CpuReadable)
-                        m_PixelData[subresource] = pixelData[subresource];
+                        m_PixelData[subresource].assign(pixelData[subresource].Data, pixelData[subresource].Data + pixelData[subresource].Size);
                 }
             }
         }
@@ -58,7 +65,7 @@ namespace Atom
 
     // -----------------------------------------------------------------------------------------------------------------------------
     TextureAsset::TextureAsset(AssetType type, const Ref<Texture>& textureResource, bool cpuReadable)
-        : Asset(type), m_TextureResource(textureResource), m_CpuReadable(cpuReadable)
+        : Asset(type), m_TextureResource(textureResource), m_Description(textureResource->GetDescription()), m_CpuReadable(cpuReadable)
     {
     }
 
@@ -127,37 +134,43 @@ namespace Atom
     // -----------------------------------------------------------------------------------------------------------------------------
     TextureFormat TextureAsset::GetFormat() const
     {
-        return m_TextureResource->GetFormat();
+        return m_Description.Format;
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
     u32 TextureAsset::GetWidth() const
     {
-        return m_TextureResource->GetWidth();
+        return m_Description.Width;
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
     u32 TextureAsset::GetHeight() const
     {
-        return m_TextureResource->GetHeight();
+        return m_Description.Height;
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
     u32 TextureAsset::GetDepth() const
     {
-        return m_TextureResource->GetDepth();
+        return m_Description.Depth;
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
     u32 TextureAsset::GetArraySize() const
     {
-        return m_TextureResource->GetArraySize();
+        return m_Description.ArraySize;
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
     u32 TextureAsset::GetMipLevels() const
     {
-        return m_TextureResource->GetMipLevels();
+        return m_Description.MipLevels;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    u32 TextureAsset::GetResidentMip() const
+    {
+        return m_ResidentMip;
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
@@ -194,6 +207,18 @@ namespace Atom
         return {};
     }
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    Vector<PixelDataView> TextureAsset::GetPixelDataViews(const Vector<Vector<byte>>& pixelData)
+    {
+        Vector<PixelDataView> views;
+        views.reserve(pixelData.size());
+
+        for (const auto& pixels : pixelData)
+            views.push_back({ pixels.data(), (u32)pixels.size() });
+
+        return views;
+    }
+
     // --------------------------------------------------- Texture2D ---------------------------------------------------------------
     // -----------------------------------------------------------------------------------------------------------------------------
     Texture2D::Texture2D(u32 width, u32 height, TextureFormat format, u32 mipCount, bool cpuReadable, bool gpuWritable)
@@ -225,6 +250,21 @@ namespace Atom
     {
     }
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    Texture2D::Texture2D(u32 width, u32 height, TextureFormat format, u32 mipCount, bool cpuReadable, bool gpuWritable, const Vector<PixelDataView>& pixelData)
+        : TextureAsset(AssetType::Texture2D, {
+            TextureType::Texture2D,
+            format,
+            width,
+            height,
+            1,
+            1,
+            mipCount == 0 ? Texture::CalculateMaxMipCount(width, height) : mipCount,
+            gpuWritable ? TextureFlags::UnorderedAccess | TextureFlags::ShaderResource : TextureFlags::ShaderResource
+        }, cpuReadable, pixelData)
+    {
+    }
+
     // -----------------------------------------------------------------------------------------------------------------------------
     Texture2D::Texture2D(const Ref<Texture>& textureResource, bool cpuReadable)
         : TextureAsset(AssetType::Texture2D, textureResource, cpuReadable)
@@ -276,6 +316,21 @@ namespace Atom
     {
     }
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    TextureCube::TextureCube(u32 size, TextureFormat format, u32 mipCount, bool cpuReadable, bool gpuWritable, const Vector<PixelDataView>& pixelData)
+        : TextureAsset(AssetType::TextureCube, {
+            TextureType::Texture2D,
+            format,
+            size,
+            size,
+            1,
+            6,
+            mipCount == 0 ? Texture::CalculateMaxMipCount(size, size) : mipCount,
+            gpuWritable ? TextureFlags::UnorderedAccess | TextureFlags::ShaderResource | TextureFlags::CubeMap : TextureFlags::ShaderResource | TextureFlags::CubeMap
+        }, cpuReadable, pixelData)
+    {
+    }
+
     // -----------------------------------------------------------------------------------------------------------------------------
     TextureCube::TextureCube(const Ref<Texture>& textureResource, bool cpuReadable)
         : TextureAsset(AssetType::TextureCube, textureResource, cpuReadable)
@@ -7,9 +7,17 @@
 
 namespace Atom
 {
+    // Non-owning view of the pixels of a single subresource, e.g. a region of a memory mapped asset file
+    struct PixelDataView
+    {
+        const byte* Data = nullptr;
+        u32         Size = 0;
+    };
+
     class TextureAsset : public Asset
     {
         friend class AssetSerializer;
+        friend class TextureStreamer;
     public:
         virtual ~TextureAsset() = default;
 
@@ -26,22 +34,29 @@ namespace Atom
         u32 GetDepth() const;
         u32 GetArraySize() const;
         u32 GetMipLevels() const;
+        u32 GetResidentMip() const;
         TextureFilter GetFilter() const;
         TextureWrap GetWrap() const;
         Ref<Texture> GetResource() const;
     protected:
         TextureAsset(AssetType type, const TextureDescription& description, bool cpuReadable);
         TextureAsset(AssetType type, const TextureDescription& description, bool cpuReadable, const Vector<Vector<byte>>& pixelData);
+        TextureAsset(AssetType type, const TextureDescription& description, bool cpuReadable, const Vector<PixelDataView>& pixelData);
         TextureAsset(AssetType type, const Ref<Texture>& textureResource, bool cpuReadable);
 
         void SetSubresourcePixels(const Vector<byte>& pixels, u32 subresource);
         const Vector<byte>& GetSubresourcePixels(u32 subresource) const;
+    private:
+        static Vector<PixelDataView> GetPixelDataViews(const Vector<Vector<byte>>& pixelData);
     protected:
         Ref<Texture>         m_TextureResource;
+        TextureDescription   m_Description; // Description of the full texture. The resource only has the resident mips when streamed.
         Vector<Vector<byte>> m_PixelData;
         bool                 m_CpuReadable;
         TextureFilter        m_Filter = TextureFilter::Linear;
         TextureWrap          m_Wrap = TextureWrap::Repeat;
+        u32                  m_ResidentMip = 0;
+        u32                  m_StreamingID = UINT32_MAX;
     };
 
     class Texture2D : public TextureAsset
@@ -50,6 +65,7 @@ namespace Atom
     public:
         Texture2D(u32 width, u32 height, TextureFormat format, u32 mipCount, bool cpuReadable, bool gpuWritable);
         Texture2D(u32 width, u32 height, TextureFormat format, u32 mipCount, bool cpuReadable, bool gpuWritable, const Vector<Vector<byte>>& pixelData);
+        Texture2D(u32 width, u32 height, TextureFormat format, u32 mipCount, bool cpuReadable, bool gpuWritable, const Vector<PixelDataView>& pixelData);
         Texture2D(const Ref<Texture>& textureResource, bool cpuReadable);
 
         void SetPixels(const Vector<byte>& pixels, u32 mip);
@@ -62,6 +78,7 @@ namespace Atom
     public:
         TextureCube(u32 size, TextureFormat format, u32 mipCount, bool cpuReadable, bool gpuWritable);
         TextureCube(u32 size, TextureFormat format, u32 mipCount, bool cpuReadable, bool gpuWritable, const Vector<Vector<byte>>& pixelData);
+        TextureCube(u32 size, TextureFormat format, u32 mipCount, bool cpuReadable, bool gpuWritable, const Vector<PixelDataView>& pixelData);
         TextureCube(const Ref<Texture>& textureResource, bool cpuReadable);
 
         void SetPixels(const Vector<byte>& pixels, u32 mip, u32 face);
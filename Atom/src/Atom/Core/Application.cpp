@@ -5,6 +5,7 @@
 #include "Atom/Core/Logger.h"
 #include "Atom/Core/Input.h"
 #include "Atom/Renderer/EngineResources.h"
+#include "Atom/Renderer/TextureStreamer.h"
 #include "Atom/Scripting/ScriptEngine.h"
 #include "Atom/Physics/PhysicsEngine.h"
 #include "Atom/Asset/AssetManager.h"
@@ -53,8 +54,11 @@ namespace Atom
         PhysicsEngine::Initialize();
         Input::Initialize(m_Window->GetWindowHandle());
         EngineResources::Initialize();
+        TextureStreamer::Initialize();
 
-        
+        // The main thread takes part in the parallel work as well
+        m_WorkerThreadPool = CreateScope<ThreadPool>(std::max(std::thread::hardware_concurrency(), 2u) - 1);
+        m_WorkerThreadPool->Start();
 
         // Initialize ImGUI
         m_ImGuiLayer = new ImGuiLayer();
@@ -69,7 +73,10 @@ namespace Atom
         for (auto layer : m_LayerStack)
             layer->OnDetach();
 
+        m_WorkerThreadPool->Stop();
+
         SIG::SIGDataBase::Shutdown();
+        TextureStreamer::Shutdown();
         AssetManager::Shutdown();
         EngineResources::Shutdown();
         ScriptEngine::Shutdown();
@@ -92,7 +99,9 @@ namespace Atom
 
             ExecuteMainThreadQueue();
 
-            AssetManager::UnloadUnusedAssets();
+            AssetManager::ProcessAsyncLoads();
+            AssetManager::UpdateAssetCache();
+            TextureStreamer::Update();
 
             for (auto layer : m_LayerStack)
                 layer->OnUpdate(ts);
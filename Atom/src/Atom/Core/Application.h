@@ -3,6 +3,7 @@
 #include "Events/Events.h"
 #include "LayerStack.h"
 #include "Timer.h"
+#include "ThreadPool.h"
 #include "Window.h"
 
 #include "Atom/ImGui/ImGuiLayer.h"
@@ -55,6 +56,7 @@ namespace Atom
         inline PipelineLibrary& GetPipelineLibrary() { return *m_PipelineLibrary; }
         inline Window& GetWindow() { return *m_Window; }
         inline ImGuiLayer& GetImGuiLayer() { return *m_ImGuiLayer; }
+        inline ThreadPool& GetWorkerThreadPool() { return *m_WorkerThreadPool; }
         inline u32 GetFPS() const { return m_FPS; }
         inline u32 GetCurrentFrameIndex() const { return m_Window->GetSwapChain()->GetCurrentBackBufferIndex(); }
 
@@ -74,6 +76,7 @@ namespace Atom
         Scope<PipelineLibrary>   m_PipelineLibrary;
         LayerStack               m_LayerStack;
         ImGuiLayer*              m_ImGuiLayer;
+        Scope<ThreadPool>        m_WorkerThreadPool;
         u32                      m_FPS = 0;
 
         Vector<std::function<void()>> m_MainThreadQueue;
@@ -0,0 +1,115 @@
+#include "atompch.h"
+#include "FileWatcher.h"
+
+namespace Atom
+{
+    // -----------------------------------------------------------------------------------------------------------------------------
+    FileWatcher::FileWatcher(const std::filesystem::path& directory, const Callback& callback, std::chrono::milliseconds debounceTime)
+        : m_Directory(directory), m_Callback(callback), m_DebounceTime(debounceTime)
+    {
+        m_DispatchThread = std::thread(&FileWatcher::DispatchLoop, this);
+        m_Watch = CreateScope<filewatch::FileWatch<std::filesystem::path>>(m_Directory, [this](const std::filesystem::path& path, const filewatch::Event event)
+        {
+            OnFileChanged(path, event);
+        });
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    FileWatcher::~FileWatcher()
+    {
+        // Stop the watcher first so that no events are queued while the dispatch thread shuts down. Pending changes are dropped.
+        m_Watch.reset();
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_ShouldTerminate = true;
+        }
+
+        m_EventCV.notify_all();
+        m_DispatchThread.join();
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void FileWatcher::OnFileChanged(const std::filesystem::path& path, filewatch::Event event)
+    {
+        FileChange change = FileChange::Modified;
+
+        switch (event)
+        {
+            case filewatch::Event::added:
+            case filewatch::Event::renamed_new: change = FileChange::Added; break;
+            case filewatch::Event::removed:
+            case filewatch::Event::renamed_old: change = FileChange::Removed; break;
+            case filewatch::Event::modified:    change = FileChange::Modified; break;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+
+            if (m_PendingChanges.empty())
+                m_FirstEventTime = now;
+
+            m_LastEventTime = now;
+
+            std::filesystem::path filepath = m_Directory / path;
+            auto it = m_PendingChanges.find(filepath);
+
+            if (it == m_PendingChanges.end())
+            {
+                m_PendingChanges[filepath] = change;
+            }
+            else if (change == FileChange::Removed)
+            {
+                // Files that were created and deleted within the same batch were never seen by the receiver
+                if (it->second == FileChange::Added)
+                    m_PendingChanges.erase(it);
+                else
+                    it->second = FileChange::Removed;
+            }
+            else if (it->second == FileChange::Removed)
+            {
+                // Files that are saved by replacing them show up as a removal followed by an addition
+                it->second = FileChange::Modified;
+            }
+        }
+
+        m_EventCV.notify_one();
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void FileWatcher::DispatchLoop()
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        while (true)
+        {
+            m_EventCV.wait(lock, [this]() { return m_ShouldTerminate || !m_PendingChanges.empty(); });
+
+            if (m_ShouldTerminate)
+                return;
+
+            // Wait until the directory was quiet for the debounce time. Every new event pushes the deadline back, up to the max latency.
+            auto deadline = std::min(m_LastEventTime + m_DebounceTime, m_FirstEventTime + MaxLatency);
+
+            if (std::chrono::steady_clock::now() < deadline)
+            {
+                m_EventCV.wait_until(lock, deadline, [this]() { return m_ShouldTerminate; });
+                continue;
+            }
+
+            Vector<FileChangeEvent> changes;
+            changes.reserve(m_PendingChanges.size());
+
+            for (auto& [filepath, change] : m_PendingChanges)
+                changes.push_back({ filepath, change });
+
+            m_PendingChanges.clear();
+
+            lock.unlock();
+            m_Callback(changes);
+            lock.lock();
+        }
+    }
+}
\ No newline at end of file
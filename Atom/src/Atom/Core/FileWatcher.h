@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Core.h"
+
+#include <FileWatch.h>
+
+namespace Atom
+{
+    enum class FileChange : u8
+    {
+        Added,
+        Modified,
+        Removed
+    };
+
+    struct FileChangeEvent
+    {
+        std::filesystem::path Filepath; // Absolute path of the changed file
+        FileChange            Change;
+    };
+
+    // Watches a directory recursively and reports the changes in batches. Raw events are queued by the watcher thread and coalesced
+    // per file, so a file that is written in many steps is reported once. A batch is dispatched once no new events arrived for the
+    // debounce time, or after MaxLatency if the directory keeps changing. The callback is invoked on the dispatch thread.
+    class FileWatcher
+    {
+    public:
+        using Callback = std::function<void(const Vector<FileChangeEvent>& changes)>;
+
+        static constexpr std::chrono::milliseconds DefaultDebounceTime = std::chrono::milliseconds(200);
+        static constexpr std::chrono::milliseconds MaxLatency = std::chrono::milliseconds(2000);
+    public:
+        FileWatcher(const std::filesystem::path& directory, const Callback& callback, std::chrono::milliseconds debounceTime = DefaultDebounceTime);
+        ~FileWatcher();
+
+        FileWatcher(const FileWatcher& rhs) = delete;
+        FileWatcher& operator=(const FileWatcher& rhs) = delete;
+
+        inline const std::filesystem::path& GetDirectory() const { return m_Directory; }
+    private:
+        void OnFileChanged(const std::filesystem::path& path, filewatch::Event event);
+        void DispatchLoop();
+    private:
+        std::filesystem::path                              m_Directory;
+        Callback                                           m_Callback;
+        std::chrono::milliseconds                          m_DebounceTime;
+        HashMap<std::filesystem::path, FileChange>         m_PendingChanges;
+        std::chrono::steady_clock::time_point              m_FirstEventTime;
+        std::chrono::steady_clock::time_point              m_LastEventTime;
+        std::mutex                                         m_Mutex;
+        std::condition_variable                            m_EventCV;
+        bool                                               m_ShouldTerminate = false;
+        std::thread                                        m_DispatchThread;
+        Scope<filewatch::FileWatch<std::filesystem::path>> m_Watch;
+    };
+}
\ No newline at end of file
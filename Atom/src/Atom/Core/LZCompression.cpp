@@ -0,0 +1,229 @@
+#include "atompch.h"
+#include "LZCompression.h"
+
+namespace Atom
+{
+    namespace Utils
+    {
+        static inline u32 Read32(const byte* data)
+        {
+            u32 value;
+            memcpy(&value, data, sizeof(u32));
+            return value;
+        }
+
+        static inline bool WriteLength(byte*& output, const byte* outputEnd, u64 length)
+        {
+            // Lengths that don't fit into the token nibble continue in bytes of 255 until a smaller byte ends them
+            for (; length >= 255; length -= 255)
+            {
+                if (output >= outputEnd)
+                    return false;
+
+                *output++ = 255;
+            }
+
+            if (output >= outputEnd)
+                return false;
+
+            *output++ = (byte)length;
+            return true;
+        }
+
+        static inline bool ReadLength(const byte*& input, const byte* inputEnd, u64& length)
+        {
+            byte value;
+            do
+            {
+                if (input >= inputEnd)
+                    return false;
+
+                value = *input++;
+                length += value;
+            } while (value == 255);
+
+            return true;
+        }
+
+        static inline bool WriteSequence(byte*& output, const byte* outputEnd, const byte* literals, u64 literalLength, u32 offset, u64 matchLength)
+        {
+            if (output >= outputEnd)
+                return false;
+
+            byte* token = output++;
+            *token = (byte)(std::min<u64>(literalLength, 15) << 4);
+
+            if (literalLength >= 15 && !WriteLength(output, outputEnd, literalLength - 15))
+                return false;
+
+            if (literalLength > (u64)(outputEnd - output))
+                return false;
+
+            memcpy(output, literals, literalLength);
+            output += literalLength;
+
+            // The last sequence only has literals
+            if (matchLength == 0)
+                return true;
+
+            if (outputEnd - output < 2)
+                return false;
+
+            *output++ = (byte)(offset & 0xFF);
+            *output++ = (byte)(offset >> 8);
+
+            u64 encodedMatchLength = matchLength - 4;
+            *token |= (byte)std::min<u64>(encodedMatchLength, 15);
+
+            if (encodedMatchLength >= 15 && !WriteLength(output, outputEnd, encodedMatchLength - 15))
+                return false;
+
+            return true;
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    u64 LZCompression::GetMaxCompressedSize(u64 size)
+    {
+        // Incompressible data is stored as a single run of literals
+        return size + size / 255 + 16;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    u64 LZCompression::Compress(const void* source, u64 sourceSize, void* destination, u64 destinationCapacity)
+    {
+        const byte* input = (const byte*)source;
+        const byte* inputEnd = input + sourceSize;
+        byte* output = (byte*)destination;
+        const byte* outputEnd = output + destinationCapacity;
+
+        // Most recent position of every hashed 4 byte sequence
+        Vector<u32> hashTable(1 << HashBits, 0);
+
+        const byte* literals = input;
+        const byte* position = input;
+
+        // Matches are only searched where a full 4 byte sequence can be read
+        const byte* matchLimit = sourceSize >= MinMatchLength ? inputEnd - MinMatchLength : input;
+
+        while (position < matchLimit)
+        {
+            u32 sequence = Utils::Read32(position);
+            u32 hash = (sequence * 2654435761u) >> (32 - HashBits);
+            const byte* candidate = input + hashTable[hash];
+            hashTable[hash] = (u32)(position - input);
+
+            if (candidate >= position || position - candidate > MaxOffset || Utils::Read32(candidate) != sequence)
+            {
+                // Skip ahead faster through data that doesn't compress
+                position += 1 + ((position - literals) >> 6);
+                continue;
+            }
+
+            // Extend the match backwards into the pending literals and forwards as far as it goes
+            while (position > literals && candidate > input && position[-1] == candidate[-1])
+            {
+                position--;
+                candidate--;
+            }
+
+            const byte* matchEnd = position + MinMatchLength;
+            const byte* candidateEnd = candidate + MinMatchLength;
+
+            while (matchEnd < inputEnd && *matchEnd == *candidateEnd)
+            {
+                matchEnd++;
+                candidateEnd++;
+            }
+
+            if (!Utils::WriteSequence(output, outputEnd, literals, position - literals, (u32)(position - candidate), matchEnd - position))
+                return 0;
+
+            position = matchEnd;
+            literals = position;
+
+            if (position - 2 > input && position < matchLimit)
+            {
+                const byte* previous = position - 2;
+                hashTable[(Utils::Read32(previous) * 2654435761u) >> (32 - HashBits)] = (u32)(previous - input);
+            }
+        }
+
+        if (!Utils::WriteSequence(output, outputEnd, literals, inputEnd - literals, 0, 0))
+            return 0;
+
+        return output - (byte*)destination;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool LZCompression::Decompress(const void* source, u64 sourceSize, void* destination, u64 destinationSize)
+    {
+        const byte* input = (const byte*)source;
+        const byte* inputEnd = input + sourceSize;
+        byte* outputStart = (byte*)destination;
+        byte* output = outputStart;
+        byte* outputEnd = output + destinationSize;
+
+        while (input < inputEnd)
+        {
+            byte token = *input++;
+
+            // Literals
+            u64 literalLength = token >> 4;
+            if (literalLength == 15 && !Utils::ReadLength(input, inputEnd, literalLength))
+                return false;
+
+            if (literalLength > (u64)(inputEnd - input) || literalLength > (u64)(outputEnd - output))
+                return false;
+
+            memcpy(output, input, literalLength);
+            input += literalLength;
+            output += literalLength;
+
+            // The last sequence ends with its literals
+            if (input == inputEnd)
+                break;
+
+            // Match
+            if (inputEnd - input < 2)
+                return false;
+
+            u32 offset = input[0] | (input[1] << 8);
+            input += 2;
+
+            u64 matchLength = token & 0xF;
+            if (matchLength == 15 && !Utils::ReadLength(input, inputEnd, matchLength))
+                return false;
+
+            matchLength += MinMatchLength;
+
+            if (offset == 0 || offset > (u64)(output - outputStart) || matchLength > (u64)(outputEnd - output))
+                return false;
+
+            const byte* match = output - offset;
+
+            if (offset >= matchLength)
+            {
+                memcpy(output, match, matchLength);
+                output += matchLength;
+            }
+            else
+            {
+                // The match overlaps the data it is written to and repeats its first offset bytes. Once they are written, the output is
+                // copied onto itself in doubling steps that stay multiples of the offset, so no copy overlaps.
+                memcpy(output, match, offset);
+
+                for (u64 copied = offset; copied < matchLength;)
+                {
+                    u64 size = std::min(copied, matchLength - copied);
+                    memcpy(output + copied, output, size);
+                    copied += size;
+                }
+
+                output += matchLength;
+            }
+        }
+
+        return output == outputEnd;
+    }
+}
\ No newline at end of file
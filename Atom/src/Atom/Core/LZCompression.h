@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Atom/Core/Core.h"
+
+namespace Atom
+{
+    // Byte oriented LZ77 codec with the sequence layout of LZ4. Each sequence is a token with the literal and match lengths, followed by
+    // the literals, a 16 bit match offset and the remaining match length. There is no entropy coding, so decoding is little more than
+    // copying memory. Blocks are independent of each other and can be decoded in parallel.
+    class LZCompression
+    {
+    public:
+        static u64 GetMaxCompressedSize(u64 size);
+
+        // Returns the size of the compressed data or 0 if it does not fit into the destination
+        static u64 Compress(const void* source, u64 sourceSize, void* destination, u64 destinationCapacity);
+
+        // The destination size has to be the exact size of the decompressed data. Fails on malformed data without reading or writing
+        // outside of the buffers.
+        static bool Decompress(const void* source, u64 sourceSize, void* destination, u64 destinationSize);
+    private:
+        static constexpr u32 MinMatchLength = 4;
+        static constexpr u32 MaxOffset = 65535;
+        static constexpr u32 HashBits = 14;
+    };
+}
\ No newline at end of file
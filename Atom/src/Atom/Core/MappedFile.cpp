@@ -0,0 +1,39 @@
+#include "atompch.h"
+#include "MappedFile.h"
+
+namespace Atom
+{
+    // -----------------------------------------------------------------------------------------------------------------------------
+    MappedFile::MappedFile(const std::filesystem::path& filepath)
+    {
+        m_FileHandle = CreateFileW(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+        if (m_FileHandle == INVALID_HANDLE_VALUE)
+            return;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(m_FileHandle, &fileSize) || fileSize.QuadPart == 0)
+            return;
+
+        m_MappingHandle = CreateFileMappingW(m_FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (!m_MappingHandle)
+            return;
+
+        m_Data = (const byte*)MapViewOfFile(m_MappingHandle, FILE_MAP_READ, 0, 0, 0);
+        m_Size = m_Data ? fileSize.QuadPart : 0;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    MappedFile::~MappedFile()
+    {
+        if (m_Data)
+            UnmapViewOfFile(m_Data);
+
+        if (m_MappingHandle)
+            CloseHandle(m_MappingHandle);
+
+        if (m_FileHandle != INVALID_HANDLE_VALUE)
+            CloseHandle(m_FileHandle);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Core.h"
+
+namespace Atom
+{
+    // Read only view of a whole file mapped into the address space of the process. The view starts at a page boundary, so offsets
+    // aligned in the file are aligned in memory as well.
+    class MappedFile
+    {
+    public:
+        MappedFile(const std::filesystem::path& filepath);
+        ~MappedFile();
+
+        MappedFile(const MappedFile& rhs) = delete;
+        MappedFile& operator=(const MappedFile& rhs) = delete;
+
+        inline bool IsValid() const { return m_Data != nullptr; }
+        inline const byte* GetData() const { return m_Data; }
+        inline u64 GetSize() const { return m_Size; }
+
+        // Returns whether the range [offset, offset + size) lies within the file
+        inline bool Contains(u64 offset, u64 size) const { return offset <= m_Size && size <= m_Size - offset; }
+    private:
+        HANDLE      m_FileHandle = INVALID_HANDLE_VALUE;
+        HANDLE      m_MappingHandle = nullptr;
+        const byte* m_Data = nullptr;
+        u64         m_Size = 0;
+    };
+}
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include "atompch.h"
 #include "ThreadPool.h"
 
+#include <atomic>
+
 namespace Atom
 {
     // -----------------------------------------------------------------------------------------------------------------------------
@@ -54,6 +56,58 @@ namespace Atom
         m_TaskQueueCV.notify_one();
     }
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void ThreadPool::ParallelFor(u32 count, u32 batchSize, const std::function<void(u32 begin, u32 end)>& function)
+    {
+        if (count == 0)
+            return;
+
+        batchSize = std::max(batchSize, 1u);
+        u32 batchCount = (count + batchSize - 1) / batchSize;
+
+        if (batchCount == 1 || m_TaskThreads.empty())
+        {
+            function(0, count);
+            return;
+        }
+
+        // The state is shared with the enqueued tasks since some of them may only start after all batches are already done
+        struct ParallelForState
+        {
+            std::atomic<u32>        NextBatch = 0;
+            std::atomic<u32>        CompletedBatches = 0;
+            std::mutex              CompletionMutex;
+            std::condition_variable CompletionCV;
+        };
+
+        Ref<ParallelForState> state = CreateRef<ParallelForState>();
+
+        auto processBatches = [state, count, batchSize, batchCount, &function]()
+        {
+            u32 batchIdx;
+            while ((batchIdx = state->NextBatch.fetch_add(1)) < batchCount)
+            {
+                u32 begin = batchIdx * batchSize;
+                function(begin, std::min(begin + batchSize, count));
+
+                if (state->CompletedBatches.fetch_add(1) + 1 == batchCount)
+                {
+                    std::unique_lock<std::mutex> lock(state->CompletionMutex);
+                    state->CompletionCV.notify_all();
+                }
+            }
+        };
+
+        u32 helperCount = std::min(batchCount - 1, (u32)m_TaskThreads.size());
+        for (u32 i = 0; i < helperCount; i++)
+            EnqueueTask(processBatches);
+
+        processBatches();
+
+        std::unique_lock<std::mutex> lock(state->CompletionMutex);
+        state->CompletionCV.wait(lock, [&state, batchCount]() { return state->CompletedBatches == batchCount; });
+    }
+
     // -----------------------------------------------------------------------------------------------------------------------------
     void ThreadPool::TheadLoop()
     {
@@ -13,6 +13,9 @@ namespace Atom
         void Start();
         void Stop();
         void EnqueueTask(const std::function<void()>& task);
+
+        // Splits [0, count) into batches which are processed by the worker threads and the calling thread. Blocks until all batches are done.
+        void ParallelFor(u32 count, u32 batchSize, const std::function<void(u32 begin, u32 end)>& function);
         inline u32 GetThreadCount() const { return m_ThreadCount; }
     private:
         void TheadLoop();
@@ -23,6 +23,6 @@ namespace Atom
     void Timer::Stop()
     {
         auto endPoint = std::chrono::steady_clock::now();
-        m_ElapsedTime = std::chrono::duration_cast<std::chrono::milliseconds>(endPoint - m_Start).count();
+        m_ElapsedTime = std::chrono::duration<f32, std::milli>(endPoint - m_Start).count();
     }
 }
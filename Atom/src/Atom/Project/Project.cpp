@@ -3,8 +3,10 @@
 
 #include "Atom/Project/ProjectSerializer.h"
 #include "Atom/Asset/AssetManager.h"
+#include "Atom/Asset/AssetPack.h"
 #include "Atom/Scripting/ScriptEngine.h"
 #include "Atom/Tools/ContentTools.h"
+#include "Atom/Tools/DerivedDataCache.h"
 
 namespace Atom
 {
@@ -30,6 +32,7 @@ namespace Atom
 
         SaveActiveProject();
 
+        DerivedDataCache::SetDirectory(ms_ActiveProject->m_ProjectDirectory / ms_ActiveProject->m_Settings.DerivedDataCacheDirectory);
         AssetManager::Initialize(assetsDirAbsolutePath);
         ScriptEngine::Initialize(scriptsDirAbsolutePath);
 
@@ -39,7 +42,7 @@ namespace Atom
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    Ref<Project> Project::OpenProject(const std::filesystem::path& filepath)
+    Ref<Project> Project::OpenProject(const std::filesystem::path& filepath, bool useAssetPack)
     {
         Ref<Project> newProject = CreateRef<Project>();
         ProjectSerializer serializer(newProject);
@@ -50,12 +53,25 @@ namespace Atom
         newProject->m_ProjectDirectory = filepath.parent_path();
         ms_ActiveProject = newProject;
 
-        AssetManager::Initialize(ms_ActiveProject->m_ProjectDirectory / ms_ActiveProject->m_Settings.AssetsDirectory);
+        std::filesystem::path assetsDirAbsolutePath = ms_ActiveProject->m_ProjectDirectory / ms_ActiveProject->m_Settings.AssetsDirectory;
+        std::filesystem::path assetPackPath = ms_ActiveProject->GetAssetPackPath();
+
+        DerivedDataCache::SetDirectory(ms_ActiveProject->m_ProjectDirectory / ms_ActiveProject->m_Settings.DerivedDataCacheDirectory);
+
+        if (!useAssetPack || !std::filesystem::exists(assetPackPath) || !AssetManager::Initialize(assetsDirAbsolutePath, { assetPackPath }))
+            AssetManager::Initialize(assetsDirAbsolutePath);
+
         ScriptEngine::Initialize(ms_ActiveProject->m_ProjectDirectory / ms_ActiveProject->m_Settings.ScriptsDirectory);
 
         return ms_ActiveProject;
     }
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    std::filesystem::path Project::GetAssetPackPath() const
+    {
+        return m_ProjectDirectory / (m_Settings.Name + AssetPack::FileExtension);
+    }
+
     // -----------------------------------------------------------------------------------------------------------------------------
     bool Project::SaveActiveProject()
     {
@@ -11,6 +11,7 @@ namespace Atom
         std::filesystem::path StartScenePath;
         std::filesystem::path AssetsDirectory;
         std::filesystem::path ScriptsDirectory;
+        std::filesystem::path DerivedDataCacheDirectory = "DerivedDataCache"; // Relative to the project directory or absolute to share it between projects
     };
 
     class Project
@@ -18,9 +19,10 @@ namespace Atom
     public:
         inline ProjectSettings& GetSettings() { return m_Settings; }
         inline const std::filesystem::path& GetProjectDirectory() { return m_ProjectDirectory; }
+        std::filesystem::path GetAssetPackPath() const;
     public:
         static Ref<Project> NewProject(const String& name, const String& startSceneName, const std::filesystem::path& projectLocation);
-        static Ref<Project> OpenProject(const std::filesystem::path& filepath);
+        static Ref<Project> OpenProject(const std::filesystem::path& filepath, bool useAssetPack = false); // Loads the assets from the asset pack of the project if it exists
         static bool SaveActiveProject();
         static Ref<Project> GetActiveProject();
     private:
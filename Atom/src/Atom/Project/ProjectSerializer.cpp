@@ -25,6 +25,7 @@ namespace Atom
             out << YAML::Key << "StartScenePath" << YAML::Value << settings.StartScenePath.string();
             out << YAML::Key << "AssetsDirectory" << YAML::Value << settings.AssetsDirectory.string();
             out << YAML::Key << "ScriptsDirectory" << YAML::Value << settings.ScriptsDirectory.string();
+            out << YAML::Key << "DerivedDataCacheDirectory" << YAML::Value << settings.DerivedDataCacheDirectory.string();
             out << YAML::EndMap;
         }
         out << YAML::EndMap;
@@ -55,6 +56,10 @@ namespace Atom
         settings.AssetsDirectory = projectNode["AssetsDirectory"].as<String>();
         settings.ScriptsDirectory = projectNode["ScriptsDirectory"].as<String>();
 
+        // Projects created before the derived data cache keep the default directory
+        if (projectNode["DerivedDataCacheDirectory"])
+            settings.DerivedDataCacheDirectory = projectNode["DerivedDataCacheDirectory"].as<String>();
+
         return true;
     }
 
@@ -7,6 +7,7 @@
 
 #include "Atom/Renderer/CommandQueue.h"
 #include "Atom/Renderer/EngineResources.h"
+#include "Atom/Renderer/TextureStreamer.h"
 
 #include "Atom/Renderer/RenderPasses/SkyBoxPass.h"
 #include "Atom/Renderer/RenderPasses/GeometryPass.h"
@@ -110,6 +111,7 @@ namespace Atom
             return;
 
         u32 currentFrameIdx = Application::Get().GetCurrentFrameIndex();
+        f32 screenSize = CalculateScreenSize(mesh, transform);
 
         const auto& submeshes = mesh->GetSubmeshes();
         for (u32 submeshIdx = 0; submeshIdx < submeshes.size(); submeshIdx++)
@@ -123,16 +125,23 @@ namespace Atom
             meshEntry.SubmeshIndex = submeshIdx;
             meshEntry.Transform = transform;
             meshEntry.Material = material ? material : EngineResources::ErrorMaterial;
+
+            if (material)
+            {
+                for (auto& [_, texture] : material->GetTextures())
+                    TextureStreamer::ReportTextureUsage(texture, screenSize);
+            }
         }
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    void Renderer::SubmitAnimatedMesh(const Ref<Mesh>& mesh, const glm::mat4& transform, const Ref<MaterialTable>& materialTable, const Ref<Skeleton>& skeleton)
+    void Renderer::SubmitAnimatedMesh(const Ref<Mesh>& mesh, const glm::mat4& transform, const Ref<MaterialTable>& materialTable, const Vector<glm::mat4>& boneTransforms)
     {
-        if (!mesh || !skeleton)
+        if (!mesh || boneTransforms.empty())
             return;
 
         u32 currentFrameIdx = Application::Get().GetCurrentFrameIndex();
+        f32 screenSize = CalculateScreenSize(mesh, transform);
 
         // Submit draw command for each submesh
         const auto& submeshes = mesh->GetSubmeshes();
@@ -147,12 +156,17 @@ namespace Atom
             meshEntry.SubmeshIndex = submeshIdx;
             meshEntry.Transform = transform;
             meshEntry.Material = material ? material : EngineResources::ErrorMaterialAnimated;
+
+            if (material)
+            {
+                for (auto& [_, texture] : material->GetTextures())
+                    TextureStreamer::ReportTextureUsage(texture, screenSize);
+            }
             meshEntry.BoneTransformOffset = m_FrameData.BoneTransforms.size();
         }
 
         // Set all bone transforms
-        for (auto& bone : skeleton->GetBones())
-            m_FrameData.BoneTransforms.push_back(bone.AnimatedTransform);
+        m_FrameData.BoneTransforms.insert(m_FrameData.BoneTransforms.end(), boneTransforms.begin(), boneTransforms.end());
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
@@ -208,6 +222,15 @@ namespace Atom
             }
         }
 
+        if (TextureStreamer::IsEnabled() && ImGui::CollapsingHeader("Texture Streaming"))
+        {
+            TextureStreamingStats stats = TextureStreamer::GetStats();
+            ImGui::Text("Textures: %u", stats.TextureCount);
+            ImGui::Text("Resident: %.1f / %.1f MB", stats.ResidentMemory / (1024.0f * 1024.0f), stats.MemoryBudget / (1024.0f * 1024.0f));
+            ImGui::Text("Pending: %.1f MB (%u requests)", stats.PendingMemory / (1024.0f * 1024.0f), stats.PendingRequests);
+            ImGui::Text("Total requests: %llu, evictions: %llu", stats.TotalRequests, stats.TotalEvictions);
+        }
+
         ImGui::End();
     }
 
@@ -225,6 +248,26 @@ namespace Atom
         return (Texture*)finalOutput->GetHWResource();
     }
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    f32 Renderer::CalculateScreenSize(const Ref<Mesh>& mesh, const glm::mat4& transform) const
+    {
+        if (!mesh->HasBounds())
+            return FLT_MAX;
+
+        // Projected diameter of the bounding sphere in pixels
+        glm::vec3 center = transform * glm::vec4((mesh->GetBoundsMin() + mesh->GetBoundsMax()) * 0.5f, 1.0f);
+        f32 maxScale = glm::max(glm::length(glm::vec3(transform[0])), glm::max(glm::length(glm::vec3(transform[1])), glm::length(glm::vec3(transform[2]))));
+        f32 radius = glm::length(mesh->GetBoundsMax() - mesh->GetBoundsMin()) * 0.5f * maxScale;
+        f32 projectionScale = m_FrameData.ProjectionMatrix[1][1] * m_FrameData.ViewportHeight;
+
+        // Orthographic projections don't depend on the distance
+        if (m_FrameData.ProjectionMatrix[3][3] == 1.0f)
+            return radius * projectionScale;
+
+        f32 distance = glm::length(center - m_FrameData.CameraPosition);
+        return distance > radius ? radius / distance * projectionScale : FLT_MAX;
+    }
+
     // -----------------------------------------------------------------------------------------------------------------------------
     void Renderer::BuildRenderPasses()
     {
@@ -671,29 +714,20 @@ namespace Atom
     {
         if (srcData)
         {
-            u32 bufferSize = GetRequiredIntermediateSize(buffer->GetD3DResource().Get(), 0, 1);
-            CD3DX12_RESOURCE_DESC resourceDesc = CD3DX12_RESOURCE_DESC::Buffer(bufferSize);
-
-            ComPtr<ID3D12Resource> uploadBuffer = nullptr;
-            DXCall(Device::Get().GetD3DDevice()->CreateCommittedResource(&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD), D3D12_HEAP_FLAG_NONE, &resourceDesc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&uploadBuffer)));
-
-#if defined (ATOM_DEBUG)
-            DXCall(uploadBuffer->SetName(L"Upload Buffer"));
-#endif
             D3D12_SUBRESOURCE_DATA subresourceData = {};
             subresourceData.pData = srcData;
             subresourceData.RowPitch = buffer->GetSize();
             subresourceData.SlicePitch = subresourceData.RowPitch;
 
-            CommandQueue* copyQueue = Device::Get().GetCommandQueue(CommandQueueType::Copy);
-            Ref<CommandBuffer> copyCommandBuffer = copyQueue->GetCommandBuffer();
-            copyCommandBuffer->Begin();
-            copyCommandBuffer->TransitionResource(buffer.get(), ResourceState::CopyDestination);
-            copyCommandBuffer->CommitBarriers();
-            UpdateSubresources<1>(copyCommandBuffer->GetCommandList().Get(), buffer->GetD3DResource().Get(), uploadBuffer.Get(), 0, 0, 1, &subresourceData);
-            copyCommandBuffer->End();
-            copyQueue->ExecuteCommandList(copyCommandBuffer);
-            copyQueue->Flush();
+            if (ms_UploadBatch)
+            {
+                RecordUpload(*ms_UploadBatch, buffer, 0, true, subresourceData);
+                return;
+            }
+
+            GPUUploadBatch uploadBatch;
+            RecordUpload(uploadBatch, buffer, 0, true, subresourceData);
+            SubmitUploadBatches({ &uploadBatch });
         }
     }
 
@@ -703,17 +737,6 @@ namespace Atom
         if (srcData)
         {
             u32 subresourceIdx = Texture::CalculateSubresource(mip, slice, texture->GetMipLevels(), texture->GetArraySize());
-            u32 bufferSize = GetRequiredIntermediateSize(texture->GetD3DResource().Get(), subresourceIdx, 1);
-            CD3DX12_RESOURCE_DESC resourceDesc = CD3DX12_RESOURCE_DESC::Buffer(bufferSize);
-
-            CD3DX12_HEAP_PROPERTIES heapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
-            ComPtr<ID3D12Resource> uploadBuffer = nullptr;
-            DXCall(Device::Get().GetD3DDevice()->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &resourceDesc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&uploadBuffer)));
-
-#if defined (ATOM_DEBUG)
-            DXCall(uploadBuffer->SetName(L"Upload Buffer"));
-#endif
-
             u32 width = glm::max(texture->GetWidth() >> mip, 1u);
             u32 height = glm::max(texture->GetHeight() >> mip, 1u);
 
@@ -722,15 +745,15 @@ namespace Atom
             subresourceData.RowPitch = ((width * Utils::GetTextureFormatSize(texture->GetFormat()) + 255) / 256) * 256;
             subresourceData.SlicePitch = height * subresourceData.RowPitch;
 
-            CommandQueue* copyQueue = Device::Get().GetCommandQueue(CommandQueueType::Copy);
-            Ref<CommandBuffer> copyCommandBuffer = copyQueue->GetCommandBuffer();
-            copyCommandBuffer->Begin();
-            copyCommandBuffer->TransitionResource(texture.get(), ResourceState::CopyDestination);
-            copyCommandBuffer->CommitBarriers();
-            UpdateSubresources<1>(copyCommandBuffer->GetCommandList().Get(), texture->GetD3DResource().Get(), uploadBuffer.Get(), 0, subresourceIdx, 1, &subresourceData);
-            copyCommandBuffer->End();
-            copyQueue->ExecuteCommandList(copyCommandBuffer);
-            copyQueue->Flush();
+            if (ms_UploadBatch)
+            {
+                RecordUpload(*ms_UploadBatch, texture, subresourceIdx, false, subresourceData);
+                return;
+            }
+
+            GPUUploadBatch uploadBatch;
+            RecordUpload(uploadBatch, texture, subresourceIdx, false, subresourceData);
+            SubmitUploadBatches({ &uploadBatch });
         }
     }
 
@@ -787,4 +810,92 @@ namespace Atom
         ATOM_ENGINE_ASSERT(false);
         return EngineResources::LinearClampSampler;
     }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    GPUUploadBatch* Renderer::SetUploadBatch(GPUUploadBatch* batch)
+    {
+        GPUUploadBatch* previousBatch = ms_UploadBatch;
+        ms_UploadBatch = batch;
+        return previousBatch;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void Renderer::SubmitUploadBatches(const Vector<GPUUploadBatch*>& batches)
+    {
+        bool hasUploads = false;
+        for (GPUUploadBatch* batch : batches)
+            hasUploads |= !batch->Uploads.empty();
+
+        if (!hasUploads)
+            return;
+
+        CommandQueue* copyQueue = Device::Get().GetCommandQueue(CommandQueueType::Copy);
+        Ref<CommandBuffer> copyCommandBuffer = copyQueue->GetCommandBuffer();
+        copyCommandBuffer->Begin();
+
+        for (GPUUploadBatch* batch : batches)
+        {
+            for (auto& upload : batch->Uploads)
+                copyCommandBuffer->TransitionResource(upload.Resource.get(), ResourceState::CopyDestination);
+        }
+
+        copyCommandBuffer->CommitBarriers();
+
+        for (GPUUploadBatch* batch : batches)
+        {
+            for (auto& upload : batch->Uploads)
+            {
+                ID3D12Resource* dstResource = upload.Resource->GetD3DResource().Get();
+
+                if (upload.IsBuffer)
+                {
+                    copyCommandBuffer->GetCommandList()->CopyBufferRegion(dstResource, 0, upload.UploadBuffer.Get(), upload.Footprint.Offset, upload.Footprint.Footprint.Width);
+                }
+                else
+                {
+                    CD3DX12_TEXTURE_COPY_LOCATION dstLocation(dstResource, upload.Subresource);
+                    CD3DX12_TEXTURE_COPY_LOCATION srcLocation(upload.UploadBuffer.Get(), upload.Footprint);
+                    copyCommandBuffer->GetCommandList()->CopyTextureRegion(&dstLocation, 0, 0, 0, &srcLocation, nullptr);
+                }
+            }
+        }
+
+        copyCommandBuffer->End();
+        copyQueue->ExecuteCommandList(copyCommandBuffer);
+        copyQueue->Flush();
+
+        for (GPUUploadBatch* batch : batches)
+            batch->Uploads.clear();
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void Renderer::RecordUpload(GPUUploadBatch& batch, const Ref<HWResource>& resource, u32 subresource, bool isBuffer, const D3D12_SUBRESOURCE_DATA& subresourceData)
+    {
+        auto& upload = batch.Uploads.emplace_back();
+        upload.Resource = resource;
+        upload.Subresource = subresource;
+        upload.IsBuffer = isBuffer;
+
+        // Creating resources and writing to mapped memory is free threaded, only the copy commands have to wait for the render thread
+        D3D12_RESOURCE_DESC resourceDesc = resource->GetD3DResource()->GetDesc();
+        u32 rowCount;
+        u64 rowSize, uploadBufferSize;
+        Device::Get().GetD3DDevice()->GetCopyableFootprints(&resourceDesc, subresource, 1, 0, &upload.Footprint, &rowCount, &rowSize, &uploadBufferSize);
+
+        CD3DX12_HEAP_PROPERTIES heapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
+        CD3DX12_RESOURCE_DESC uploadBufferDesc = CD3DX12_RESOURCE_DESC::Buffer(uploadBufferSize);
+        DXCall(Device::Get().GetD3DDevice()->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &uploadBufferDesc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&upload.UploadBuffer)));
+
+#if defined (ATOM_DEBUG)
+        DXCall(upload.UploadBuffer->SetName(L"Upload Buffer"));
+#endif
+
+        byte* mappedData = nullptr;
+        DXCall(upload.UploadBuffer->Map(0, nullptr, (void**)&mappedData));
+
+        D3D12_MEMCPY_DEST dstData = { mappedData + upload.Footprint.Offset, upload.Footprint.Footprint.RowPitch, SIZE_T(upload.Footprint.Footprint.RowPitch) * rowCount };
+        MemcpySubresource(&dstData, &subresourceData, rowSize, rowCount, upload.Footprint.Footprint.Depth);
+
+        upload.UploadBuffer->Unmap(0, nullptr);
+    }
 }
\ No newline at end of file
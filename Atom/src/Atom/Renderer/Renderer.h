@@ -44,6 +44,22 @@ namespace Atom
         u32           BoneTransformOffset = UINT32_MAX;
     };
 
+    // Copies recorded by the upload functions while the batch is bound to the calling thread. The source data is written to the upload
+    // buffers right away so that only the copy commands are left for the render thread.
+    struct GPUUploadBatch
+    {
+        struct Upload
+        {
+            Ref<HWResource>                    Resource;
+            u32                                Subresource = 0;
+            bool                               IsBuffer = false;
+            ComPtr<ID3D12Resource>             UploadBuffer;
+            D3D12_PLACED_SUBRESOURCE_FOOTPRINT Footprint = {};
+        };
+
+        Vector<Upload> Uploads;
+    };
+
     struct RendererSpecification
     {
         bool RenderToSwapChain = false;
@@ -81,7 +97,7 @@ namespace Atom
         void SubmitPointLight(const glm::vec3& color, const glm::vec3& position, f32 intensity, const glm::vec3& attenuationFactors);
         void SubmitSpotLight(const glm::vec3& color, const glm::vec3& position, const glm::vec3& direction, f32 intensity, f32 coneAngle, const glm::vec3& attenuationFactors);
         void SubmitMesh(const Ref<Mesh>& mesh, const glm::mat4& transform, const Ref<MaterialTable>& materialTable);
-        void SubmitAnimatedMesh(const Ref<Mesh>& mesh, const glm::mat4& transform, const Ref<MaterialTable>& materialTable, const Ref<Skeleton>& skeleton);
+        void SubmitAnimatedMesh(const Ref<Mesh>& mesh, const glm::mat4& transform, const Ref<MaterialTable>& materialTable, const Vector<glm::mat4>& boneTransforms);
         void SetViewportSize(u32 width, u32 height);
         void Render();
 
@@ -97,7 +113,17 @@ namespace Atom
         static void UploadTextureData(Ref<Texture> texture, const void* srcData, u32 mip = 0, u32 slice = 0);
         static Ref<ReadbackBuffer> ReadbackTextureData(Ref<Texture> texture, u32 mip = 0, u32 slice = 0);
         static Ref<TextureSampler> GetSampler(TextureFilter filter, TextureWrap wrap);
+
+        // Binds the batch on the calling thread. Uploads are recorded into it instead of being executed until another batch is bound.
+        // Returns the previously bound batch.
+        static GPUUploadBatch* SetUploadBatch(GPUUploadBatch* batch);
+
+        // Executes the copies of all batches with a single command list and waits for them. Has to be called on the render thread.
+        static void SubmitUploadBatches(const Vector<GPUUploadBatch*>& batches);
     private:
+        static void RecordUpload(GPUUploadBatch& batch, const Ref<HWResource>& resource, u32 subresource, bool isBuffer, const D3D12_SUBRESOURCE_DATA& subresourceData);
+    private:
+        f32 CalculateScreenSize(const Ref<Mesh>& mesh, const glm::mat4& transform) const;
         void BuildRenderPasses();
         void UpdateFrameGPUBuffers();
         void RecordCommandBuffers();
@@ -111,6 +137,7 @@ namespace Atom
         ResourceScheduler     m_ResourceSchedulers[g_FramesInFlight];
         RenderGraph           m_RenderGraph;
         RendererFrameData     m_FrameData;
-        
+
+        inline static thread_local GPUUploadBatch* ms_UploadBatch = nullptr;
     };
 }
\ No newline at end of file
@@ -0,0 +1,255 @@
+#include "atompch.h"
+#include "TextureStreamer.h"
+
+#include "Atom/Asset/AssetFile.h"
+
+namespace Atom
+{
+    // Forwards the decisions of the residency manager to the streaming thread
+    class GPUTextureStreamingBackend : public TextureStreamingBackend
+    {
+    public:
+        virtual void LoadMips(u32 textureID, u32 firstMip) override
+        {
+            TextureStreamer::RequestMips(textureID, firstMip, true);
+        }
+
+        virtual void EvictMips(u32 textureID, u32 firstMip) override
+        {
+            TextureStreamer::RequestMips(textureID, firstMip, false);
+        }
+    };
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void TextureStreamer::Initialize(const TextureStreamingSettings& settings)
+    {
+        ms_Settings = settings;
+        ms_Backend = CreateScope<GPUTextureStreamingBackend>();
+        ms_ResidencyManager = CreateScope<TextureResidencyManager>(ms_Settings, *ms_Backend);
+
+        ms_StreamingThreadPool = CreateScope<ThreadPool>(1);
+        ms_StreamingThreadPool->Start();
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void TextureStreamer::Shutdown()
+    {
+        if (ms_StreamingThreadPool)
+        {
+            ms_StreamingThreadPool->Stop();
+            ms_StreamingThreadPool.reset();
+        }
+
+        ms_ResidencyManager.reset();
+        ms_Backend.reset();
+        ms_Textures.clear();
+        ms_PendingRegistrations.clear();
+        ms_CompletedRequests.clear();
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool TextureStreamer::IsEnabled()
+    {
+        return ms_ResidencyManager != nullptr;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void TextureStreamer::Update()
+    {
+        if (!IsEnabled())
+            return;
+
+        Vector<PendingRegistration> registrations;
+        Vector<Scope<CompletedRequest>> completedRequests;
+
+        {
+            std::lock_guard<std::mutex> lock(ms_Mutex);
+            registrations.swap(ms_PendingRegistrations);
+            completedRequests.swap(ms_CompletedRequests);
+        }
+
+        for (auto& registration : registrations)
+        {
+            Ref<Texture2D> asset = registration.Asset.lock();
+
+            if (!asset)
+                continue;
+
+            u32 textureID = ms_ResidencyManager->AddTexture(registration.MipSizes, registration.TailMip, asset->m_ResidentMip);
+
+            if (textureID >= ms_Textures.size())
+                ms_Textures.resize(textureID + 1);
+
+            StreamedTexture& texture = ms_Textures[textureID];
+            texture.Asset = asset;
+            texture.Generation++;
+            texture.IsRegistered = true;
+            asset->m_StreamingID = textureID;
+        }
+
+        if (!completedRequests.empty())
+        {
+            // Copies of all requests that finished since the last update go out with a single command list
+            Vector<GPUUploadBatch*> uploadBatches;
+            uploadBatches.reserve(completedRequests.size());
+
+            for (auto& request : completedRequests)
+                uploadBatches.push_back(request->Uploads.get());
+
+            Renderer::SubmitUploadBatches(uploadBatches);
+
+            for (auto& request : completedRequests)
+            {
+                StreamedTexture& texture = ms_Textures[request->TextureID];
+                bool isCurrent = texture.IsRegistered && texture.Generation == request->Generation;
+
+                if (isCurrent && request->Resource)
+                {
+                    if (Ref<Texture2D> asset = texture.Asset.lock())
+                    {
+                        asset->m_TextureResource = request->Resource;
+                        asset->m_ResidentMip = request->FirstMip;
+                    }
+                }
+
+                // Failed loads are reported without new mips so that the request slot is freed
+                if (request->IsLoad)
+                    ms_ResidencyManager->OnMipsLoaded(request->TextureID, isCurrent && request->Resource ? request->FirstMip : UINT32_MAX);
+            }
+        }
+
+        // Release the slots of textures that were unloaded
+        for (u32 textureID = 0; textureID < ms_Textures.size(); textureID++)
+        {
+            StreamedTexture& texture = ms_Textures[textureID];
+
+            if (texture.IsRegistered && texture.Asset.expired())
+            {
+                ms_ResidencyManager->RemoveTexture(textureID);
+                texture.Asset.reset();
+                texture.Generation++;
+                texture.IsRegistered = false;
+            }
+        }
+
+        ms_ResidencyManager->Update();
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void TextureStreamer::RegisterTexture(const Ref<Texture2D>& texture, const Vector<u64>& mipSizes, u32 tailMip)
+    {
+        std::lock_guard<std::mutex> lock(ms_Mutex);
+        ms_PendingRegistrations.push_back({ texture, mipSizes, tailMip });
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void TextureStreamer::ReportTextureUsage(const Ref<TextureAsset>& texture, f32 screenSize)
+    {
+        if (!IsEnabled() || !texture || texture->m_StreamingID == UINT32_MAX)
+            return;
+
+        // One texel per pixel when the texture covers the object once
+        f32 textureSize = std::max(texture->GetWidth(), texture->GetHeight());
+        f32 desiredMip = screenSize > 0.0f ? glm::log2(textureSize / screenSize) + ms_Settings.MipBias : FLT_MAX;
+        desiredMip = glm::clamp(desiredMip, 0.0f, texture->GetMipLevels() - 1.0f);
+
+        ms_ResidencyManager->ReportUsage(texture->m_StreamingID, (u32)desiredMip);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void TextureStreamer::SetMemoryBudget(u64 budget)
+    {
+        ms_Settings.MemoryBudget = budget;
+
+        if (IsEnabled())
+            ms_ResidencyManager->SetMemoryBudget(budget);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    TextureStreamingStats TextureStreamer::GetStats()
+    {
+        return IsEnabled() ? ms_ResidencyManager->GetStats() : TextureStreamingStats();
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    const TextureStreamingSettings& TextureStreamer::GetSettings()
+    {
+        return ms_Settings;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    u32 TextureStreamer::GetTailMip(u32 width, u32 height, u32 mipLevels)
+    {
+        u32 tailMip = 0;
+        while (tailMip < mipLevels - 1 && std::max(width >> tailMip, height >> tailMip) > ms_Settings.ResidentMipTailSize)
+            tailMip++;
+
+        return tailMip;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void TextureStreamer::RequestMips(u32 textureID, u32 firstMip, bool isLoad)
+    {
+        StreamedTexture& texture = ms_Textures[textureID];
+        Ref<Texture2D> asset = texture.Asset.lock();
+
+        Scope<CompletedRequest> request = CreateScope<CompletedRequest>();
+        request->TextureID = textureID;
+        request->Generation = ++texture.Generation;
+        request->FirstMip = firstMip;
+        request->IsLoad = isLoad;
+        request->Uploads = CreateScope<GPUUploadBatch>();
+
+        if (!asset)
+        {
+            std::lock_guard<std::mutex> lock(ms_Mutex);
+            ms_CompletedRequests.push_back(std::move(request));
+            return;
+        }
+
+        TextureDescription description = asset->m_Description;
+        std::filesystem::path filepath = asset->GetAssetFilepath();
+        String debugName = fmt::format("TextureAsset_{:#x}", asset->GetUUID());
+
+        // Evictions create a smaller texture from the file as well, the current one is released once it is replaced
+        ms_StreamingThreadPool->EnqueueTask([request = request.release(), description, filepath, debugName]() mutable
+        {
+            Scope<CompletedRequest> completedRequest(request);
+            AssetFileReader file(filepath);
+
+            if (file.IsValid())
+            {
+                TextureDescription streamedDescription = description;
+                streamedDescription.Width = std::max(description.Width >> completedRequest->FirstMip, 1u);
+                streamedDescription.Height = std::max(description.Height >> completedRequest->FirstMip, 1u);
+                streamedDescription.MipLevels = description.MipLevels - completedRequest->FirstMip;
+
+                Ref<Texture> resource = CreateRef<Texture>(streamedDescription, debugName.c_str());
+                GPUUploadBatch* previousBatch = Renderer::SetUploadBatch(completedRequest->Uploads.get());
+                bool succeeded = true;
+
+                for (u32 mip = completedRequest->FirstMip; mip < description.MipLevels && succeeded; mip++)
+                {
+                    AssetChunkReader chunk = file.GetChunk(AssetChunkType::Subresource, mip);
+                    succeeded = chunk.IsValid();
+
+                    if (succeeded)
+                        Renderer::UploadTextureData(resource, chunk.GetData(), mip - completedRequest->FirstMip);
+                }
+
+                Renderer::SetUploadBatch(previousBatch);
+
+                if (succeeded)
+                    completedRequest->Resource = resource;
+                else
+                    completedRequest->Uploads->Uploads.clear();
+            }
+
+            if (!completedRequest->Resource)
+                ATOM_ERROR("Failed streaming mips {}+ of texture {}", completedRequest->FirstMip, filepath);
+
+            std::lock_guard<std::mutex> lock(ms_Mutex);
+            ms_CompletedRequests.push_back(std::move(completedRequest));
+        });
+    }
+}
\ No newline at end of file
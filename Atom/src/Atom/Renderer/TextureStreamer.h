@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Atom/Core/Core.h"
+#include "Atom/Core/ThreadPool.h"
+#include "Atom/Renderer/TextureStreaming.h"
+#include "Atom/Renderer/Renderer.h"
+#include "Atom/Asset/TextureAsset.h"
+
+namespace Atom
+{
+    // Streams the mips of non readable 2D textures. Textures are loaded with their mip tail only and the renderer reports how large they
+    // appear on screen, from which the residency manager decides which mips are loaded or evicted. Mips are read from the asset file on
+    // a streaming thread into a new texture which replaces the resource of the asset once the upload is done.
+    class TextureStreamer
+    {
+        friend class GPUTextureStreamingBackend;
+    public:
+        static void Initialize(const TextureStreamingSettings& settings = TextureStreamingSettings());
+        static void Shutdown();
+        static bool IsEnabled();
+
+        // Has to be called on the main thread once per frame before the scene is submitted
+        static void Update();
+
+        // Thread safe. The texture is added to the residency manager on the next update.
+        static void RegisterTexture(const Ref<Texture2D>& texture, const Vector<u64>& mipSizes, u32 tailMip);
+
+        // Screen size is the size of the object using the texture in pixels
+        static void ReportTextureUsage(const Ref<TextureAsset>& texture, f32 screenSize);
+
+        static void SetMemoryBudget(u64 budget);
+        static TextureStreamingStats GetStats();
+        static const TextureStreamingSettings& GetSettings();
+        static u32 GetTailMip(u32 width, u32 height, u32 mipLevels);
+    private:
+        struct StreamedTexture
+        {
+            std::weak_ptr<Texture2D> Asset;
+            u32                      Generation = 0; // Incremented with every request so that results of outdated requests are dropped
+            bool                     IsRegistered = false;
+        };
+
+        struct PendingRegistration
+        {
+            std::weak_ptr<Texture2D> Asset;
+            Vector<u64>              MipSizes;
+            u32                      TailMip;
+        };
+
+        struct CompletedRequest
+        {
+            u32                   TextureID;
+            u32                   Generation;
+            u32                   FirstMip;
+            bool                  IsLoad;
+            Ref<Texture>          Resource; // Null if the mips could not be read
+            Scope<GPUUploadBatch> Uploads;
+        };
+
+        static void RequestMips(u32 textureID, u32 firstMip, bool isLoad);
+    private:
+        inline static TextureStreamingSettings        ms_Settings;
+        inline static Scope<TextureStreamingBackend>  ms_Backend;
+        inline static Scope<TextureResidencyManager>  ms_ResidencyManager;
+        inline static Scope<ThreadPool>               ms_StreamingThreadPool;
+        inline static Vector<StreamedTexture>         ms_Textures;
+        inline static std::mutex                      ms_Mutex;
+        inline static Vector<PendingRegistration>     ms_PendingRegistrations;
+        inline static Vector<Scope<CompletedRequest>> ms_CompletedRequests;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,305 @@
+#include "atompch.h"
+#include "TextureStreaming.h"
+
+namespace Atom
+{
+    // -----------------------------------------------------------------------------------------------------------------------------
+    TextureResidencyManager::TextureResidencyManager(const TextureStreamingSettings& settings, TextureStreamingBackend& backend)
+        : m_Settings(settings), m_Backend(backend)
+    {
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    u32 TextureResidencyManager::AddTexture(const Vector<u64>& mipSizes, u32 tailMip, u32 firstResidentMip)
+    {
+        ATOM_ENGINE_ASSERT(!mipSizes.empty() && tailMip < mipSizes.size() && firstResidentMip <= tailMip);
+
+        u32 textureID;
+        if (!m_FreeTextureIDs.empty())
+        {
+            textureID = m_FreeTextureIDs.back();
+            m_FreeTextureIDs.pop_back();
+        }
+        else
+        {
+            textureID = m_Textures.size();
+            m_Textures.emplace_back();
+        }
+
+        TextureEntry& texture = m_Textures[textureID];
+        texture = TextureEntry();
+        texture.MipMemory.resize(mipSizes.size() + 1, 0);
+        texture.TailMip = tailMip;
+        texture.ResidentMip = firstResidentMip;
+        texture.IsValid = true;
+
+        for (s32 mip = mipSizes.size() - 1; mip >= 0; mip--)
+            texture.MipMemory[mip] = texture.MipMemory[mip + 1] + mipSizes[mip];
+
+        m_ResidentMemory += GetStreamedMemory(texture, texture.ResidentMip);
+        return textureID;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void TextureResidencyManager::RemoveTexture(u32 textureID)
+    {
+        TextureEntry& texture = m_Textures[textureID];
+        ATOM_ENGINE_ASSERT(texture.IsValid);
+
+        m_ResidentMemory -= GetStreamedMemory(texture, texture.ResidentMip);
+        texture.IsValid = false;
+
+        // The ID is reused only after the pending load has been reported, otherwise it could be applied to a different texture
+        if (texture.RequestedMip == UINT32_MAX)
+            m_FreeTextureIDs.push_back(textureID);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void TextureResidencyManager::ReportUsage(u32 textureID, u32 desiredMip)
+    {
+        TextureEntry& texture = m_Textures[textureID];
+
+        if (!texture.IsValid)
+            return;
+
+        if (texture.LastUsedFrame != m_CurrentFrame)
+        {
+            texture.LastUsedFrame = m_CurrentFrame;
+            texture.DesiredMip = desiredMip;
+        }
+        else
+        {
+            texture.DesiredMip = std::min(texture.DesiredMip, desiredMip);
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void TextureResidencyManager::OnMipsLoaded(u32 textureID, u32 firstMip)
+    {
+        TextureEntry& texture = m_Textures[textureID];
+
+        if (texture.RequestedMip == UINT32_MAX)
+            return;
+
+        m_PendingMemory -= GetStreamedMemory(texture, texture.RequestedMip) - GetStreamedMemory(texture, texture.ResidentMip);
+        m_PendingRequests--;
+        texture.RequestedMip = UINT32_MAX;
+
+        if (!texture.IsValid)
+        {
+            m_FreeTextureIDs.push_back(textureID);
+            return;
+        }
+
+        if (firstMip < texture.ResidentMip)
+        {
+            m_ResidentMemory += GetStreamedMemory(texture, firstMip) - GetStreamedMemory(texture, texture.ResidentMip);
+            texture.ResidentMip = firstMip;
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void TextureResidencyManager::Update()
+    {
+        // Textures that were used since the last update and are missing detail, most missing detail first
+        Vector<std::pair<u32, u32>> loadCandidates;
+
+        for (u32 textureID = 0; textureID < m_Textures.size(); textureID++)
+        {
+            const TextureEntry& texture = m_Textures[textureID];
+
+            if (!texture.IsValid || texture.LastUsedFrame != m_CurrentFrame || texture.RequestedMip != UINT32_MAX)
+                continue;
+
+            u32 targetMip = std::min(texture.DesiredMip, texture.TailMip);
+
+            if (targetMip < texture.ResidentMip)
+                loadCandidates.emplace_back(texture.ResidentMip - targetMip, textureID);
+        }
+
+        std::stable_sort(loadCandidates.begin(), loadCandidates.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+
+        for (auto& [_, textureID] : loadCandidates)
+        {
+            if (m_PendingRequests >= m_Settings.MaxRequestsPerUpdate)
+                break;
+
+            TextureEntry& texture = m_Textures[textureID];
+            u32 targetMip = std::min(texture.DesiredMip, texture.TailMip);
+
+            // Settle for less detail if the budget cannot fit all of it
+            for (u32 mip = targetMip; mip < texture.ResidentMip; mip++)
+            {
+                u64 requiredMemory = GetStreamedMemory(texture, mip) - GetStreamedMemory(texture, texture.ResidentMip);
+
+                if (MakeRoom(requiredMemory, textureID))
+                {
+                    texture.RequestedMip = mip;
+                    m_PendingMemory += requiredMemory;
+                    m_PendingRequests++;
+                    m_TotalRequests++;
+                    m_Backend.LoadMips(textureID, mip);
+                    break;
+                }
+            }
+        }
+
+        // The budget might have been lowered
+        MakeRoom(0, UINT32_MAX);
+
+        m_CurrentFrame++;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void TextureResidencyManager::SetMemoryBudget(u64 budget)
+    {
+        m_Settings.MemoryBudget = budget;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    u32 TextureResidencyManager::GetResidentMip(u32 textureID) const
+    {
+        return m_Textures[textureID].ResidentMip;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    TextureStreamingStats TextureResidencyManager::GetStats() const
+    {
+        TextureStreamingStats stats;
+        stats.MemoryBudget = m_Settings.MemoryBudget;
+        stats.ResidentMemory = m_ResidentMemory;
+        stats.PendingMemory = m_PendingMemory;
+        stats.TextureCount = m_Textures.size() - m_FreeTextureIDs.size();
+        stats.PendingRequests = m_PendingRequests;
+        stats.TotalRequests = m_TotalRequests;
+        stats.TotalEvictions = m_TotalEvictions;
+        return stats;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    u64 TextureResidencyManager::GetStreamedMemory(const TextureEntry& texture, u32 firstMip) const
+    {
+        // The mip tail is always resident and does not count towards the budget
+        return texture.MipMemory[std::min(firstMip, texture.TailMip)] - texture.MipMemory[texture.TailMip];
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    u32 TextureResidencyManager::GetEvictionTarget(const TextureEntry& texture) const
+    {
+        // Textures used since the last update only lose the detail they don't need, all others are dropped to their mip tail
+        return texture.LastUsedFrame == m_CurrentFrame ? std::min(texture.DesiredMip, texture.TailMip) : texture.TailMip;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool TextureResidencyManager::MakeRoom(u64 memory, u32 requestingTextureID)
+    {
+        u64 usedMemory = m_ResidentMemory + m_PendingMemory + memory;
+
+        if (usedMemory <= m_Settings.MemoryBudget)
+            return true;
+
+        u64 memoryToFree = usedMemory - m_Settings.MemoryBudget;
+
+        // Least recently used first. Textures with pending loads are left alone.
+        Vector<u32> victims;
+        u64 freeableMemory = 0;
+
+        for (u32 textureID = 0; textureID < m_Textures.size(); textureID++)
+        {
+            const TextureEntry& texture = m_Textures[textureID];
+
+            if (!texture.IsValid || textureID == requestingTextureID || texture.RequestedMip != UINT32_MAX)
+                continue;
+
+            u32 evictionTarget = GetEvictionTarget(texture);
+
+            if (evictionTarget > texture.ResidentMip)
+            {
+                victims.push_back(textureID);
+                freeableMemory += GetStreamedMemory(texture, texture.ResidentMip) - GetStreamedMemory(texture, evictionTarget);
+            }
+        }
+
+        if (freeableMemory < memoryToFree)
+        {
+            // Requests wait until memory can be freed, but a lowered budget is enforced as far as possible
+            if (memory != 0)
+                return false;
+        }
+
+        std::stable_sort(victims.begin(), victims.end(), [this](u32 a, u32 b) { return m_Textures[a].LastUsedFrame < m_Textures[b].LastUsedFrame; });
+
+        u64 freedMemory = 0;
+        for (u32 textureID : victims)
+        {
+            if (freedMemory >= memoryToFree)
+                break;
+
+            const TextureEntry& texture = m_Textures[textureID];
+            u64 residentMemory = GetStreamedMemory(texture, texture.ResidentMip);
+            u32 evictionTarget = GetEvictionTarget(texture);
+
+            // Drop only as many mips as needed
+            while (evictionTarget - 1 > texture.ResidentMip && residentMemory - GetStreamedMemory(texture, evictionTarget - 1) >= memoryToFree - freedMemory)
+                evictionTarget--;
+
+            freedMemory += residentMemory - GetStreamedMemory(texture, evictionTarget);
+            Evict(textureID, evictionTarget);
+        }
+
+        return freedMemory >= memoryToFree;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void TextureResidencyManager::Evict(u32 textureID, u32 firstMip)
+    {
+        TextureEntry& texture = m_Textures[textureID];
+
+        m_ResidentMemory -= GetStreamedMemory(texture, texture.ResidentMip) - GetStreamedMemory(texture, firstMip);
+        texture.ResidentMip = firstMip;
+        m_TotalEvictions++;
+
+        m_Backend.EvictMips(textureID, firstMip);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    SimulatedTextureStreamingBackend::SimulatedTextureStreamingBackend(u32 loadLatency)
+        : m_LoadLatency(loadLatency)
+    {
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void SimulatedTextureStreamingBackend::LoadMips(u32 textureID, u32 firstMip)
+    {
+        m_PendingLoads.push_back({ textureID, firstMip, m_LoadLatency });
+        m_LoadCount++;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void SimulatedTextureStreamingBackend::EvictMips(u32 textureID, u32 firstMip)
+    {
+        m_EvictionCount++;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void SimulatedTextureStreamingBackend::Update(TextureResidencyManager& residencyManager)
+    {
+        for (u32 i = 0; i < m_PendingLoads.size();)
+        {
+            PendingLoad& load = m_PendingLoads[i];
+
+            if (load.RemainingUpdates > 0)
+                load.RemainingUpdates--;
+
+            if (load.RemainingUpdates == 0)
+            {
+                residencyManager.OnMipsLoaded(load.TextureID, load.FirstMip);
+                m_PendingLoads.erase(m_PendingLoads.begin() + i);
+            }
+            else
+            {
+                i++;
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Atom/Core/Core.h"
+
+namespace Atom
+{
+    struct TextureStreamingSettings
+    {
+        u64 MemoryBudget = 512ull * 1024 * 1024; // Memory for the streamed mips of all textures
+        u32 ResidentMipTailSize = 128;           // Mips that are at most this large are loaded with the texture and never evicted
+        u32 MaxRequestsPerUpdate = 8;
+        f32 MipBias = 0.0f;                      // Added to the mip computed from the screen size. Positive values request less detail.
+    };
+
+    struct TextureStreamingStats
+    {
+        u64 MemoryBudget = 0;
+        u64 ResidentMemory = 0;
+        u64 PendingMemory = 0;
+        u32 TextureCount = 0;
+        u32 PendingRequests = 0;
+        u64 TotalRequests = 0;
+        u64 TotalEvictions = 0;
+    };
+
+    class TextureResidencyManager;
+
+    // Performs the actual mip transitions. Loads are asynchronous and have to be reported back with TextureResidencyManager::OnMipsLoaded,
+    // evictions are treated as completed as soon as they are issued.
+    class TextureStreamingBackend
+    {
+    public:
+        virtual ~TextureStreamingBackend() = default;
+
+        virtual void LoadMips(u32 textureID, u32 firstMip) = 0;
+        virtual void EvictMips(u32 textureID, u32 firstMip) = 0;
+    };
+
+    // Decides which mips of the streamed textures are resident. The renderer reports the most detailed mip each texture needs every frame.
+    // Missing mips are requested in order of how much detail is missing, and when the budget is exceeded the least recently used textures
+    // lose their detail first. Only the decisions are made here, so the logic can be driven by a simulated backend without a GPU.
+    class TextureResidencyManager
+    {
+    public:
+        TextureResidencyManager(const TextureStreamingSettings& settings, TextureStreamingBackend& backend);
+
+        // Mip sizes are ordered from the most detailed mip. The texture starts with the mips [firstResidentMip, mipCount) resident.
+        u32 AddTexture(const Vector<u64>& mipSizes, u32 tailMip, u32 firstResidentMip);
+        void RemoveTexture(u32 textureID);
+        void ReportUsage(u32 textureID, u32 desiredMip);
+        void OnMipsLoaded(u32 textureID, u32 firstMip);
+        void Update();
+
+        void SetMemoryBudget(u64 budget);
+        u32 GetResidentMip(u32 textureID) const;
+        TextureStreamingStats GetStats() const;
+        inline const TextureStreamingSettings& GetSettings() const { return m_Settings; }
+    private:
+        struct TextureEntry
+        {
+            Vector<u64> MipMemory; // Memory of the mips [mip, mipCount) for every mip
+            u32         TailMip = 0;
+            u32         ResidentMip = 0;
+            u32         RequestedMip = UINT32_MAX;
+            u32         DesiredMip = UINT32_MAX;
+            u64         LastUsedFrame = 0;
+            bool        IsValid = false;
+        };
+
+        u64 GetStreamedMemory(const TextureEntry& texture, u32 firstMip) const;
+        u32 GetEvictionTarget(const TextureEntry& texture) const;
+        bool MakeRoom(u64 memory, u32 requestingTextureID);
+        void Evict(u32 textureID, u32 firstMip);
+    private:
+        TextureStreamingSettings m_Settings;
+        TextureStreamingBackend& m_Backend;
+        Vector<TextureEntry>     m_Textures;
+        Vector<u32>              m_FreeTextureIDs;
+        u64                      m_CurrentFrame = 1;
+        u64                      m_ResidentMemory = 0;
+        u64                      m_PendingMemory = 0;
+        u32                      m_PendingRequests = 0;
+        u64                      m_TotalRequests = 0;
+        u64                      m_TotalEvictions = 0;
+    };
+
+    // Backend without GPU resources. Loads complete after a fixed number of updates, which makes the residency decisions reproducible.
+    class SimulatedTextureStreamingBackend : public TextureStreamingBackend
+    {
+    public:
+        SimulatedTextureStreamingBackend(u32 loadLatency = 1);
+
+        virtual void LoadMips(u32 textureID, u32 firstMip) override;
+        virtual void EvictMips(u32 textureID, u32 firstMip) override;
+
+        // Completes the loads whose latency has passed
+        void Update(TextureResidencyManager& residencyManager);
+
+        inline u32 GetLoadCount() const { return m_LoadCount; }
+        inline u32 GetEvictionCount() const { return m_EvictionCount; }
+    private:
+        struct PendingLoad
+        {
+            u32 TextureID;
+            u32 FirstMip;
+            u32 RemainingUpdates;
+        };
+
+        u32                 m_LoadLatency;
+        Vector<PendingLoad> m_PendingLoads;
+        u32                 m_LoadCount = 0;
+        u32                 m_EvictionCount = 0;
+    };
+}
\ No newline at end of file
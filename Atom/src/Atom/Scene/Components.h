@@ -6,6 +6,9 @@
 #include "Atom/Scene/Entity.h"
 #include "Atom/Asset/MeshAsset.h"
 #include "Atom/Asset/AnimationControllerAsset.h"
+#include "Atom/Animation/PoseEvaluator.h"
+#include "Atom/Animation/AnimationLOD.h"
+#include "Atom/Animation/BakedAnimation.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -99,9 +102,23 @@ namespace Atom
 
 	struct AnimatorComponent
 	{
-		Ref<AnimationController> AnimationController = nullptr;
-		f32						 CurrentTime = 0.0f;
-		bool					 Play = false;
+		Ref<AnimationController>		AnimationController = nullptr;
+		f32								CurrentTime = 0.0f; // Normalized playback time of the current state
+		bool							Play = false;
+
+		// Runtime only. Crossfade progress and cached key positions of all animations that are currently sampled
+		u16								ActiveStateIdx = UINT16_MAX;
+		u16								PreviousStateIdx = UINT16_MAX;
+		f32								PreviousTime = 0.0f;
+		f32								TransitionTime = 0.0f;
+		f32								TransitionDuration = 0.0f;
+		Vector<Animation::TrackCursor>	TrackCursors;
+
+		// Runtime only. Entities at reduced LOD tiers accumulate their time until their next update.
+		AnimationLODTier				LODTier = AnimationLODTier::Full;
+		u32								FramesSinceUpdate = 0;
+		f32								PendingTime = 0.0f;
+		Ref<BakedAnimation>				BakedAnimation = nullptr; // Palette table of the current clip when the controller uses baked palettes
 
 		AnimatorComponent() = default;
 		AnimatorComponent(const AnimatorComponent& other) = default;
@@ -109,6 +126,21 @@ namespace Atom
 			: AnimationController(animationController), CurrentTime(currentTime), Play(play) {}
 	};
 
+	// Runtime only. Holds the skinning palette of the entity so that entities sharing a skeleton asset can be posed independently.
+	struct SkeletonPoseComponent
+	{
+		LocalPose		  LocalTransforms;
+		LocalPose		  PreviousLocalTransforms; // Pose of the update before, used to interpolate at reduced update rates
+		Vector<glm::mat4> BoneTransforms;
+		glm::vec3		  BoundsMin = glm::vec3(FLT_MAX); // Mesh space bounds of the current pose. Empty until the entity is animated.
+		glm::vec3		  BoundsMax = glm::vec3(-FLT_MAX);
+
+		SkeletonPoseComponent() = default;
+		SkeletonPoseComponent(const SkeletonPoseComponent& other) = default;
+
+		bool HasBounds() const { return BoundsMin.x <= BoundsMax.x; }
+	};
+
 	struct SkyLightComponent
 	{
 		Ref<TextureCube> EnvironmentMap = nullptr;
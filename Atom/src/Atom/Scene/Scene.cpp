@@ -6,6 +6,9 @@
 #include "Atom/Physics/PhysicsEngine.h"
 #include "Atom/Asset/AssetManager.h"
 #include "Atom/Asset/AnimationControllerAsset.h"
+#include "Atom/Core/Application.h"
+#include "Atom/Core/Timer.h"
+#include "Atom/Animation/BakedAnimation.h"
 
 namespace Atom
 {
@@ -29,6 +32,157 @@ namespace Atom
             dstEntity.AddOrReplaceComponent<Component>(srcEntity.GetComponent<Component>());
     }
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    static const Vector<glm::mat4>& GetSkeletonPose(entt::registry& registry, entt::entity entity, const Ref<Skeleton>& skeleton)
+    {
+        // Entities that were never animated are rendered in bind pose
+        auto& pose = registry.get_or_emplace<SkeletonPoseComponent>(entity);
+        if (pose.BoneTransforms.size() != skeleton->GetBoneCount())
+            pose.BoneTransforms.assign(skeleton->GetBoneCount(), glm::mat4(1.0f));
+
+        return pose.BoneTransforms;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    static glm::mat4 GetWorldTransform(Scene& scene, Entity entity)
+    {
+        glm::mat4 transform = entity.GetComponent<TransformComponent>().GetTransform();
+        UUID parent = entity.GetComponent<SceneHierarchyComponent>().Parent;
+
+        while (parent)
+        {
+            Entity currentParent = scene.FindEntityByUUID(parent);
+            transform = currentParent.GetComponent<TransformComponent>().GetTransform() * transform;
+            parent = currentParent.GetComponent<SceneHierarchyComponent>().Parent;
+        }
+
+        return transform;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    static void AddStateLayers(const AnimationController& controller, u16 stateIdx, f32 normalizedTime, f32 stateWeight, Vector<PoseLayer>& layers, Vector<u32>& cursorOffsets, u32& trackCount)
+    {
+        static thread_local Vector<f32> s_BlendWeights;
+        controller.GetBlendWeights(stateIdx, s_BlendWeights);
+
+        const AnimationState& state = controller.GetAnimationStates()[stateIdx];
+        for (u32 i = 0; i < state.Animations.size(); i++)
+        {
+            const Ref<Animation>& animation = state.Animations[i];
+            f32 weight = stateWeight * s_BlendWeights[i];
+
+            if (!animation || weight < PoseEvaluator::MinLayerWeight)
+                continue;
+
+            PoseLayer& layer = layers.emplace_back();
+            layer.Animation = animation.get();
+            layer.TimeStamp = normalizedTime * animation->GetDuration();
+            layer.Weight = weight;
+
+            cursorOffsets.push_back(trackCount);
+            trackCount += animation->GetTrackCount();
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    static void AdvanceAnimator(AnimatorComponent& ac, f32 deltaTime)
+    {
+        static thread_local Vector<f32> s_BlendWeights;
+
+        const AnimationController& controller = *ac.AnimationController;
+        u16 currentStateIdx = controller.GetCurrentStateIdx();
+
+        // The controller is shared between entities so every animator tracks its own crossfade
+        if (ac.ActiveStateIdx != currentStateIdx)
+        {
+            if (ac.ActiveStateIdx < controller.GetAnimationStates().size() && controller.GetTransitionDuration() > 0.0f)
+            {
+                ac.PreviousStateIdx = ac.ActiveStateIdx;
+                ac.PreviousTime = ac.CurrentTime;
+                ac.TransitionTime = 0.0f;
+                ac.TransitionDuration = controller.GetTransitionDuration();
+                ac.CurrentTime = 0.0f;
+            }
+            else
+            {
+                ac.PreviousStateIdx = UINT16_MAX;
+            }
+
+            ac.ActiveStateIdx = currentStateIdx;
+        }
+
+        if (ac.PreviousStateIdx != UINT16_MAX)
+        {
+            ac.TransitionTime += deltaTime;
+
+            if (ac.TransitionTime >= ac.TransitionDuration)
+                ac.PreviousStateIdx = UINT16_MAX;
+        }
+
+        // Advance the normalized time of the states. Blend states use the weighted duration of their animations so that all of them stay in phase.
+        controller.GetBlendWeights(currentStateIdx, s_BlendWeights);
+        f32 currentStateDuration = controller.GetStateDuration(currentStateIdx, s_BlendWeights);
+        if (currentStateDuration > 0.0f)
+            ac.CurrentTime = std::fmod(ac.CurrentTime + deltaTime / currentStateDuration, 1.0f);
+
+        if (ac.PreviousStateIdx != UINT16_MAX)
+        {
+            controller.GetBlendWeights(ac.PreviousStateIdx, s_BlendWeights);
+            f32 previousStateDuration = controller.GetStateDuration(ac.PreviousStateIdx, s_BlendWeights);
+            if (previousStateDuration > 0.0f)
+                ac.PreviousTime = std::fmod(ac.PreviousTime + deltaTime / previousStateDuration, 1.0f);
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    static void SampleAnimatorPose(AnimatorComponent& ac, const Skeleton& skeleton, LocalPose& pose, u32 skippedBoneHeight)
+    {
+        static thread_local Vector<PoseLayer> s_Layers;
+        static thread_local Vector<u32> s_CursorOffsets;
+
+        const AnimationController& controller = *ac.AnimationController;
+        u16 currentStateIdx = ac.ActiveStateIdx;
+        f32 currentStateWeight = ac.PreviousStateIdx != UINT16_MAX ? ac.TransitionTime / ac.TransitionDuration : 1.0f;
+
+        // Collect the layers of both states
+        s_Layers.clear();
+        s_CursorOffsets.clear();
+        u32 trackCount = 0;
+
+        AddStateLayers(controller, currentStateIdx, ac.CurrentTime, currentStateWeight, s_Layers, s_CursorOffsets, trackCount);
+
+        if (ac.PreviousStateIdx != UINT16_MAX)
+            AddStateLayers(controller, ac.PreviousStateIdx, ac.PreviousTime, 1.0f - currentStateWeight, s_Layers, s_CursorOffsets, trackCount);
+
+        // Cursors are assigned after resizing since the storage may move
+        ac.TrackCursors.resize(trackCount);
+        for (u32 i = 0; i < s_Layers.size(); i++)
+            s_Layers[i].Cursors = ac.TrackCursors.data() + s_CursorOffsets[i];
+
+        PoseEvaluator::SampleBlendedPose(s_Layers.data(), s_Layers.size(), skeleton, pose, skippedBoneHeight);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    static bool SampleBakedPalette(AnimatorComponent& ac, const Ref<Skeleton>& skeleton, Vector<glm::mat4>& palette)
+    {
+        const BakedPaletteSettings& settings = ac.AnimationController->GetBakedPaletteSettings();
+
+        // Only clips that are not fading can be looked up. Everything else falls back to pose evaluation.
+        if (!settings.Enabled || ac.PreviousStateIdx != UINT16_MAX)
+            return false;
+
+        const AnimationState& state = ac.AnimationController->GetAnimationStates()[ac.ActiveStateIdx];
+        if (state.Type != AnimationStateType::Clip || state.Animations.empty() || !state.Animations[0])
+            return false;
+
+        const Ref<Animation>& animation = state.Animations[0];
+        if (!ac.BakedAnimation || !ac.BakedAnimation->IsBakedFrom(*animation, *skeleton, settings.SampleRate))
+            ac.BakedAnimation = BakedAnimationCache::GetBakedAnimation(animation, skeleton, settings.SampleRate);
+
+        ac.BakedAnimation->GetPalette(ac.CurrentTime, settings.Interpolate, palette);
+        return true;
+    }
+
     // -----------------------------------------------------------------------------------------------------------------------------
     Scene::Scene(const String& name)
         : Asset(AssetType::Scene), m_Name(name)
@@ -285,42 +439,148 @@ namespace Atom
 
         // Update animation time
         {
+            Timer animationTimer;
+            animationTimer.Reset();
+            m_AnimationStats = {};
+            m_AnimationFrameIndex++;
+
+            // LOD tiers are selected from the primary camera. Without one every entity is fully updated.
+            bool hasCamera = false;
+            AnimationLOD::ViewInfo lodView;
+
+            auto cameraView = m_Registry.view<CameraComponent>();
+            for (auto entity : cameraView)
+            {
+                auto& cc = cameraView.get<CameraComponent>(entity);
+
+                if (cc.Primary)
+                {
+                    lodView = AnimationLOD::CreateViewInfo(cc.Camera.GetProjection(), GetWorldTransform(*this, Entity(entity, this)));
+                    hasCamera = true;
+                    break;
+                }
+            }
+
+            // Pose components are created up front since the registry can't be modified structurally while the workers are running
+            m_AnimatedEntities.clear();
+
             auto view = m_Registry.view<AnimatedMeshComponent, AnimatorComponent>();
             for (auto entity : view)
             {
                 auto& [amc, ac] = view.get<AnimatedMeshComponent, AnimatorComponent>(entity);
 
-                if (ac.AnimationController && ac.Play)
+                if (amc.Skeleton && ac.AnimationController && !ac.AnimationController->GetAnimationStates().empty() && ac.Play)
                 {
-                    Ref<Animation> currentAnimState = ac.AnimationController->GetCurrentState();
-                    // Update animation time
-                    ac.CurrentTime += ts.GetSeconds() * currentAnimState->GetTicksPerSecond();
-                    if (ac.CurrentTime > currentAnimState->GetDuration())
-                        ac.CurrentTime = std::fmod(ac.CurrentTime, currentAnimState->GetDuration());
-
-                    // Calculate bone animated transforms
-                    Vector<Skeleton::Bone>& skeletonBones = amc.Skeleton->GetBones();
-                    Queue<Skeleton::Bone*> boneQueue;
-                    boneQueue.push(&amc.Skeleton->GetRootBone());
-
-                    while (!boneQueue.empty())
+                    auto& pose = m_Registry.get_or_emplace<SkeletonPoseComponent>(entity);
+
+                    ac.LODTier = AnimationLODTier::Full;
+                    if (hasCamera)
                     {
-                        Skeleton::Bone* currentBone = boneQueue.front();
-                        glm::mat4 interpolatedTransform = currentAnimState->GetTransformAtTimeStamp(ac.CurrentTime, currentBone->ID);
-                        currentBone->AnimatedTransform = currentBone->ParentID != UINT32_MAX ? skeletonBones[currentBone->ParentID].AnimatedTransform * interpolatedTransform : interpolatedTransform;
-                        boneQueue.pop();
+                        // Prefer the skinned bounds of the last pose over the bind pose bounds
+                        glm::vec3 localCenter = amc.Skeleton->GetBindPoseCenter();
+                        f32 localRadius = amc.Skeleton->GetBindPoseRadius();
+
+                        if (pose.HasBounds())
+                        {
+                            localCenter = (pose.BoundsMin + pose.BoundsMax) * 0.5f;
+                            localRadius = glm::length(pose.BoundsMax - pose.BoundsMin) * 0.5f;
+                        }
+
+                        glm::mat4 transform = GetWorldTransform(*this, Entity(entity, this));
+                        glm::vec3 center = transform * glm::vec4(localCenter, 1.0f);
+                        f32 maxScale = glm::max(glm::length(glm::vec3(transform[0])), glm::max(glm::length(glm::vec3(transform[1])), glm::length(glm::vec3(transform[2]))));
 
-                        for (u32 childID : currentBone->ChildrenIDs)
-                            boneQueue.push(&skeletonBones[childID]);
+                        ac.LODTier = AnimationLOD::SelectTier(lodView, center, localRadius * maxScale);
                     }
 
-                    // Multiply by the inverse bind transform
-                    for (auto& bone : skeletonBones)
+                    // Frozen entities keep their last palette and only accumulate time
+                    ac.PendingTime += ts.GetSeconds();
+                    ac.FramesSinceUpdate++;
+
+                    m_AnimationStats.AnimatedEntityCount++;
+                    m_AnimationStats.TierEntityCounts[(u32)ac.LODTier]++;
+
+                    if (ac.LODTier == AnimationLODTier::Frozen)
+                        continue;
+
+                    // A frames since update count of 0 tells the workers to sample a new pose. Baked palettes are a lookup so they are updated every frame.
+                    bool hasPose = pose.LocalTransforms.BoneCount == amc.Skeleton->GetBoneCount();
+                    if (ac.AnimationController->GetBakedPaletteSettings().Enabled)
                     {
-                        bone.AnimatedTransform = bone.AnimatedTransform * bone.InverseBindTransform;
+                        ac.FramesSinceUpdate = 0;
+
+                        m_AnimationStats.UpdatedEntityCount++;
+                        m_AnimationStats.BakedEntityCount++;
+                    }
+                    else if (!hasPose || AnimationLOD::ShouldUpdate(m_AnimationFrameIndex, (u32)entity, ac.FramesSinceUpdate, ac.LODTier))
+                    {
+                        ac.FramesSinceUpdate = 0;
+
+                        u32 skippedBoneHeight = hasPose ? AnimationLOD::GetTierSettings(ac.LODTier).SkippedBoneHeight : 0;
+                        const Vector<u32>& boneHeights = amc.Skeleton->GetBoneHeights();
+
+                        m_AnimationStats.UpdatedEntityCount++;
+                        m_AnimationStats.SampledBoneCount += (u32)std::count_if(boneHeights.begin(), boneHeights.end(), [=](u32 height) { return height >= skippedBoneHeight; });
                     }
+
+                    m_AnimatedEntities.push_back(entity);
                 }
             }
+
+            // Every entity only writes to its own animator and pose so the batches need no synchronization
+            Application::Get().GetWorkerThreadPool().ParallelFor(m_AnimatedEntities.size(), 16, [this](u32 begin, u32 end)
+            {
+                static thread_local LocalPose s_InterpolatedPose;
+
+                for (u32 i = begin; i < end; i++)
+                {
+                    entt::entity entity = m_AnimatedEntities[i];
+                    auto& amc = m_Registry.get<AnimatedMeshComponent>(entity);
+                    auto& ac = m_Registry.get<AnimatorComponent>(entity);
+                    auto& pose = m_Registry.get<SkeletonPoseComponent>(entity);
+
+                    const AnimationLODTierSettings& lodSettings = AnimationLOD::GetTierSettings(ac.LODTier);
+
+                    // Calculate bone animated transforms into the entity's own pose. The skeleton asset is shared and stays read-only.
+                    if (ac.FramesSinceUpdate == 0)
+                    {
+                        AdvanceAnimator(ac, ac.PendingTime);
+                        ac.PendingTime = 0.0f;
+
+                        if (SampleBakedPalette(ac, amc.Skeleton, pose.BoneTransforms))
+                        {
+                            PoseEvaluator::ComputeSkinnedBounds(*amc.Skeleton, pose.BoneTransforms, pose.BoundsMin, pose.BoundsMax);
+                            continue;
+                        }
+
+                        pose.PreviousLocalTransforms = pose.LocalTransforms;
+                        SampleAnimatorPose(ac, *amc.Skeleton, pose.LocalTransforms, lodSettings.SkippedBoneHeight);
+                    }
+
+                    // Reduced update rates interpolate from the previous update towards the last one over the interval. Animators with baked
+                    // palettes only get here while fading or playing blend states and are updated every frame.
+                    u32 updateInterval = ac.AnimationController->GetBakedPaletteSettings().Enabled ? 1 : glm::max(lodSettings.UpdateInterval, 1u);
+                    if (updateInterval > 1 && pose.PreviousLocalTransforms.BoneCount == pose.LocalTransforms.BoneCount)
+                    {
+                        f32 factor = glm::min((f32)(ac.FramesSinceUpdate + 1) / updateInterval, 1.0f);
+                        PoseEvaluator::BlendPoses(pose.PreviousLocalTransforms, pose.LocalTransforms, factor, s_InterpolatedPose);
+                        PoseEvaluator::BuildSkinningPalette(*amc.Skeleton, s_InterpolatedPose, pose.BoneTransforms);
+                    }
+                    else if (ac.FramesSinceUpdate == 0)
+                    {
+                        PoseEvaluator::BuildSkinningPalette(*amc.Skeleton, pose.LocalTransforms, pose.BoneTransforms);
+                    }
+                    else
+                    {
+                        continue;
+                    }
+
+                    PoseEvaluator::ComputeSkinnedBounds(*amc.Skeleton, pose.BoneTransforms, pose.BoundsMin, pose.BoundsMax);
+                }
+            });
+
+            animationTimer.Stop();
+            m_AnimationStats.UpdateTime = animationTimer.GetElapsedTime().GetMilliseconds();
         }
     }
 
@@ -426,9 +686,11 @@ namespace Atom
             for (auto entity : view)
             {
                 auto [amc, tc, shc] = view.get<AnimatedMeshComponent, TransformComponent, SceneHierarchyComponent>(entity);
-                
-                if (amc.Mesh && !amc.Mesh->IsEmpty())
+
+                if (amc.Mesh && !amc.Mesh->IsEmpty() && amc.Skeleton)
                 {
+                    const Vector<glm::mat4>& boneTransforms = GetSkeletonPose(m_Registry, entity, amc.Skeleton);
+
                     if (shc.Parent)
                     {
                         Entity currentParent = FindEntityByUUID(shc.Parent);
@@ -440,10 +702,10 @@ namespace Atom
                             accumulatedTransform = currentParent.GetComponent<TransformComponent>().GetTransform() * accumulatedTransform;
                         }
 
-                        renderer->SubmitAnimatedMesh(amc.Mesh, accumulatedTransform * tc.GetTransform(), {}, amc.Skeleton);
+                        renderer->SubmitAnimatedMesh(amc.Mesh, accumulatedTransform * tc.GetTransform(), {}, boneTransforms);
                     }
                     else
-                        renderer->SubmitAnimatedMesh(amc.Mesh, tc.GetTransform(), {}, amc.Skeleton);
+                        renderer->SubmitAnimatedMesh(amc.Mesh, tc.GetTransform(), {}, boneTransforms);
                 }
             }
         }
@@ -576,8 +838,10 @@ namespace Atom
                 {
                     auto [amc, tc, shc] = view.get<AnimatedMeshComponent, TransformComponent, SceneHierarchyComponent>(entity);
 
-                    if (amc.Mesh && !amc.Mesh->IsEmpty())
+                    if (amc.Mesh && !amc.Mesh->IsEmpty() && amc.Skeleton)
                     {
+                        const Vector<glm::mat4>& boneTransforms = GetSkeletonPose(m_Registry, entity, amc.Skeleton);
+
                         if (shc.Parent)
                         {
                             Entity currentParent = FindEntityByUUID(shc.Parent);
@@ -589,10 +853,10 @@ namespace Atom
                                 accumulatedTransform = currentParent.GetComponent<TransformComponent>().GetTransform() * accumulatedTransform;
                             }
 
-                            renderer->SubmitAnimatedMesh(amc.Mesh, accumulatedTransform * tc.GetTransform(), {}, amc.Skeleton);
+                            renderer->SubmitAnimatedMesh(amc.Mesh, accumulatedTransform * tc.GetTransform(), {}, boneTransforms);
                         }
                         else
-                            renderer->SubmitAnimatedMesh(amc.Mesh, tc.GetTransform(), {}, amc.Skeleton);
+                            renderer->SubmitAnimatedMesh(amc.Mesh, tc.GetTransform(), {}, boneTransforms);
                     }
                 }
             }
@@ -5,6 +5,7 @@
 #include "Atom/Renderer/Renderer.h"
 #include "Atom/Scene/Entity.h"
 #include "Atom/Asset/Asset.h"
+#include "Atom/Animation/AnimationLOD.h"
 
 #include <entt/entt.hpp>
 
@@ -17,6 +18,16 @@ namespace Atom
         Running
     };
 
+    struct SceneAnimationStats
+    {
+        u32 AnimatedEntityCount = 0;
+        u32 UpdatedEntityCount = 0;
+        u32 BakedEntityCount = 0;
+        u32 SampledBoneCount = 0;
+        u32 TierEntityCounts[(u32)AnimationLODTier::Count] = {};
+        f32 UpdateTime = 0.0f; // In milliseconds
+    };
+
     class Scene : public Asset
     {
         friend class AssetSerializer;
@@ -52,6 +63,7 @@ namespace Atom
         inline const String& GetName() { return m_Name; }
         inline EditorCamera& GetEditorCamera() { return m_EditorCamera; }
         inline SceneState GetSceneState() const { return m_State; }
+        inline const SceneAnimationStats& GetAnimationStats() const { return m_AnimationStats; }
     private:
         f32                   m_PhysicsUpdateTime = 0.0f;
         String                m_Name;
@@ -59,5 +71,8 @@ namespace Atom
         EditorCamera          m_EditorCamera;
         SceneState            m_State = SceneState::Edit;
         HashMap<UUID, Entity> m_EntitiesByID;
+        SceneAnimationStats   m_AnimationStats;
+        Vector<entt::entity>  m_AnimatedEntities;
+        u32                   m_AnimationFrameIndex = 0;
     };
 }
\ No newline at end of file
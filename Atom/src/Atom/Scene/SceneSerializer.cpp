@@ -3,6 +3,8 @@
 
 #include "Atom/Scene/Components.h"
 #include "Atom/Asset/AssetManager.h"
+#include "Atom/Core/Application.h"
+#include "Atom/Core/MappedFile.h"
 
 #include <yaml-cpp/yaml.h>
 #include <glm/glm.hpp>
@@ -76,27 +78,33 @@ namespace Atom
 		return out;
 	}
 
-    // -----------------------------------------------------------------------------------------------------------------------------
-    SceneSerializer::SceneSerializer(const Ref<Scene>& scene)
-        : m_Scene(scene)
-    {
-    }
-
-    // -----------------------------------------------------------------------------------------------------------------------------
-    void SceneSerializer::Serialize(const std::filesystem::path& filepath)
-    {
-		YAML::Emitter out;
-		out << YAML::BeginMap;
-		out << YAML::Key << "Scene" << YAML::Value << m_Scene->GetName();
-		out << YAML::Key << "Entities" << YAML::Value << YAML::BeginSeq;
+	namespace Utils
+	{
+		// Entities are emitted and parsed in blocks so that the scene never has to be held in a single YAML document
+		static constexpr u32 EntityBlockSize = 4096;
+		static constexpr u32 EntityBatchSize = 64;
 
-		m_Scene->m_Registry.each([&](auto entityID)
+		// Components of an entity parsed on a worker thread. Assets are only resolved when the entity is merged into the scene.
+		struct DeserializedEntity
+		{
+			UUID                                     ID = 0;
+			String                                   Name = "Unnamed";
+			std::optional<SceneHierarchyComponent>   SceneHierarchy;
+			std::optional<TransformComponent>        Transform;
+			std::optional<CameraComponent>           Camera;
+			std::optional<UUID>                      Mesh;
+			std::optional<UUID>                      EnvironmentMap;
+			std::optional<DirectionalLightComponent> DirectionalLight;
+			std::optional<PointLightComponent>       PointLight;
+			std::optional<SpotLightComponent>        SpotLight;
+			std::optional<ScriptComponent>           Script;
+			std::optional<RigidbodyComponent>        Rigidbody;
+			std::optional<BoxColliderComponent>      BoxCollider;
+		};
+
+		// -----------------------------------------------------------------------------------------------------------------------------
+		static void SerializeEntity(YAML::Emitter& out, Entity entity)
 		{
-			Entity entity = { entityID, m_Scene.get() };
-
-			if (!entity)
-				return;
-
 			out << YAML::BeginMap;
 			out << YAML::Key << "Entity" << YAML::Value << entity.GetUUID();
 
@@ -157,7 +165,7 @@ namespace Atom
 				auto& mc = entity.GetComponent<MeshComponent>();
 				out << YAML::Key << "MeshComponent";
 				out << YAML::BeginMap;
-				out << YAML::Key << "Mesh" << YAML::Value << mc.Mesh->GetUUID();
+				out << YAML::Key << "Mesh" << YAML::Value << (mc.Mesh ? mc.Mesh->GetUUID() : UUID(0));
 				out << YAML::EndMap;
 			}
 
@@ -166,7 +174,7 @@ namespace Atom
 				auto& slc = entity.GetComponent<SkyLightComponent>();
 				out << YAML::Key << "SkyLightComponent";
 				out << YAML::BeginMap;
-				out << YAML::Key << "EnvironmentMap" << YAML::Value << slc.EnvironmentMap->GetUUID();
+				out << YAML::Key << "EnvironmentMap" << YAML::Value << (slc.EnvironmentMap ? slc.EnvironmentMap->GetUUID() : UUID(0));
 				out << YAML::EndMap;
 			}
 
@@ -238,136 +246,318 @@ namespace Atom
 			}
 
 			out << YAML::EndMap;
-		});
+		}
 
-		out << YAML::EndSeq;
-		out << YAML::EndMap;
+		// -----------------------------------------------------------------------------------------------------------------------------
+		static void DeserializeEntity(const YAML::Node& node, DeserializedEntity& entity)
+		{
+			entity.ID = node["Entity"].as<u64>();
 
-		std::ofstream fout(filepath);
-		fout << out.c_str();
-    }
+			if (YAML::Node tagComponent = node["TagComponent"])
+				entity.Name = tagComponent["Tag"].as<String>();
 
-    // -----------------------------------------------------------------------------------------------------------------------------
-    bool SceneSerializer::Deserialize(const std::filesystem::path& filepath)
-    {
-		std::ifstream stream(filepath);
-		std::stringstream strStream;
+			if (YAML::Node sceneNodeComponent = node["SceneHierarchyComponent"])
+			{
+				auto& shc = entity.SceneHierarchy.emplace();
+				shc.Parent = sceneNodeComponent["Parent"].as<u64>();
+				shc.FirstChild = sceneNodeComponent["FirstChild"].as<u64>();
+				shc.NextSibling = sceneNodeComponent["NextSibling"].as<u64>();
+				shc.PreviousSibling = sceneNodeComponent["PreviousSibling"].as<u64>();
+			}
+
+			if (YAML::Node transformComponent = node["TransformComponent"])
+			{
+				auto& tc = entity.Transform.emplace();
+				tc.Translation = transformComponent["Translation"].as<glm::vec3>();
+				tc.Rotation = transformComponent["Rotation"].as<glm::vec3>();
+				tc.Scale = transformComponent["Scale"].as<glm::vec3>();
+			}
 
-		strStream << stream.rdbuf();
+			if (YAML::Node cameraComponent = node["CameraComponent"])
+			{
+				auto& cc = entity.Camera.emplace();
+				YAML::Node cameraProperties = cameraComponent["Camera"];
+				cc.Camera.SetProjectionType((SceneCamera::ProjectionType)cameraProperties["ProjectionType"].as<s32>());
+				cc.Camera.SetPerspectiveFOV(cameraProperties["PerspectiveFOV"].as<f32>());
+				cc.Camera.SetPerspectiveNear(cameraProperties["PerspectiveNear"].as<f32>());
+				cc.Camera.SetPerspectiveFar(cameraProperties["PerspectiveFar"].as<f32>());
+				cc.Camera.SetOrthographicSize(cameraProperties["OrthographicSize"].as<f32>());
+				cc.Camera.SetOrthographicNear(cameraProperties["OrthographicNear"].as<f32>());
+				cc.Camera.SetOrthographicFar(cameraProperties["OrthographicFar"].as<f32>());
+				cc.Primary = cameraComponent["Primary"].as<bool>();
+				cc.FixedAspectRatio = cameraComponent["FixedAspectRatio"].as<bool>();
+			}
 
-		YAML::Node data = YAML::Load(strStream.str());
+			if (YAML::Node meshComponent = node["MeshComponent"])
+				entity.Mesh = meshComponent["Mesh"].as<u64>();
 
-		if (!data["Scene"])
-			return false;
+			if (YAML::Node skyLightComponent = node["SkyLightComponent"])
+				entity.EnvironmentMap = skyLightComponent["EnvironmentMap"].as<u64>();
 
-		String sceneName = data["Scene"].as<String>();
-		ATOM_INFO("Deserializing scene '{0}'", sceneName);
+			if (YAML::Node dirLightComponent = node["DirectionalLightComponent"])
+			{
+				auto& dlc = entity.DirectionalLight.emplace();
+				dlc.Color = dirLightComponent["Color"].as<glm::vec3>();
+				dlc.Intensity = dirLightComponent["Intensity"].as<f32>();
+			}
 
-		if (YAML::Node entities = data["Entities"])
+			if (YAML::Node pointLightComponent = node["PointLightComponent"])
+			{
+				auto& plc = entity.PointLight.emplace();
+				plc.Color = pointLightComponent["Color"].as<glm::vec3>();
+				plc.Intensity = pointLightComponent["Intensity"].as<f32>();
+				plc.AttenuationFactors = pointLightComponent["AttenuationFactors"].as<glm::vec3>();
+			}
+
+			if (YAML::Node spotLightComponent = node["SpotLightComponent"])
+			{
+				auto& slc = entity.SpotLight.emplace();
+				slc.Color = spotLightComponent["Color"].as<glm::vec3>();
+				slc.Direction = spotLightComponent["Direction"].as<glm::vec3>();
+				slc.ConeAngle = spotLightComponent["ConeAngle"].as<f32>();
+				slc.Intensity = spotLightComponent["Intensity"].as<f32>();
+				slc.AttenuationFactors = spotLightComponent["AttenuationFactors"].as<glm::vec3>();
+			}
+
+			if (YAML::Node scriptComponent = node["ScriptComponent"])
+			{
+				auto& sc = entity.Script.emplace();
+				sc.ScriptClass = scriptComponent["ScriptClass"].as<String>();
+			}
+
+			if (YAML::Node ribidbodyComponent = node["RigidbodyComponent"])
+			{
+				auto& rbc = entity.Rigidbody.emplace();
+				rbc.Type = (RigidbodyComponent::RigidbodyType)ribidbodyComponent["Type"].as<s32>();
+				rbc.Mass = ribidbodyComponent["Mass"].as<f32>();
+				rbc.FixedRotation = ribidbodyComponent["FixedRotation"].as<glm::vec3>();
+			}
+
+			if (YAML::Node boxColliderComponent = node["BoxColliderComponent"])
+			{
+				auto& bcc = entity.BoxCollider.emplace();
+				bcc.Center = boxColliderComponent["Center"].as<glm::vec3>();
+				bcc.Size = boxColliderComponent["Size"].as<glm::vec3>();
+				bcc.Restitution = boxColliderComponent["Restitution"].as<f32>();
+				bcc.StaticFriction = boxColliderComponent["StaticFriction"].as<f32>();
+				bcc.DynamicFriction = boxColliderComponent["DynamicFriction"].as<f32>();
+			}
+		}
+
+		// -----------------------------------------------------------------------------------------------------------------------------
+		// Finds the offsets of the items of the "Entities" sequence without parsing them. Items start with a dash at the indentation of the
+		// first item, everything indented further belongs to the item before. Returns the offset of the "Entities" key, or the text size.
+		static u64 SplitEntityList(const char* text, u64 size, Vector<u64>& entityOffsets)
 		{
-			for (s64 it = entities.size() - 1; it >= 0; it--)
+			u64 entitiesKey = size;
+			u64 itemIndent = UINT64_MAX;
+			u64 listEnd = size;
+
+			for (u64 lineStart = 0, nextLine = 0; lineStart < size; lineStart = nextLine)
 			{
-				UUID uuid = entities[it]["Entity"].as<u64>();
-				YAML::Node tagComponent = entities[it]["TagComponent"];
-				String entityName = tagComponent ? tagComponent["Tag"].as<String>() : "Unnamed";
+				const char* lineEnd = (const char*)memchr(text + lineStart, '\n', size - lineStart);
+				nextLine = lineEnd ? lineEnd - text + 1 : size;
 
-				ATOM_INFO("Deserializing entity with UUID = '{0}', name = {1}", uuid, entityName);
+				u64 indent = 0;
+				while (lineStart + indent < nextLine && text[lineStart + indent] == ' ')
+					indent++;
 
-				Entity deserializedEntity = m_Scene->CreateEntityFromUUID(uuid, entityName);
+				const char* line = text + lineStart + indent;
+				u64 lineSize = nextLine - lineStart - indent;
 
-				if (YAML::Node sceneNodeComponent = entities[it]["SceneHierarchyComponent"])
+				if (entitiesKey == size)
 				{
-					auto& shc = deserializedEntity.GetComponent<SceneHierarchyComponent>();
-					shc.Parent = sceneNodeComponent["Parent"].as<u64>();
-					shc.FirstChild = sceneNodeComponent["FirstChild"].as<u64>();
-					shc.NextSibling = sceneNodeComponent["NextSibling"].as<u64>();
-					shc.PreviousSibling = sceneNodeComponent["PreviousSibling"].as<u64>();
-				}
+					if (indent == 0 && lineSize >= 9 && strncmp(line, "Entities:", 9) == 0)
+						entitiesKey = lineStart;
 
-				if (YAML::Node transformComponent = entities[it]["TransformComponent"])
-				{
-					auto& tc = deserializedEntity.GetComponent<TransformComponent>();
-					tc.Translation = transformComponent["Translation"].as<glm::vec3>();
-					tc.Rotation = transformComponent["Rotation"].as<glm::vec3>();
-					tc.Scale = transformComponent["Scale"].as<glm::vec3>();
+					continue;
 				}
 
-				if (YAML::Node cameraComponent = entities[it]["CameraComponent"])
-				{
-					auto& cc = deserializedEntity.AddComponent<CameraComponent>();
-					YAML::Node cameraProperties = cameraComponent["Camera"];
-					cc.Camera.SetProjectionType((SceneCamera::ProjectionType)cameraProperties["ProjectionType"].as<s32>());
-					cc.Camera.SetPerspectiveFOV(cameraProperties["PerspectiveFOV"].as<f32>());
-					cc.Camera.SetPerspectiveNear(cameraProperties["PerspectiveNear"].as<f32>());
-					cc.Camera.SetPerspectiveFar(cameraProperties["PerspectiveFar"].as<f32>());
-					cc.Camera.SetOrthographicSize(cameraProperties["OrthographicSize"].as<f32>());
-					cc.Camera.SetOrthographicNear(cameraProperties["OrthographicNear"].as<f32>());
-					cc.Camera.SetOrthographicFar(cameraProperties["OrthographicFar"].as<f32>());
-					cc.Primary = cameraComponent["Primary"].as<bool>();
-					cc.FixedAspectRatio = cameraComponent["FixedAspectRatio"].as<bool>();
-				}
+				if (lineSize == 0 || line[0] == '\n' || line[0] == '\r' || line[0] == '#')
+					continue;
 
-				if (YAML::Node meshComponent = entities[it]["MeshComponent"])
-				{
-					auto& mc = deserializedEntity.AddComponent<MeshComponent>();
-					mc.Mesh = AssetManager::GetAsset<Mesh>(meshComponent["Mesh"].as<u64>(), true);
-				}
+				bool isItem = line[0] == '-' && (lineSize == 1 || line[1] == ' ' || line[1] == '\n' || line[1] == '\r');
 
-				if (YAML::Node skyLightComponent = entities[it]["SkyLightComponent"])
+				if (itemIndent == UINT64_MAX)
 				{
-					auto& slc = deserializedEntity.AddComponent<SkyLightComponent>();
-					slc.EnvironmentMap = AssetManager::GetAsset<TextureCube>(skyLightComponent["EnvironmentMap"].as<u64>(), true);
-				}
+					// Empty lists are written as a flow sequence
+					if (!isItem)
+						break;
 
-				if (YAML::Node dirLightComponent = entities[it]["DirectionalLightComponent"])
-				{
-					auto& dlc = deserializedEntity.AddComponent<DirectionalLightComponent>();
-					dlc.Color = dirLightComponent["Color"].as<glm::vec3>();
-					dlc.Intensity = dirLightComponent["Intensity"].as<f32>();
+					itemIndent = indent;
 				}
 
-				if (YAML::Node pointLightComponent = entities[it]["PointLightComponent"])
+				if (indent < itemIndent || (indent == itemIndent && !isItem))
 				{
-					auto& plc = deserializedEntity.AddComponent<PointLightComponent>();
-					plc.Color = pointLightComponent["Color"].as<glm::vec3>();
-					plc.Intensity = pointLightComponent["Intensity"].as<f32>();
-					plc.AttenuationFactors = pointLightComponent["AttenuationFactors"].as<glm::vec3>();
+					listEnd = lineStart;
+					break;
 				}
 
-				if (YAML::Node spotLightComponent = entities[it]["SpotLightComponent"])
-				{
-					auto& slc = deserializedEntity.AddComponent<SpotLightComponent>();
-					slc.Color = spotLightComponent["Color"].as<glm::vec3>();
-					slc.Direction = spotLightComponent["Direction"].as<glm::vec3>();
-					slc.ConeAngle = spotLightComponent["ConeAngle"].as<f32>();
-					slc.Intensity = spotLightComponent["Intensity"].as<f32>();
-					slc.AttenuationFactors = spotLightComponent["AttenuationFactors"].as<glm::vec3>();
-				}
+				if (indent == itemIndent)
+					entityOffsets.push_back(lineStart);
+			}
 
-				if (YAML::Node scriptComponent = entities[it]["ScriptComponent"])
-				{
-					auto& sc = deserializedEntity.AddComponent<ScriptComponent>();
-					sc.ScriptClass = scriptComponent["ScriptClass"].as<String>();
-				}
+			if (!entityOffsets.empty())
+				entityOffsets.push_back(listEnd);
 
-				if (YAML::Node ribidbodyComponent = entities[it]["RigidbodyComponent"])
-				{
-					auto& rbc = deserializedEntity.AddComponent<RigidbodyComponent>();
-					rbc.Type = (RigidbodyComponent::RigidbodyType)ribidbodyComponent["Type"].as<s32>();
-					rbc.Mass = ribidbodyComponent["Mass"].as<f32>();
-					rbc.FixedRotation = ribidbodyComponent["FixedRotation"].as<glm::vec3>();
-				}
+			return entitiesKey;
+		}
+	}
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    SceneSerializer::SceneSerializer(const Ref<Scene>& scene)
+        : m_Scene(scene)
+    {
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void SceneSerializer::Serialize(const std::filesystem::path& filepath)
+    {
+		// Entities are streamed to the file block by block instead of building the whole document in memory
+		Vector<char> streamBuffer(1024 * 1024);
+		std::ofstream fout;
+		fout.rdbuf()->pubsetbuf(streamBuffer.data(), streamBuffer.size());
+		fout.open(filepath);
+
+		YAML::Emitter header;
+		header << YAML::BeginMap;
+		header << YAML::Key << "Scene" << YAML::Value << m_Scene->GetName();
+		header << YAML::EndMap;
+		fout << header.c_str() << "\nEntities:\n";
+
+		Vector<entt::entity> entities;
+		entities.reserve(m_Scene->m_Registry.alive());
+		m_Scene->m_Registry.each([&](auto entityID) { entities.push_back(entityID); });
+
+		// Batches of a block are emitted on the worker threads, each into its own sequence, and then written in order
+		Vector<String> emittedBatches(Utils::EntityBlockSize);
+
+		for (u32 blockStart = 0; blockStart < entities.size(); blockStart += Utils::EntityBlockSize)
+		{
+			u32 blockSize = std::min<u32>(Utils::EntityBlockSize, entities.size() - blockStart);
+
+			Application::Get().GetWorkerThreadPool().ParallelFor(blockSize, Utils::EntityBatchSize, [&](u32 begin, u32 end)
+			{
+				YAML::Emitter out;
+				out << YAML::BeginSeq;
+
+				for (u32 i = begin; i < end; i++)
+					Utils::SerializeEntity(out, { entities[blockStart + i], m_Scene.get() });
+
+				out << YAML::EndSeq;
+				emittedBatches[begin] = out.c_str();
+			});
+
+			for (u32 i = 0; i < blockSize; i++)
+			{
+				if (emittedBatches[i].empty())
+					continue;
+
+				fout << emittedBatches[i] << '\n';
+				emittedBatches[i].clear();
+			}
+		}
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool SceneSerializer::Deserialize(const std::filesystem::path& filepath)
+    {
+		MappedFile file(filepath);
+
+		if (!file.IsValid())
+			return false;
+
+		// Only the header is parsed as a whole, the entity list is split into batches that are parsed independently
+		const char* text = (const char*)file.GetData();
+		Vector<u64> entityOffsets;
+		u64 entitiesKey = Utils::SplitEntityList(text, file.GetSize(), entityOffsets);
+
+		YAML::Node data;
+
+		try
+		{
+			data = YAML::Load(String(text, entitiesKey));
+		}
+		catch (const YAML::Exception& e)
+		{
+			ATOM_ERROR("Failed parsing scene {}: {}", filepath, e.what());
+			return false;
+		}
+
+		if (!data["Scene"])
+			return false;
+
+		String sceneName = data["Scene"].as<String>();
+		u32 entityCount = entityOffsets.empty() ? 0 : entityOffsets.size() - 1;
+		ATOM_INFO("Deserializing scene '{0}' with {1} entities", sceneName, entityCount);
+
+		Vector<Utils::DeserializedEntity> entities(entityCount);
+		std::atomic<bool> failed = false;
+
+		Application::Get().GetWorkerThreadPool().ParallelFor(entityCount, Utils::EntityBatchSize, [&](u32 begin, u32 end)
+		{
+			try
+			{
+				YAML::Node batch = YAML::Load(String(text + entityOffsets[begin], entityOffsets[end] - entityOffsets[begin]));
 
-				if (YAML::Node boxColliderComponent = entities[it]["BoxColliderComponent"])
+				if (!batch.IsSequence() || batch.size() != end - begin)
 				{
-					auto& bcc = deserializedEntity.AddComponent<BoxColliderComponent>();
-					bcc.Center = boxColliderComponent["Center"].as<glm::vec3>();
-					bcc.Size = boxColliderComponent["Size"].as<glm::vec3>();
-					bcc.Restitution = boxColliderComponent["Restitution"].as<f32>();
-					bcc.StaticFriction = boxColliderComponent["StaticFriction"].as<f32>();
-					bcc.DynamicFriction = boxColliderComponent["DynamicFriction"].as<f32>();
+					ATOM_ERROR("Failed parsing scene {}: entity list is malformed", filepath);
+					failed = true;
+					return;
 				}
+
+				for (u32 i = begin; i < end; i++)
+					Utils::DeserializeEntity(batch[i - begin], entities[i]);
+			}
+			catch (const YAML::Exception& e)
+			{
+				ATOM_ERROR("Failed parsing scene {}: {}", filepath, e.what());
+				failed = true;
 			}
+		});
+
+		if (failed)
+			return false;
+
+		// Entities are created in reverse order, so the registry iterates them in the order they were saved in
+		for (s64 it = (s64)entityCount - 1; it >= 0; it--)
+		{
+			const Utils::DeserializedEntity& deserializedEntity = entities[it];
+			Entity entity = m_Scene->CreateEntityFromUUID(deserializedEntity.ID, deserializedEntity.Name);
+
+			if (deserializedEntity.SceneHierarchy)
+				entity.GetComponent<SceneHierarchyComponent>() = *deserializedEntity.SceneHierarchy;
+
+			if (deserializedEntity.Transform)
+				entity.GetComponent<TransformComponent>() = *deserializedEntity.Transform;
+
+			if (deserializedEntity.Camera)
+				entity.AddComponent<CameraComponent>(*deserializedEntity.Camera);
+
+			if (deserializedEntity.Mesh)
+				entity.AddComponent<MeshComponent>(*deserializedEntity.Mesh != 0 ? AssetManager::GetAsset<Mesh>(*deserializedEntity.Mesh, true) : nullptr);
+
+			if (deserializedEntity.EnvironmentMap)
+				entity.AddComponent<SkyLightComponent>(*deserializedEntity.EnvironmentMap != 0 ? AssetManager::GetAsset<TextureCube>(*deserializedEntity.EnvironmentMap, true) : nullptr);
+
+			if (deserializedEntity.DirectionalLight)
+				entity.AddComponent<DirectionalLightComponent>(*deserializedEntity.DirectionalLight);
+
+			if (deserializedEntity.PointLight)
+				entity.AddComponent<PointLightComponent>(*deserializedEntity.PointLight);
+
+			if (deserializedEntity.SpotLight)
+				entity.AddComponent<SpotLightComponent>(*deserializedEntity.SpotLight);
+
+			if (deserializedEntity.Script)
+				entity.AddComponent<ScriptComponent>(*deserializedEntity.Script);
+
+			if (deserializedEntity.Rigidbody)
+				entity.AddComponent<RigidbodyComponent>(*deserializedEntity.Rigidbody);
+
+			if (deserializedEntity.BoxCollider)
+				entity.AddComponent<BoxColliderComponent>(*deserializedEntity.BoxCollider);
 		}
 
 		return true;
@@ -742,7 +742,9 @@ namespace Atom
         py::class_<wrappers::AnimationController>(m, "AnimationController")
             .def(py::init<u64>())
             .def_static("find", &wrappers::AnimationController::Find)
-            .def("transition_to_state", &wrappers::AnimationController::TransitionToState)
+            .def("transition_to_state", &wrappers::AnimationController::TransitionToState, py::arg("state"), py::arg("transition_duration") = 0.0f)
+            .def_property("blend_parameter", &wrappers::AnimationController::GetBlendParameter, &wrappers::AnimationController::SetBlendParameter)
+            .def_property_readonly("current_state_index", &wrappers::AnimationController::GetCurrentStateIndex)
             .def_property_readonly("current_state", &wrappers::AnimationController::GetCurrentState)
             .def_property_readonly("initial_state", &wrappers::AnimationController::GetInitialState)
             .def_property_readonly("animation_states", &wrappers::AnimationController::GetAnimationStates);
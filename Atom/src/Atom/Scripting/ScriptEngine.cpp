@@ -38,36 +38,12 @@ namespace Atom
             LoadScriptModules();
             LoadScriptClasses();
 
-            ms_FileWatcher = CreateScope<filewatch::FileWatch<std::filesystem::path>>(ms_AppScriptsDirectory, [](const std::filesystem::path& path, const filewatch::Event changeType)
+            ms_FileWatcher = CreateScope<FileWatcher>(ms_AppScriptsDirectory, [](const Vector<FileChangeEvent>& changes)
             {
-                if (changeType == filewatch::Event::added)
+                Application::Get().SubmitForMainThreadExecution([changes]()
                 {
-                    Application::Get().SubmitForMainThreadExecution([=]()
-                    {
-                        ScriptEngine::LoadScriptModule(path);
-                        ScriptEngine::LoadScriptClasses();
-                    });
-                }
-                else if (changeType == filewatch::Event::modified && !ms_PendingScriptReload)
-                {
-                    ms_PendingScriptReload = true;
-
-                    using namespace std::literals;
-                    std::this_thread::sleep_for(1000ms);
-
-                    Application::Get().SubmitForMainThreadExecution([]()
-                    {
-                        ScriptEngine::ReloadScriptModules();
-                        ScriptEngine::LoadScriptClasses();
-                    });
-                }
-                else if (changeType == filewatch::Event::removed)
-                {
-                    Application::Get().SubmitForMainThreadExecution([=]()
-                    {
-                        ScriptEngine::UnloadScriptModule(path.stem().string());
-                    });
-                }
+                    ScriptEngine::OnScriptFilesChanged(changes);
+                });
             });
         }
         catch (py::error_already_set& e)
@@ -79,6 +55,7 @@ namespace Atom
     // -----------------------------------------------------------------------------------------------------------------------------
     void ScriptEngine::Shutdown()
     {
+        ms_FileWatcher.reset();
         ms_RunningScene = nullptr;
         ms_ScriptCoreModule.release();
         ms_EntityClass = py::none();
@@ -379,7 +356,6 @@ namespace Atom
 
             ms_EntityClass = ms_ScriptCoreModule.attr("Entity");
 
-            ms_PendingScriptReload = false;
             ATOM_INFO("Scripts reloaded");
         }
         catch (py::error_already_set& e)
@@ -388,6 +364,35 @@ namespace Atom
         }
     }
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void ScriptEngine::OnScriptFilesChanged(const Vector<FileChangeEvent>& changes)
+    {
+        bool reloadModules = false;
+        bool reloadClasses = false;
+
+        for (const FileChangeEvent& event : changes)
+        {
+            if (event.Filepath.extension() != ".py")
+                continue;
+
+            if (event.Change == FileChange::Added)
+                LoadScriptModule(event.Filepath);
+            else if (event.Change == FileChange::Removed)
+                UnloadScriptModule(event.Filepath.stem().string());
+            else
+                reloadModules = true;
+
+            reloadClasses = true;
+        }
+
+        // All modules are reloaded at once, no matter how many of them changed
+        if (reloadModules)
+            ReloadScriptModules();
+
+        if (reloadClasses)
+            LoadScriptClasses();
+    }
+
     // -----------------------------------------------------ScriptClass-------------------------------------------------------------
     // -----------------------------------------------------------------------------------------------------------------------------
     ScriptClass::ScriptClass(const py::object& pythonClass)
@@ -2,12 +2,12 @@
 
 #include "Atom/Core/Core.h"
 #include "Atom/Core/Timestep.h"
+#include "Atom/Core/FileWatcher.h"
 #include "Atom/Core/Events/Events.h"
 #include "Atom/Scene/Entity.h"
 
 #include <pybind11/pybind11.h>
 #include <pybind11/embed.h>
-#include <FileWatch.h>
 
 namespace Atom
 {
@@ -142,6 +142,7 @@ namespace Atom
         static void LoadScriptModule(const std::filesystem::path& filepath);
         static void UnloadScriptModule(const String& moduleName);
         static void ReloadScriptModules();
+        static void OnScriptFilesChanged(const Vector<FileChangeEvent>& changes);
     private:
         inline static Scene*                                             ms_RunningScene = nullptr;
         inline static HashMap<String, Ref<ScriptClass>>                  ms_ScriptClasses;
@@ -151,7 +152,6 @@ namespace Atom
         inline static pybind11::object                                   ms_EntityClass;
         inline static pybind11::module                                   ms_ScriptCoreModule;
         inline static Vector<pybind11::module>                           ms_AppScriptModules;
-        inline static Scope<filewatch::FileWatch<std::filesystem::path>> ms_FileWatcher;
-        inline static bool                                               ms_PendingScriptReload = false;
+        inline static Scope<FileWatcher>                                 ms_FileWatcher;
     };
 }
\ No newline at end of file
@@ -81,19 +81,52 @@ namespace Atom
         }
 
         // -----------------------------------------------------------------------------------------------------------------------------
-        void AnimationController::TransitionToState(u16 state)
+        void AnimationController::TransitionToState(u16 state, f32 transitionDuration)
         {
             if (m_AnimationController)
-                m_AnimationController->TransitionToState(state);
+                m_AnimationController->TransitionToState(state, transitionDuration);
             else
                 ATOM_ERROR("AnimationController::TransitionToState called on a NULL asset");
         }
 
+        // -----------------------------------------------------------------------------------------------------------------------------
+        void AnimationController::SetBlendParameter(const glm::vec2& value)
+        {
+            if (m_AnimationController)
+                m_AnimationController->SetBlendParameter(value);
+            else
+                ATOM_ERROR("AnimationController::SetBlendParameter called on a NULL asset");
+        }
+
+        // -----------------------------------------------------------------------------------------------------------------------------
+        glm::vec2 AnimationController::GetBlendParameter() const
+        {
+            if (m_AnimationController)
+                return m_AnimationController->GetBlendParameter();
+
+            ATOM_ERROR("AnimationController::GetBlendParameter called on a NULL asset");
+            return glm::vec2(0.0f);
+        }
+
+        // -----------------------------------------------------------------------------------------------------------------------------
+        u16 AnimationController::GetCurrentStateIndex() const
+        {
+            if (m_AnimationController)
+                return m_AnimationController->GetCurrentStateIdx();
+
+            ATOM_ERROR("AnimationController::GetCurrentStateIndex called on a NULL asset");
+            return 0;
+        }
+
         // -----------------------------------------------------------------------------------------------------------------------------
         Animation AnimationController::GetInitialState() const
         {
+            // Blend states are represented by their first animation
             if (m_AnimationController)
-                return Animation(m_AnimationController->GetInitialState()->GetUUID());
+            {
+                const AnimationState& state = m_AnimationController->GetInitialState();
+                return Animation(!state.Animations.empty() ? state.Animations[0] : nullptr);
+            }
 
             ATOM_ERROR("AnimationController::GetInitialState called on a NULL asset");
             return Animation(0);
@@ -103,7 +136,10 @@ namespace Atom
         Animation AnimationController::GetCurrentState() const
         {
             if (m_AnimationController)
-                return Animation(m_AnimationController->GetCurrentState()->GetUUID());
+            {
+                const AnimationState& state = m_AnimationController->GetCurrentState();
+                return Animation(!state.Animations.empty() ? state.Animations[0] : nullptr);
+            }
 
             ATOM_ERROR("AnimationController::GetCurrentState called on a NULL asset");
             return Animation(0);
@@ -113,7 +149,14 @@ namespace Atom
         pybind11::list AnimationController::GetAnimationStates() const
         {
             if (m_AnimationController)
-                return pybind11::cast(m_AnimationController->GetAnimationStates());
+            {
+                pybind11::list states;
+
+                for (auto& state : m_AnimationController->GetAnimationStates())
+                    states.append(Animation(!state.Animations.empty() ? state.Animations[0] : nullptr));
+
+                return states;
+            }
 
             ATOM_ERROR("AnimationController::GetAnimationStates called on a NULL asset");
             return pybind11::none();
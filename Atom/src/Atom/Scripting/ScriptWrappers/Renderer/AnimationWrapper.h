@@ -33,8 +33,11 @@ namespace Atom
             AnimationController(u64 assetUUID);
             AnimationController(const Ref<Atom::AnimationController>& controller);
 
-            void TransitionToState(u16 state);
+            void TransitionToState(u16 state, f32 transitionDuration);
+            void SetBlendParameter(const glm::vec2& value);
 
+            glm::vec2 GetBlendParameter() const;
+            u16 GetCurrentStateIndex() const;
             Animation GetInitialState() const;
             Animation GetCurrentState() const;
             pybind11::list GetAnimationStates() const;
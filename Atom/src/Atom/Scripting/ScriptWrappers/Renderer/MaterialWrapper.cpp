@@ -14,6 +14,7 @@ namespace Atom
             Ref<GraphicsShader> shader = ShaderLibrary::Get().Get<GraphicsShader>("MeshPBRShader");
             m_Material = CreateRef<Atom::Material>(shader, MaterialFlags::DepthTested);
             AssetManager::RegisterAsset(m_Material);
+            m_Material = AssetManager::GetAsset<Atom::Material>(m_Material->GetUUID());
         }
 
         // -----------------------------------------------------------------------------------------------------------------------------
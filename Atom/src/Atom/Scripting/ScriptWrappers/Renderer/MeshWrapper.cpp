@@ -12,6 +12,7 @@ namespace Atom
         {
             m_Mesh = CreateRef<Atom::Mesh>();
             AssetManager::RegisterAsset(m_Mesh);
+            m_Mesh = AssetManager::GetAsset<Atom::Mesh>(m_Mesh->GetUUID());
         }
 
         // -----------------------------------------------------------------------------------------------------------------------------
@@ -13,6 +13,7 @@ namespace Atom
         {
             m_TextureAsset = CreateRef<Atom::Texture2D>(width, height, format, mipCount, cpuReadable, gpuWritable);
             AssetManager::RegisterAsset(m_TextureAsset);
+            m_TextureAsset = AssetManager::GetAsset<Atom::TextureAsset>(m_TextureAsset->GetUUID());
         }
 
         // -----------------------------------------------------------------------------------------------------------------------------
@@ -20,6 +21,7 @@ namespace Atom
         {
             m_TextureAsset = CreateRef<Atom::TextureCube>(cubeSize, format, mipCount, cpuReadable, gpuWritable);
             AssetManager::RegisterAsset(m_TextureAsset);
+            m_TextureAsset = AssetManager::GetAsset<Atom::TextureAsset>(m_TextureAsset->GetUUID());
         }
 
         // -----------------------------------------------------------------------------------------------------------------------------
@@ -2,11 +2,13 @@
 #include "ContentTools.h"
 
 #include "Atom/Asset/AssetSerializer.h"
+#include "Atom/Asset/AssetPack.h"
 #include "Atom/Asset/AnimationControllerAsset.h"
 #include "Atom/Asset/MeshAsset.h"
 #include "Atom/Renderer/Renderer.h"
 #include "Atom/Renderer/ShaderLibrary.h"
 #include "Atom/Scene/Scene.h"
+#include "Atom/Tools/DerivedDataCache.h"
 
 #include "stb_image.h"
 #include <assimp/Importer.hpp>
@@ -89,184 +91,772 @@ namespace Atom
 
             return result;
         }
-    }
-
-    // -----------------------------------------------------------------------------------------------------------------------------
-    UUID ContentTools::ImportTextureAsset(const std::filesystem::path& sourcePath, const std::filesystem::path& destinationFolder, const TextureImportSettings& importSettings)
-    {
-        const char* extension = Asset::AssetFileExtensions[importSettings.IsCubeMap ? (u32)AssetType::TextureCube : (u32)AssetType::Texture2D];
-        String assetFilename = sourcePath.stem().string() + extension;
-        std::filesystem::path assetFullPath = AssetManager::GetAssetFullPath(destinationFolder / assetFilename);
 
-        if (std::filesystem::exists(assetFullPath))
+        // Removes every key that can be reconstructed by interpolating its neighbours within the given tolerance. Channels which stay within
+        // the tolerance of their first key for the whole animation are collapsed into a single key.
+        template<typename T, typename InterpolateFn, typename ErrorFn>
+        static void ReduceChannelKeys(Vector<f32>& timeStamps, Vector<T>& values, f32 tolerance, InterpolateFn interpolate, ErrorFn error)
         {
-            ATOM_WARNING("Texture {} already exists", assetFullPath.string());
-            return AssetManager::GetUUIDForAssetPath(assetFullPath);
-        }
+            if (values.size() < 2)
+                return;
 
-        if (!std::filesystem::exists(assetFullPath.parent_path()))
-            std::filesystem::create_directories(assetFullPath.parent_path());
+            bool isConstant = true;
+            for (u32 keyIdx = 1; keyIdx < values.size() && isConstant; keyIdx++)
+                isConstant = error(values[0], values[keyIdx]) <= tolerance;
 
-        Ref<Texture> texture = ContentTools::ImportTexture(sourcePath, importSettings);
-        if (!texture)
-        {
-            ATOM_ERROR("Failed creating texture asset {}", assetFullPath);
-            return 0;
+            if (isConstant)
+            {
+                timeStamps.resize(1);
+                values.resize(1);
+                return;
+            }
+
+            Vector<f32> reducedTimeStamps = { timeStamps[0] };
+            Vector<T> reducedValues = { values[0] };
+            u32 anchorIdx = 0;
+
+            for (u32 keyIdx = 1; keyIdx + 1 < values.size(); keyIdx++)
+            {
+                // Check if all keys between the last kept key and the next one are still reproduced if the current key is dropped
+                u32 nextIdx = keyIdx + 1;
+                bool canDropKey = true;
+
+                for (u32 testIdx = anchorIdx + 1; testIdx < nextIdx && canDropKey; testIdx++)
+                {
+                    f32 interpolationFactor = (timeStamps[testIdx] - timeStamps[anchorIdx]) / (timeStamps[nextIdx] - timeStamps[anchorIdx]);
+                    canDropKey = error(interpolate(values[anchorIdx], values[nextIdx], interpolationFactor), values[testIdx]) <= tolerance;
+                }
+
+                if (!canDropKey)
+                {
+                    reducedTimeStamps.push_back(timeStamps[keyIdx]);
+                    reducedValues.push_back(values[keyIdx]);
+                    anchorIdx = keyIdx;
+                }
+            }
+
+            reducedTimeStamps.push_back(timeStamps.back());
+            reducedValues.push_back(values.back());
+
+            timeStamps = std::move(reducedTimeStamps);
+            values = std::move(reducedValues);
         }
 
-        Ref<Asset> asset = nullptr;
-        if (importSettings.IsCubeMap)
-            asset = CreateRef<TextureCube>(texture, importSettings.IsReadable);
-        else
-            asset = CreateRef<Texture2D>(texture, importSettings.IsReadable);
+        // Returns false if the quantization error of a channel alone exceeds its tolerance
+        static bool ReduceTrackKeys(Animation::BoneTrack& track, const MeshImportSettings& importSettings)
+        {
+            auto mixVec3 = [](const glm::vec3& a, const glm::vec3& b, f32 t) { return glm::mix(a, b, t); };
+            auto distanceVec3 = [](const glm::vec3& a, const glm::vec3& b) { return glm::distance(a, b); };
 
-        asset->m_MetaData.SourceFilepath = sourcePath;
+            // The error of rotations is the angle between them
+            auto slerpQuat = [](const glm::quat& a, const glm::quat& b, f32 t) { return glm::slerp(a, b, t); };
+            auto angleQuat = [](const glm::quat& a, const glm::quat& b) { return 2.0f * glm::acos(glm::min(glm::abs(glm::dot(glm::normalize(a), glm::normalize(b))), 1.0f)); };
 
-        if (importSettings.IsReadable)
+            // The kept keys are quantized afterwards, so only the part of the tolerance that quantization leaves can be spent on dropping keys
+            f32 positionError = Animation::GetQuantizationError(track.Positions);
+            f32 rotationError = Animation::GetRotationQuantizationError();
+            f32 scaleError = Animation::GetQuantizationError(track.Scales);
+            f32 rotationTolerance = glm::radians(importSettings.RotationTolerance);
+
+            ReduceChannelKeys(track.PositionTimeStamps, track.Positions, glm::max(importSettings.PositionTolerance - positionError, 0.0f), mixVec3, distanceVec3);
+            ReduceChannelKeys(track.RotationTimeStamps, track.Rotations, glm::max(rotationTolerance - rotationError, 0.0f), slerpQuat, angleQuat);
+            ReduceChannelKeys(track.ScaleTimeStamps, track.Scales, glm::max(importSettings.ScaleTolerance - scaleError, 0.0f), mixVec3, distanceVec3);
+
+            return positionError <= importSettings.PositionTolerance && rotationError <= rotationTolerance && scaleError <= importSettings.ScaleTolerance;
+        }
+
+        // Orders the bones depth first so that every parent comes before its children and the bones of a limb end up next to each other.
+        // The new ID of every input bone is written to boneIDRemap.
+        static void SortBonesTopologically(const Vector<Skeleton::Bone>& bones, Vector<Skeleton::Bone>& sortedBones, Vector<u32>& boneIDRemap)
         {
-            if (importSettings.IsCubeMap)
+            u32 boneCount = bones.size();
+
+            // Store the children of every bone as a range in one flat array
+            Vector<u32> childOffsets(boneCount + 1, 0);
+            for (auto& bone : bones)
             {
-                Ref<TextureCube> textureCube = std::static_pointer_cast<TextureCube>(asset);
-                textureCube->SetFilter(importSettings.Filter);
-                textureCube->SetWrap(importSettings.Wrap);
+                if (bone.ParentID != UINT32_MAX)
+                    childOffsets[bone.ParentID + 1]++;
+            }
 
-                for (u32 face = 0; face < 6; face++)
-                {
-                    for (u32 mip = 0; mip < textureCube->GetMipLevels(); mip++)
-                    {
-                        Ref<ReadbackBuffer> buffer = Renderer::ReadbackTextureData(textureCube->GetResource(), mip, face);
+            for (u32 boneID = 0; boneID < boneCount; boneID++)
+                childOffsets[boneID + 1] += childOffsets[boneID];
 
-                        Vector<byte> pixelData(buffer->GetSize(), 0);
-                        void* mappedData = buffer->Map(0, 0);
-                        memcpy(pixelData.data(), mappedData, pixelData.size());
-                        buffer->Unmap();
+            Vector<u32> children(childOffsets[boneCount]);
+            Vector<u32> childCounts(boneCount, 0);
 
-                        textureCube->SetPixels(pixelData, face, mip);
-                    }
-                }
+            for (u32 boneID = 0; boneID < boneCount; boneID++)
+            {
+                u32 parentID = bones[boneID].ParentID;
+
+                if (parentID != UINT32_MAX)
+                    children[childOffsets[parentID] + childCounts[parentID]++] = boneID;
             }
-            else
+
+            // Bones are pushed in reverse so that siblings keep their original order
+            Vector<u32> stack;
+            stack.reserve(boneCount);
+
+            for (u32 boneID = boneCount; boneID-- > 0;)
             {
-                Ref<Texture2D> texture2D = std::static_pointer_cast<Texture2D>(asset);
-                texture2D->SetFilter(importSettings.Filter);
-                texture2D->SetWrap(importSettings.Wrap);
+                if (bones[boneID].ParentID == UINT32_MAX)
+                    stack.push_back(boneID);
+            }
 
-                for (u32 mip = 0; mip < texture2D->GetMipLevels(); mip++)
-                {
-                    Ref<ReadbackBuffer> buffer = Renderer::ReadbackTextureData(texture2D->GetResource(), mip);
+            sortedBones.clear();
+            sortedBones.reserve(boneCount);
+            boneIDRemap.assign(boneCount, UINT32_MAX);
 
-                    Vector<byte> pixelData(buffer->GetSize(), 0);
-                    void* mappedData = buffer->Map(0, 0);
-                    memcpy(pixelData.data(), mappedData, pixelData.size());
-                    buffer->Unmap();
+            while (!stack.empty())
+            {
+                u32 boneID = stack.back();
+                stack.pop_back();
 
-                    texture2D->SetPixels(pixelData, mip);
-                }
+                boneIDRemap[boneID] = sortedBones.size();
+
+                // The parent was already visited so its new ID is known
+                Skeleton::Bone& bone = sortedBones.emplace_back(bones[boneID]);
+                bone.ID = boneIDRemap[boneID];
+                bone.ParentID = bone.ParentID != UINT32_MAX ? boneIDRemap[bone.ParentID] : UINT32_MAX;
+
+                for (u32 childIdx = childOffsets[boneID + 1]; childIdx-- > childOffsets[boneID];)
+                    stack.push_back(children[childIdx]);
             }
         }
 
-        bool result = false;
-        if (importSettings.IsCubeMap)
-            result = AssetSerializer::Serialize(assetFullPath, std::static_pointer_cast<TextureCube>(asset));
-        else
-            result = AssetSerializer::Serialize(assetFullPath, std::static_pointer_cast<Texture2D>(asset));
-
-        if (!result)
+        struct ImportedTexture
         {
-            ATOM_ERROR("Failed serializing texture asset {}", assetFullPath);
-            return 0;
+            String        UniformName;
+            TextureFormat Format = TextureFormat::RGBA8;
+            String        Filepath;     // Relative to the directory of the source file, empty for embedded textures
+            String        EmbeddedName;
+            Vector<byte>  EmbeddedData; // Compressed image data of embedded textures
+        };
+
+        struct ImportedMaterial
+        {
+            String                  Name;
+            MaterialFlags           Flags = MaterialFlags::None;
+            bool                    HasAlbedoColor = false;
+            glm::vec4               AlbedoColor = glm::vec4(1.0f);
+            bool                    HasRoughness = false;
+            f32                     Roughness = 0.0f;
+            bool                    HasMetalness = false;
+            f32                     Metalness = 0.0f;
+            Vector<ImportedTexture> Textures;
+        };
+
+        struct ImportedAnimation
+        {
+            String                       Name;
+            f32                          Duration = 0.0f;
+            f32                          TicksPerSecond = 0.0f;
+            Vector<Animation::BoneTrack> Tracks; // Bone IDs refer to Bones before the skeleton sorts them
+        };
+
+        // Everything the mesh importer reads from the source file, after post processing and key reduction. The assets are created from
+        // it, so it is what the derived data cache stores for meshes. The assets themselves can't be cached since they reference each other by UUID.
+        struct MeshImportData
+        {
+            MeshDescription           Geometry; // Without a material table
+            Vector<Skeleton::Bone>    Bones;
+            Vector<ImportedAnimation> Animations;
+            Vector<ImportedMaterial>  Materials;
+            String                    MaterialShaderName;
+        };
+
+        static void WriteString(AssetFileWriter& writer, const String& value)
+        {
+            u32 size = value.size();
+            writer.Write(size);
+            writer.Write(value.data(), size);
         }
 
-        AssetManager::RegisterAsset(asset->m_MetaData);
-        return asset->m_MetaData.UUID;
-    }
+        static bool ReadString(AssetChunkReader& reader, String& value)
+        {
+            u32 size = 0;
+            if (!reader.Read(size) || size > reader.GetRemainingSize())
+                return false;
 
-    // -----------------------------------------------------------------------------------------------------------------------------
-    UUID ContentTools::ImportTextureAsset(const byte* compressedData, u32 dataSize, const String& assetName, const std::filesystem::path& destinationFolder, const TextureImportSettings& importSettings)
-    {
-        const char* extension = Asset::AssetFileExtensions[importSettings.IsCubeMap ? (u32)AssetType::TextureCube : (u32)AssetType::Texture2D];
-        String assetFilename = assetName + extension;
-        std::filesystem::path assetFullPath = AssetManager::GetAssetFullPath(destinationFolder / assetFilename);
+            value.resize(size);
+            return reader.Read(value.data(), size);
+        }
 
-        if (std::filesystem::exists(assetFullPath))
+        template<typename T>
+        static void WriteVector(AssetFileWriter& writer, const Vector<T>& values)
         {
-            ATOM_WARNING("Texture {} already exists", assetFullPath.string());
-            return AssetManager::GetUUIDForAssetPath(assetFullPath);
+            u64 count = values.size();
+            writer.Write(count);
+            writer.Write(values.data(), count * sizeof(T));
         }
 
-        if (!std::filesystem::exists(assetFullPath.parent_path()))
-            std::filesystem::create_directories(assetFullPath.parent_path());
+        template<typename T>
+        static bool ReadVector(AssetChunkReader& reader, Vector<T>& values)
+        {
+            u64 count = 0;
+            if (!reader.Read(count) || count > reader.GetRemainingSize() / sizeof(T))
+                return false;
+
+            values.resize(count);
+            return reader.Read(values.data(), count * sizeof(T));
+        }
 
-        Ref<Texture> texture = ContentTools::ImportTexture(compressedData, dataSize, assetName, importSettings);
-        if (!texture)
+        static void SerializeMeshImportData(AssetFileWriter& writer, const MeshImportData& data)
         {
-            ATOM_ERROR("Failed creating texture asset {}", assetFullPath);
-            return 0;
+            writer.BeginChunk(AssetChunkType::Data);
+
+            const MeshDescription& geometry = data.Geometry;
+            WriteVector(writer, geometry.Positions);
+            WriteVector(writer, geometry.UVs);
+            WriteVector(writer, geometry.Normals);
+            WriteVector(writer, geometry.Tangents);
+            WriteVector(writer, geometry.Bitangents);
+            WriteVector(writer, geometry.BoneWeights);
+            WriteVector(writer, geometry.Indices);
+            WriteVector(writer, geometry.Submeshes);
+            WriteVector(writer, data.Bones);
+
+            writer.Write((u32)data.Animations.size());
+            for (auto& animation : data.Animations)
+            {
+                WriteString(writer, animation.Name);
+                writer.Write(animation.Duration);
+                writer.Write(animation.TicksPerSecond);
+                writer.Write((u32)animation.Tracks.size());
+
+                for (auto& track : animation.Tracks)
+                {
+                    writer.Write(track.BoneID);
+                    WriteVector(writer, track.PositionTimeStamps);
+                    WriteVector(writer, track.Positions);
+                    WriteVector(writer, track.RotationTimeStamps);
+                    WriteVector(writer, track.Rotations);
+                    WriteVector(writer, track.ScaleTimeStamps);
+                    WriteVector(writer, track.Scales);
+                }
+            }
+
+            WriteString(writer, data.MaterialShaderName);
+            writer.Write((u32)data.Materials.size());
+            for (auto& material : data.Materials)
+            {
+                WriteString(writer, material.Name);
+                writer.Write(material.Flags);
+                writer.Write(material.HasAlbedoColor);
+                writer.Write(material.AlbedoColor);
+                writer.Write(material.HasRoughness);
+                writer.Write(material.Roughness);
+                writer.Write(material.HasMetalness);
+                writer.Write(material.Metalness);
+                writer.Write((u32)material.Textures.size());
+
+                for (auto& texture : material.Textures)
+                {
+                    WriteString(writer, texture.UniformName);
+                    writer.Write(texture.Format);
+                    WriteString(writer, texture.Filepath);
+                    WriteString(writer, texture.EmbeddedName);
+                    WriteVector(writer, texture.EmbeddedData);
+                }
+            }
+
+            writer.EndChunk();
         }
 
-        Ref<Asset> asset = nullptr;
-        if (importSettings.IsCubeMap)
-            asset = CreateRef<TextureCube>(texture, importSettings.IsReadable);
-        else
-            asset = CreateRef<Texture2D>(texture, importSettings.IsReadable);
+        static bool DeserializeMeshImportData(AssetChunkReader& reader, MeshImportData& data)
+        {
+            MeshDescription& geometry = data.Geometry;
+            bool result = ReadVector(reader, geometry.Positions) &&
+                          ReadVector(reader, geometry.UVs) &&
+                          ReadVector(reader, geometry.Normals) &&
+                          ReadVector(reader, geometry.Tangents) &&
+                          ReadVector(reader, geometry.Bitangents) &&
+                          ReadVector(reader, geometry.BoneWeights) &&
+                          ReadVector(reader, geometry.Indices) &&
+                          ReadVector(reader, geometry.Submeshes) &&
+                          ReadVector(reader, data.Bones);
+
+            u32 animationCount = 0;
+            if (!result || !reader.Read(animationCount))
+                return false;
+
+            for (u32 animationIdx = 0; animationIdx < animationCount; animationIdx++)
+            {
+                ImportedAnimation& animation = data.Animations.emplace_back();
 
-        if (importSettings.IsReadable)
+                u32 trackCount = 0;
+                if (!ReadString(reader, animation.Name) || !reader.Read(animation.Duration) || !reader.Read(animation.TicksPerSecond) || !reader.Read(trackCount))
+                    return false;
+
+                for (u32 trackIdx = 0; trackIdx < trackCount; trackIdx++)
+                {
+                    Animation::BoneTrack& track = animation.Tracks.emplace_back();
+
+                    if (!reader.Read(track.BoneID) ||
+                        !ReadVector(reader, track.PositionTimeStamps) ||
+                        !ReadVector(reader, track.Positions) ||
+                        !ReadVector(reader, track.RotationTimeStamps) ||
+                        !ReadVector(reader, track.Rotations) ||
+                        !ReadVector(reader, track.ScaleTimeStamps) ||
+                        !ReadVector(reader, track.Scales))
+                        return false;
+                }
+            }
+
+            u32 materialCount = 0;
+            if (!ReadString(reader, data.MaterialShaderName) || !reader.Read(materialCount))
+                return false;
+
+            for (u32 materialIdx = 0; materialIdx < materialCount; materialIdx++)
+            {
+                ImportedMaterial& material = data.Materials.emplace_back();
+
+                u32 textureCount = 0;
+                if (!ReadString(reader, material.Name) ||
+                    !reader.Read(material.Flags) ||
+                    !reader.Read(material.HasAlbedoColor) ||
+                    !reader.Read(material.AlbedoColor) ||
+                    !reader.Read(material.HasRoughness) ||
+                    !reader.Read(material.Roughness) ||
+                    !reader.Read(material.HasMetalness) ||
+                    !reader.Read(material.Metalness) ||
+                    !reader.Read(textureCount))
+                    return false;
+
+                for (u32 textureIdx = 0; textureIdx < textureCount; textureIdx++)
+                {
+                    ImportedTexture& texture = material.Textures.emplace_back();
+
+                    if (!ReadString(reader, texture.UniformName) ||
+                        !reader.Read(texture.Format) ||
+                        !ReadString(reader, texture.Filepath) ||
+                        !ReadString(reader, texture.EmbeddedName) ||
+                        !ReadVector(reader, texture.EmbeddedData))
+                        return false;
+                }
+            }
+
+            return reader.GetRemainingSize() == 0;
+        }
+
+        static bool ReadMeshSource(const std::filesystem::path& sourcePath, const MeshImportSettings& importSettings, MeshImportData& data)
         {
-            if (importSettings.IsCubeMap)
+            u32 processingFlags = aiProcess_ImproveCacheLocality |
+                                  aiProcess_LimitBoneWeights |
+                                  aiProcess_RemoveRedundantMaterials |
+                                  aiProcess_SplitLargeMeshes |
+                                  aiProcess_Triangulate |
+                                  aiProcess_GenUVCoords |
+                                  aiProcess_CalcTangentSpace |
+                                  aiProcess_SortByPType |
+                                  aiProcess_FindDegenerates |
+                                  aiProcess_FindInstances |
+                                  aiProcess_ValidateDataStructure |
+                                  aiProcess_OptimizeMeshes |
+                                  aiProcess_JoinIdenticalVertices |
+                                  aiProcess_ConvertToLeftHanded |
+                                  aiProcess_PreTransformVertices;
+
+            if (importSettings.SmoothNormals)
+                processingFlags |= aiProcess_GenSmoothNormals;
+            if (importSettings.ImportAnimations)
             {
-                Ref<TextureCube> textureCube = std::static_pointer_cast<TextureCube>(asset);
-                textureCube->SetFilter(importSettings.Filter);
-                textureCube->SetWrap(importSettings.Wrap);
+                processingFlags &= ~aiProcess_PreTransformVertices;
+                processingFlags |= aiProcess_OptimizeGraph;
+            }
 
-                for (u32 face = 0; face < 6; face++)
+            Assimp::Importer importer;
+            const aiScene* scene = importer.ReadFile(sourcePath.string().c_str(), processingFlags);
+
+            if (!scene)
+            {
+                ATOM_ERROR("Failed importing mesh file {}. Error: {}", sourcePath, importer.GetErrorString());
+                return false;
+            }
+
+            MeshDescription& meshDesc = data.Geometry;
+            meshDesc.Positions.reserve(5000);
+            meshDesc.UVs.reserve(5000);
+            meshDesc.Normals.reserve(5000);
+            meshDesc.Tangents.reserve(5000);
+            meshDesc.Bitangents.reserve(5000);
+            meshDesc.Indices.reserve(10000);
+            meshDesc.Submeshes.reserve(scene->mNumMeshes);
+
+            // Parse all submeshes
+            HashMap<String, std::pair<u32, glm::mat4>> bonesByName;
+
+            for (u32 submeshIdx = 0; submeshIdx < scene->mNumMeshes; submeshIdx++)
+            {
+                aiMesh* submesh = scene->mMeshes[submeshIdx];
+
+                u32 startVertex = meshDesc.Positions.size();
+                u32 startIndex = meshDesc.Indices.size();
+
+                // Construct all vertices
+                u32 vertexCount = 0;
+                for (u32 vertexIdx = 0; vertexIdx < submesh->mNumVertices; vertexIdx++)
                 {
-                    for (u32 mip = 0; mip < textureCube->GetMipLevels(); mip++)
+                    const aiVector3D& position = submesh->mVertices[vertexIdx];
+                    const aiVector3D& texCoord = submesh->mTextureCoords[0][vertexIdx];
+                    const aiVector3D& normal = submesh->mNormals[vertexIdx];
+                    const aiVector3D& tangent = submesh->mTangents[vertexIdx];
+                    const aiVector3D& bitangent = submesh->mBitangents[vertexIdx];
+
+                    meshDesc.Positions.emplace_back(position.x, position.y, position.z);
+                    meshDesc.UVs.emplace_back(texCoord.x, texCoord.y);
+                    meshDesc.Normals.emplace_back(normal.x, normal.y, normal.z);
+                    meshDesc.Tangents.emplace_back(tangent.x, tangent.y, tangent.z);
+                    meshDesc.Bitangents.emplace_back(bitangent.x, bitangent.y, bitangent.z);
+                    vertexCount++;
+                }
+
+                // Construct all indices
+                u32 indexCount = 0;
+                for (u32 faceIdx = 0; faceIdx < submesh->mNumFaces; faceIdx++)
+                {
+                    const aiFace& face = submesh->mFaces[faceIdx];
+                    for (u32 i = 0; i < face.mNumIndices; i++)
                     {
-                        Ref<ReadbackBuffer> buffer = Renderer::ReadbackTextureData(textureCube->GetResource(), mip, face);
+                        meshDesc.Indices.push_back(face.mIndices[i]);
+                        indexCount++;
+                    }
+                }
 
-                        Vector<byte> pixelData(buffer->GetSize(), 0);
-                        void* mappedData = buffer->Map(0, 0);
-                        memcpy(pixelData.data(), mappedData, pixelData.size());
-                        buffer->Unmap();
+                // Parse bone data
+                meshDesc.BoneWeights.resize(startVertex + vertexCount);
+                Vector<u32> boneWeightsPerVertex(vertexCount);
 
-                        textureCube->SetPixels(pixelData, face, mip);
+                for (u32 boneIdx = 0; boneIdx < submesh->mNumBones; boneIdx++)
+                {
+                    aiBone* bone = submesh->mBones[boneIdx];
+                    String boneName = bone->mName.C_Str();
+
+                    if (bonesByName.find(boneName) == bonesByName.end())
+                        bonesByName[boneName] = { bonesByName.size(), AssimpMat4ToGLM(bone->mOffsetMatrix) };
+
+                    for (u32 weightIdx = 0; weightIdx < bone->mNumWeights; weightIdx++)
+                    {
+                        const aiVertexWeight& vertexWeight = bone->mWeights[weightIdx];
+                        u32 currentWeightIdx = boneWeightsPerVertex[vertexWeight.mVertexId]++;
+                        ATOM_ENGINE_ASSERT(currentWeightIdx < Skeleton::Bone::MAX_BONE_WEIGHTS);
+                        meshDesc.BoneWeights[startVertex + vertexWeight.mVertexId].Weights[currentWeightIdx] = { bonesByName.at(boneName).first, vertexWeight.mWeight };
                     }
                 }
+
+                // Create submesh
+                Submesh& sm = meshDesc.Submeshes.emplace_back();
+                sm.StartVertex = startVertex;
+                sm.VertexCount = vertexCount;
+                sm.StartIndex = startIndex;
+                sm.IndexCount = indexCount;
+                sm.MaterialIndex = submesh->mMaterialIndex;
             }
-            else
+
+            if (importSettings.ImportAnimations)
             {
-                Ref<Texture2D> texture2D = std::static_pointer_cast<Texture2D>(asset);
-                texture2D->SetFilter(importSettings.Filter);
-                texture2D->SetWrap(importSettings.Wrap);
+                // Parse the skeleton
+                Vector<Skeleton::Bone>& skeletonBones = data.Bones;
+                skeletonBones.resize(bonesByName.size());
 
-                for (u32 mip = 0; mip < texture2D->GetMipLevels(); mip++)
+                Queue<aiNode*> nodeQueue;
+                nodeQueue.push(scene->mRootNode);
+
+                while (!nodeQueue.empty())
                 {
-                    Ref<ReadbackBuffer> buffer = Renderer::ReadbackTextureData(texture2D->GetResource(), mip);
+                    aiNode* currentNode = nodeQueue.front();
+                    String nodeName = currentNode->mName.C_Str();
 
-                    Vector<byte> pixelData(buffer->GetSize(), 0);
-                    void* mappedData = buffer->Map(0, 0);
-                    memcpy(pixelData.data(), mappedData, pixelData.size());
-                    buffer->Unmap();
+                    if (bonesByName.find(nodeName) != bonesByName.end())
+                    {
+                        // Process the node if it is a bone
+                        auto& [id, inverseBindTransform] = bonesByName[nodeName];
 
-                    texture2D->SetPixels(pixelData, mip);
+                        Skeleton::Bone& bone = skeletonBones[id];
+                        bone.ID = id;
+                        bone.InverseBindTransform = inverseBindTransform;
+
+                        // Find the bone parent
+                        aiNode* currentParent = currentNode->mParent;
+                        while (currentParent)
+                        {
+                            if (bonesByName.find(currentParent->mName.C_Str()) != bonesByName.end())
+                                break;
+
+                            currentParent = currentParent->mParent;
+                        }
+
+                        if (!currentParent)
+                        {
+                            // We found a root node
+                            bone.ParentID = UINT32_MAX;
+                        }
+                        else
+                        {
+                            bone.ParentID = bonesByName.at(currentParent->mName.C_Str()).first;
+                        }
+                    }
+
+                    for (u32 childIdx = 0; childIdx < currentNode->mNumChildren; childIdx++)
+                        nodeQueue.push(currentNode->mChildren[childIdx]);
+
+                    nodeQueue.pop();
+                }
+
+                // Bound the vertices every bone influences in bone space. A skinned vertex is a weighted average of its bone transforms
+                // so the union of the posed boxes of all its bones always contains it.
+                for (u32 vertexIdx = 0; vertexIdx < meshDesc.BoneWeights.size(); vertexIdx++)
+                {
+                    for (auto& [boneID, weight] : meshDesc.BoneWeights[vertexIdx].Weights)
+                    {
+                        if (weight <= 0.0f)
+                            continue;
+
+                        Skeleton::Bone& bone = skeletonBones[boneID];
+                        glm::vec3 position = bone.InverseBindTransform * glm::vec4(meshDesc.Positions[vertexIdx], 1.0f);
+
+                        bone.BoundsMin = glm::min(bone.BoundsMin, position);
+                        bone.BoundsMax = glm::max(bone.BoundsMax, position);
+                    }
+                }
+
+                // Parse all animations
+                for (u32 animationIdx = 0; animationIdx < scene->mNumAnimations; animationIdx++)
+                {
+                    aiAnimation* animation = scene->mAnimations[animationIdx];
+
+                    ImportedAnimation& importedAnimation = data.Animations.emplace_back();
+                    importedAnimation.Name = animation->mName.C_Str();
+                    importedAnimation.Name = importedAnimation.Name.substr(importedAnimation.Name.find_last_of('|') + 1);
+                    importedAnimation.Duration = animation->mDuration;
+                    importedAnimation.TicksPerSecond = animation->mTicksPerSecond;
+
+                    // Construct a track for each animated bone
+                    Vector<Animation::BoneTrack>& tracks = importedAnimation.Tracks;
+                    tracks.reserve(animation->mNumChannels);
+
+                    for (u32 nodeIdx = 0; nodeIdx < animation->mNumChannels; nodeIdx++)
+                    {
+                        aiNodeAnim* node = animation->mChannels[nodeIdx];
+                        String boneName = node->mNodeName.C_Str();
+
+                        if (bonesByName.find(boneName) != bonesByName.end())
+                        {
+                            Animation::BoneTrack& track = tracks.emplace_back();
+                            track.BoneID = bonesByName.at(boneName).first;
+
+                            track.PositionTimeStamps.reserve(node->mNumPositionKeys);
+                            track.Positions.reserve(node->mNumPositionKeys);
+                            for (u32 keyIdx = 0; keyIdx < node->mNumPositionKeys; keyIdx++)
+                            {
+                                const aiVectorKey& posKey = node->mPositionKeys[keyIdx];
+                                track.PositionTimeStamps.push_back(posKey.mTime);
+                                track.Positions.emplace_back(posKey.mValue.x, posKey.mValue.y, posKey.mValue.z);
+                            }
+
+                            track.RotationTimeStamps.reserve(node->mNumRotationKeys);
+                            track.Rotations.reserve(node->mNumRotationKeys);
+                            for (u32 keyIdx = 0; keyIdx < node->mNumRotationKeys; keyIdx++)
+                            {
+                                const aiQuatKey& rotKey = node->mRotationKeys[keyIdx];
+                                track.RotationTimeStamps.push_back(rotKey.mTime);
+                                track.Rotations.emplace_back(rotKey.mValue.w, rotKey.mValue.x, rotKey.mValue.y, rotKey.mValue.z);
+                            }
+
+                            track.ScaleTimeStamps.reserve(node->mNumScalingKeys);
+                            track.Scales.reserve(node->mNumScalingKeys);
+                            for (u32 keyIdx = 0; keyIdx < node->mNumScalingKeys; keyIdx++)
+                            {
+                                const aiVectorKey& scaleKey = node->mScalingKeys[keyIdx];
+                                track.ScaleTimeStamps.push_back(scaleKey.mTime);
+                                track.Scales.emplace_back(scaleKey.mValue.x, scaleKey.mValue.y, scaleKey.mValue.z);
+                            }
+                        }
+                    }
+
+                    if (importSettings.CompressAnimations)
+                    {
+                        u32 uncompressedSize = Animation::GetUncompressedDataSize(tracks);
+                        bool withinTolerance = true;
+
+                        for (auto& track : tracks)
+                            withinTolerance &= ReduceTrackKeys(track, importSettings);
+
+                        if (!withinTolerance)
+                            ATOM_WARNING("Animation {}: quantization alone exceeds the tolerance of some channels", importedAnimation.Name);
+
+                        u32 compressedSize = Animation::GetCompressedDataSize(tracks);
+                        ATOM_INFO("Animation {}: {} bytes -> {} bytes (compression ratio {:.2f})", importedAnimation.Name, uncompressedSize, compressedSize, compressedSize > 0 ? (f32)uncompressedSize / compressedSize : 0.0f);
+                    }
                 }
             }
+
+            // Parse all materials
+            data.MaterialShaderName = importSettings.ImportAnimations && scene->mNumAnimations > 0 ? "MeshPBRAnimatedShader" : "MeshPBRShader";
+
+            for (u32 materialIdx = 0; materialIdx < scene->mNumMaterials; materialIdx++)
+            {
+                const aiMaterial* assimpMat = scene->mMaterials[materialIdx];
+                ImportedMaterial& material = data.Materials.emplace_back();
+
+                // Set the name
+                aiString materialName;
+                assimpMat->Get(AI_MATKEY_NAME, materialName);
+                material.Name = materialName.C_Str();
+
+                // Set albedo color
+                aiColor4D albedo;
+                if (assimpMat->Get(AI_MATKEY_COLOR_DIFFUSE, albedo) == AI_SUCCESS)
+                {
+                    // Set transparency flag
+                    f32 opacity;
+                    if (assimpMat->Get(AI_MATKEY_OPACITY, opacity) == AI_SUCCESS && opacity < 1.0f)
+                    {
+                        material.Flags |= MaterialFlags::Transparent;
+                        albedo.a = opacity;
+                    }
+
+                    material.HasAlbedoColor = true;
+                    material.AlbedoColor = glm::vec4(albedo.r, albedo.g, albedo.b, albedo.a);
+                }
+
+                // Set roughness
+                material.HasRoughness = assimpMat->Get(AI_MATKEY_ROUGHNESS_FACTOR, material.Roughness) == AI_SUCCESS;
+
+                // Set metalness
+                material.HasMetalness = assimpMat->Get(AI_MATKEY_REFLECTIVITY, material.Metalness) == AI_SUCCESS;
+
+                // Set two sided flag
+                bool twoSided;
+                if (assimpMat->Get(AI_MATKEY_TWOSIDED, twoSided) == AI_SUCCESS && twoSided)
+                {
+                    material.Flags |= MaterialFlags::TwoSided;
+                }
+
+                // Set wireframe flag
+                bool wireframe;
+                if (assimpMat->Get(AI_MATKEY_ENABLE_WIREFRAME, wireframe) == AI_SUCCESS && wireframe)
+                {
+                    material.Flags |= MaterialFlags::Wireframe;
+                }
+
+                // Set textures
+                auto AddMaterialTexture = [&](aiTextureType type, const char* uniformName)
+                {
+                    aiString aiPath;
+                    if (assimpMat->GetTexture(type, 0, &aiPath) == AI_SUCCESS)
+                    {
+                        ImportedTexture& texture = material.Textures.emplace_back();
+                        texture.UniformName = uniformName;
+                        texture.Format = type == aiTextureType_METALNESS || type == aiTextureType_SHININESS ? TextureFormat::R8 : TextureFormat::RGBA8;
+
+                        if (const aiTexture* aiTexture = scene->GetEmbeddedTexture(aiPath.C_Str()))
+                        {
+                            // Texture is embedded. Keep the compressed data buffer.
+                            texture.EmbeddedName = std::filesystem::path(aiTexture->mFilename.C_Str()).stem().string();
+                            texture.EmbeddedData.assign((byte*)aiTexture->pcData, (byte*)aiTexture->pcData + aiTexture->mWidth);
+                        }
+                        else
+                        {
+                            texture.Filepath = aiPath.C_Str();
+                        }
+                    }
+                };
+
+                AddMaterialTexture(aiTextureType_DIFFUSE, "AlbedoMap");
+                AddMaterialTexture(aiTextureType_NORMALS, "NormalMap");
+                AddMaterialTexture(aiTextureType_METALNESS, "MetalnessMap");
+                AddMaterialTexture(aiTextureType_SHININESS, "RoughnessMap");
+            }
+
+            return true;
         }
 
-        bool result = false;
-        if (importSettings.IsCubeMap)
-            result = AssetSerializer::Serialize(assetFullPath, std::static_pointer_cast<TextureCube>(asset));
-        else
-            result = AssetSerializer::Serialize(assetFullPath, std::static_pointer_cast<Texture2D>(asset));
+        static DerivedDataKey GetTextureImportKey(const TextureImportSettings& importSettings)
+        {
+            // Settings are appended field by field, padding bytes would make equal settings produce different keys
+            DerivedDataKey key("Texture", ContentTools::TextureImporterVersion);
+            key.Append(importSettings.IsCubeMap);
+            key.Append(importSettings.CubemapSize);
+            key.Append(importSettings.Format);
+            key.Append(importSettings.Filter);
+            key.Append(importSettings.Wrap);
+            key.Append(importSettings.IsReadable);
+
+            // Cached texture chunks are copied as they are, so they are only valid for the data version they were written with
+            key.Append(AssetSerializer::GetDataVersion(importSettings.IsCubeMap ? AssetType::TextureCube : AssetType::Texture2D));
+            return key;
+        }
 
-        if (!result)
+        static DerivedDataKey GetMeshImportKey(const MeshImportSettings& importSettings)
         {
-            ATOM_ERROR("Failed serializing texture asset {}", assetFullPath);
+            // The mesh importer caches MeshImportData, which doesn't depend on IsReadable
+            DerivedDataKey key("Mesh", ContentTools::MeshImporterVersion);
+            key.Append(importSettings.SmoothNormals);
+            key.Append(importSettings.ImportAnimations);
+            key.Append(importSettings.CompressAnimations);
+            key.Append(importSettings.PositionTolerance);
+            key.Append(importSettings.RotationTolerance);
+            key.Append(importSettings.ScaleTolerance);
+            return key;
+        }
+
+        static u64 ComputeTextureContentHash(const Vector<byte>& pixels, TextureFormat format, s32 width, s32 height, const TextureImportSettings& importSettings)
+        {
+            // The decoded pixels are hashed, so the same image is found even if it is stored in different files or encodings
+            DerivedDataKey key = GetTextureImportKey(importSettings);
+            key.Append(format);
+            key.Append(width);
+            key.Append(height);
+            key.Append(AssetFile::ComputeHash(pixels.data(), pixels.size()));
+            return key.GetHash();
+        }
+
+        static std::filesystem::path GetUniqueAssetPath(const std::filesystem::path& assetFullPath)
+        {
+            std::filesystem::path uniquePath = assetFullPath;
+
+            for (u32 suffix = 1; std::filesystem::exists(uniquePath); suffix++)
+                uniquePath = assetFullPath.parent_path() / fmt::format("{}_{}{}", assetFullPath.stem().string(), suffix, assetFullPath.extension().string());
+
+            return uniquePath;
+        }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    UUID ContentTools::ImportTextureAsset(const std::filesystem::path& sourcePath, const std::filesystem::path& destinationFolder, const TextureImportSettings& importSettings)
+    {
+        const char* extension = Asset::AssetFileExtensions[importSettings.IsCubeMap ? (u32)AssetType::TextureCube : (u32)AssetType::Texture2D];
+        String assetFilename = sourcePath.stem().string() + extension;
+        std::filesystem::path assetFullPath = AssetManager::GetAssetFullPath(destinationFolder / assetFilename);
+
+        DerivedDataKey cacheKey = Utils::GetTextureImportKey(importSettings);
+        if (!cacheKey.AppendFile(sourcePath))
+        {
+            ATOM_ERROR("Failed importing texture file {}", sourcePath);
             return 0;
         }
 
-        AssetManager::RegisterAsset(asset->m_MetaData);
-        return asset->m_MetaData.UUID;
+        return CreateTextureAsset(sourcePath.stem().string(), sourcePath, assetFullPath, cacheKey, importSettings, [&](TextureFormat& format, s32& width, s32& height, Vector<byte>& pixels)
+        {
+            return DecodeImage(sourcePath, format, width, height, pixels);
+        });
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    UUID ContentTools::ImportTextureAsset(const byte* compressedData, u32 dataSize, const String& assetName, const std::filesystem::path& destinationFolder, const TextureImportSettings& importSettings)
+    {
+        const char* extension = Asset::AssetFileExtensions[importSettings.IsCubeMap ? (u32)AssetType::TextureCube : (u32)AssetType::Texture2D];
+        String assetFilename = assetName + extension;
+        std::filesystem::path assetFullPath = AssetManager::GetAssetFullPath(destinationFolder / assetFilename);
+
+        DerivedDataKey cacheKey = Utils::GetTextureImportKey(importSettings);
+        cacheKey.Append(compressedData, dataSize);
+
+        return CreateTextureAsset(assetName, "", assetFullPath, cacheKey, importSettings, [&](TextureFormat& format, s32& width, s32& height, Vector<byte>& pixels)
+        {
+            return DecodeImage(compressedData, dataSize, format, width, height, pixels);
+        });
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
@@ -284,321 +874,125 @@ namespace Atom
         if (!std::filesystem::exists(assetFullPath.parent_path()))
             std::filesystem::create_directories(assetFullPath.parent_path());
 
-        u32 processingFlags = aiProcess_ImproveCacheLocality |
-                              aiProcess_LimitBoneWeights |
-                              aiProcess_RemoveRedundantMaterials |
-                              aiProcess_SplitLargeMeshes |
-                              aiProcess_Triangulate |
-                              aiProcess_GenUVCoords |
-                              aiProcess_CalcTangentSpace |
-                              aiProcess_SortByPType |
-                              aiProcess_FindDegenerates |
-                              aiProcess_FindInstances |
-                              aiProcess_ValidateDataStructure |
-                              aiProcess_OptimizeMeshes |
-                              aiProcess_JoinIdenticalVertices |
-                              aiProcess_ConvertToLeftHanded |
-                              aiProcess_PreTransformVertices;
-        
-        if (importSettings.SmoothNormals)
-            processingFlags |= aiProcess_GenSmoothNormals;
-        if (importSettings.ImportAnimations)
-        {
-            processingFlags &= ~aiProcess_PreTransformVertices;
-            processingFlags |= aiProcess_OptimizeGraph;
-        }
-        
-        Assimp::Importer importer;
-        const aiScene* scene = importer.ReadFile(sourcePath.string().c_str(), processingFlags);
+        // Reading the source file is the expensive part of the import, so the data read from it is taken from the derived data cache if possible
+        DerivedDataKey cacheKey = Utils::GetMeshImportKey(importSettings);
+        bool isCacheable = cacheKey.AppendFile(sourcePath);
+
+        Utils::MeshImportData importData;
+        Scope<AssetFileReader> cachedData = isCacheable ? DerivedDataCache::Find(cacheKey) : nullptr;
+        AssetChunkReader cachedChunk = cachedData ? cachedData->GetChunk(AssetChunkType::Data) : AssetChunkReader();
 
-        if (!scene)
+        if (!cachedChunk.IsValid() || !Utils::DeserializeMeshImportData(cachedChunk, importData))
         {
-            ATOM_ERROR("Failed importing mesh file {}. Error: {}", sourcePath, importer.GetErrorString());
-            return 0;
+            if (cachedData)
+                ATOM_WARNING("Derived data cache entry of mesh {} is invalid, importing it again", sourcePath);
+
+            importData = {};
+            if (!Utils::ReadMeshSource(sourcePath, importSettings, importData))
+                return 0;
+
+            if (isCacheable)
+                DerivedDataCache::Store(cacheKey, [&](AssetFileWriter& writer) { Utils::SerializeMeshImportData(writer, importData); }, AssetCompression::LZ);
         }
 
-        MeshDescription meshDesc;
-        meshDesc.Positions.reserve(5000);
-        meshDesc.UVs.reserve(5000);
-        meshDesc.Normals.reserve(5000);
-        meshDesc.Tangents.reserve(5000);
-        meshDesc.Bitangents.reserve(5000);
-        meshDesc.Indices.reserve(10000);
-        meshDesc.Submeshes.reserve(scene->mNumMeshes);
+        MeshDescription& meshDesc = importData.Geometry;
         meshDesc.MaterialTable = CreateRef<MaterialTable>();
 
-        // Parse all submeshes
-        HashMap<String, std::pair<u32, glm::mat4>> bonesByName;
-
-        for (u32 submeshIdx = 0; submeshIdx < scene->mNumMeshes; submeshIdx++)
+        if (importSettings.ImportAnimations)
         {
-            aiMesh* submesh = scene->mMeshes[submeshIdx];
-
-            u32 startVertex = meshDesc.Positions.size();
-            u32 startIndex = meshDesc.Indices.size();
-
-            // Construct all vertices
-            u32 vertexCount = 0;
-            for (u32 vertexIdx = 0; vertexIdx < submesh->mNumVertices; vertexIdx++)
-            {
-                const aiVector3D& position = submesh->mVertices[vertexIdx];
-                const aiVector3D& texCoord = submesh->mTextureCoords[0][vertexIdx];
-                const aiVector3D& normal = submesh->mNormals[vertexIdx];
-                const aiVector3D& tangent = submesh->mTangents[vertexIdx];
-                const aiVector3D& bitangent = submesh->mBitangents[vertexIdx];
-
-                meshDesc.Positions.emplace_back(position.x, position.y, position.z);
-                meshDesc.UVs.emplace_back(texCoord.x, texCoord.y);
-                meshDesc.Normals.emplace_back(normal.x, normal.y, normal.z);
-                meshDesc.Tangents.emplace_back(tangent.x, tangent.y, tangent.z);
-                meshDesc.Bitangents.emplace_back(bitangent.x, bitangent.y, bitangent.z);
-                vertexCount++;
-            }
+            // Create skeleton
+            String skeletonName = sourcePath.stem().string() + "_Skeleton" + Asset::AssetFileExtensions[(u32)AssetType::Skeleton];
+            Vector<u32> boneIDRemap;
+            ContentTools::CreateSkeletonAsset(importData.Bones, std::filesystem::path("Skeletons") / skeletonName, &boneIDRemap);
 
-            // Construct all indices
-            u32 indexCount = 0;
-            for (u32 faceIdx = 0; faceIdx < submesh->mNumFaces; faceIdx++)
+            // The skeleton reorders its bones so the bone weights and the animation tracks have to refer to the new IDs
+            for (auto& boneWeight : meshDesc.BoneWeights)
             {
-                const aiFace& face = submesh->mFaces[faceIdx];
-                for (u32 i = 0; i < face.mNumIndices; i++)
-                {
-                    meshDesc.Indices.push_back(face.mIndices[i]);
-                    indexCount++;
-                }
+                for (auto& [boneID, weight] : boneWeight.Weights)
+                    boneID = boneIDRemap[boneID];
             }
 
-            // Parse bone data
-            meshDesc.BoneWeights.resize(startVertex + vertexCount);
-            Vector<u32> boneWeightsPerVertex(vertexCount);
-
-            for (u32 boneIdx = 0; boneIdx < submesh->mNumBones; boneIdx++)
+            // Create all animations
+            for (auto& animation : importData.Animations)
             {
-                aiBone* bone = submesh->mBones[boneIdx];
-                String boneName = bone->mName.C_Str();
+                for (auto& track : animation.Tracks)
+                    track.BoneID = boneIDRemap[track.BoneID];
 
-                if (bonesByName.find(boneName) == bonesByName.end())
-                    bonesByName[boneName] = { bonesByName.size(), Utils::AssimpMat4ToGLM(bone->mOffsetMatrix) };
-
-                for (u32 weightIdx = 0; weightIdx < bone->mNumWeights; weightIdx++)
-                {
-                    const aiVertexWeight& vertexWeight = bone->mWeights[weightIdx];
-                    u32 currentWeightIdx = boneWeightsPerVertex[vertexWeight.mVertexId]++;
-                    ATOM_ENGINE_ASSERT(currentWeightIdx < Skeleton::Bone::MAX_BONE_WEIGHTS);
-                    meshDesc.BoneWeights[startVertex + vertexWeight.mVertexId].Weights[currentWeightIdx] = { bonesByName.at(boneName).first, vertexWeight.mWeight };
-                }
+                String animationName = fmt::format("{}_{}{}", sourcePath.stem().string(), animation.Name, Asset::AssetFileExtensions[(u32)AssetType::Animation]);
+                ContentTools::CreateAnimationAsset(animation.Duration, animation.TicksPerSecond, animation.Tracks, std::filesystem::path("Animations") / animationName, importSettings.CompressAnimations);
             }
-
-            // Create submesh
-            Submesh& sm = meshDesc.Submeshes.emplace_back();
-            sm.StartVertex = startVertex;
-            sm.VertexCount = vertexCount;
-            sm.StartIndex = startIndex;
-            sm.IndexCount = indexCount;
-            sm.MaterialIndex = submesh->mMaterialIndex;
         }
 
-        if (importSettings.ImportAnimations)
+        // Create all materials
+        for (u32 materialIdx = 0; materialIdx < importData.Materials.size(); materialIdx++)
         {
-            // Create skeleton
-            Vector<Skeleton::Bone> skeletonBones;
-            skeletonBones.resize(bonesByName.size());
-
-            Queue<aiNode*> nodeQueue;
-            nodeQueue.push(scene->mRootNode);
-
-            while (!nodeQueue.empty())
-            {
-                aiNode* currentNode = nodeQueue.front();
-                String nodeName = currentNode->mName.C_Str();
-
-                if (bonesByName.find(nodeName) != bonesByName.end())
-                {
-                    // Process the node if it is a bone
-                    auto& [id, inverseBindTransform] = bonesByName[nodeName];
+            const Utils::ImportedMaterial& material = importData.Materials[materialIdx];
 
-                    Skeleton::Bone& bone = skeletonBones[id];
-                    bone.ID = id;
-                    bone.InverseBindTransform = inverseBindTransform;
+            Ref<Material> materialAsset = CreateRef<Material>(ShaderLibrary::Get().Get<GraphicsShader>(importData.MaterialShaderName), MaterialFlags::DepthTested);
 
-                    // Find the bone parent
-                    aiNode* currentParent = currentNode->mParent;
-                    while (currentParent)
-                    {
-                        if (bonesByName.find(currentParent->mName.C_Str()) != bonesByName.end())
-                            break;
+            if ((material.Flags & MaterialFlags::Transparent) != MaterialFlags::None)
+                materialAsset->SetFlag(MaterialFlags::Transparent, true);
 
-                        currentParent = currentParent->mParent;
-                    }
+            if ((material.Flags & MaterialFlags::TwoSided) != MaterialFlags::None)
+                materialAsset->SetFlag(MaterialFlags::TwoSided, true);
 
-                    if (!currentParent)
-                    {
-                        // We found a root node
-                        bone.ParentID = UINT32_MAX;
-                    }
-                    else
-                    {
-                        u32 parentID = bonesByName.at(currentParent->mName.C_Str()).first;
-                        bone.ParentID = parentID;
-                        skeletonBones[parentID].ChildrenIDs.push_back(id);
-                    }
-                }
+            if ((material.Flags & MaterialFlags::Wireframe) != MaterialFlags::None)
+                materialAsset->SetFlag(MaterialFlags::Wireframe, true);
 
-                for (u32 childIdx = 0; childIdx < currentNode->mNumChildren; childIdx++)
-                    nodeQueue.push(currentNode->mChildren[childIdx]);
+            if (material.HasAlbedoColor)
+                materialAsset->SetUniform("AlbedoColor", material.AlbedoColor);
 
-                nodeQueue.pop();
-            }
+            if (material.HasRoughness)
+                materialAsset->SetUniform("Roughness", material.Roughness);
 
-            String skeletonName = sourcePath.stem().string() + "_Skeleton" + Asset::AssetFileExtensions[(u32)AssetType::Skeleton];
-            ContentTools::CreateSkeletonAsset(skeletonBones, std::filesystem::path("Skeletons") / skeletonName);
+            if (material.HasMetalness)
+                materialAsset->SetUniform("Metalness", material.Metalness);
 
-            // Parse all animations
-            for (u32 animationIdx = 0; animationIdx < scene->mNumAnimations; animationIdx++)
+            // Set textures
+            for (auto& texture : material.Textures)
             {
-                aiAnimation* animation = scene->mAnimations[animationIdx];
-                HashMap<f32, HashMap<u32, Animation::BoneTransform>> boneTransformsPerKeyFrame;
+                TextureImportSettings textureImportSettings;
+                textureImportSettings.Format = texture.Format;
 
-                for (u32 nodeIdx = 0; nodeIdx < animation->mNumChannels; nodeIdx++)
+                UUID textureUUID = 0;
+                if (!texture.EmbeddedData.empty())
                 {
-                    aiNodeAnim* node = animation->mChannels[nodeIdx];
-                    String boneName = node->mNodeName.C_Str();
-
-                    if (bonesByName.find(boneName) != bonesByName.end())
-                    {
-                        u32 boneID = bonesByName.at(boneName).first;
-                    
-                        for (u32 keyIdx = 0; keyIdx < node->mNumPositionKeys; keyIdx++)
-                        {
-                            const aiVectorKey& posKey = node->mPositionKeys[keyIdx];
-                            f32 timeStamp = posKey.mTime;
-                            boneTransformsPerKeyFrame[timeStamp][boneID].Position = glm::vec3(posKey.mValue.x, posKey.mValue.y, posKey.mValue.z);
-                        }
-                    
-                        for (u32 keyIdx = 0; keyIdx < node->mNumRotationKeys; keyIdx++)
-                        {
-                            const aiQuatKey& rotKey = node->mRotationKeys[keyIdx];
-                            f32 timeStamp = rotKey.mTime;
-                            boneTransformsPerKeyFrame[timeStamp][boneID].Rotation = glm::quat(rotKey.mValue.w, rotKey.mValue.x, rotKey.mValue.y, rotKey.mValue.z);
-                        }
-                    
-                        for (u32 keyIdx = 0; keyIdx < node->mNumScalingKeys; keyIdx++)
-                        {
-                            const aiVectorKey& scaleKey = node->mScalingKeys[keyIdx];
-                            f32 timeStamp = scaleKey.mTime;
-                            boneTransformsPerKeyFrame[timeStamp][boneID].Scale = glm::vec3(scaleKey.mValue.x, scaleKey.mValue.y, scaleKey.mValue.z);
-                        }
-                    }
+                    // Texture is embedded. Decode the data buffer.
+                    textureUUID = ContentTools::ImportTextureAsset(texture.EmbeddedData.data(), texture.EmbeddedData.size(), texture.EmbeddedName, "Textures", textureImportSettings);
                 }
-
-                // Construct key frames
-                Set<Animation::KeyFrame> keyFrames;
-                for (auto& [timeStamp, boneTransforms] : boneTransformsPerKeyFrame)
-                    keyFrames.insert({ timeStamp, boneTransforms });
-
-                String animationName = animation->mName.C_Str();
-                animationName = animationName.substr(animationName.find_last_of('|') + 1);
-                animationName = fmt::format("{}_{}{}", sourcePath.stem().string(), animationName, Asset::AssetFileExtensions[(u32)AssetType::Animation]);
-
-                ContentTools::CreateAnimationAsset(animation->mDuration, animation->mTicksPerSecond, keyFrames, std::filesystem::path("Animations") / animationName);
-            }
-        }
-
-        // Parse all materials
-        for (u32 materialIdx = 0; materialIdx < scene->mNumMaterials; materialIdx++)
-        {
-            const aiMaterial* assimpMat = scene->mMaterials[materialIdx];
-
-            // Set the name
-            aiString materialName;
-            assimpMat->Get(AI_MATKEY_NAME, materialName);
-            materialName.Append(Asset::AssetFileExtensions[(u32)AssetType::Material]);
-
-            String shaderName = importSettings.ImportAnimations && scene->mNumAnimations > 0 ? "MeshPBRAnimatedShader" : "MeshPBRShader";
-            UUID materialUUID = ContentTools::CreateMaterialAsset(shaderName, std::filesystem::path("Materials") / materialName.C_Str());
-            Ref<Material> materialAsset = AssetManager::GetAsset<Material>(materialUUID, true);
-
-            // Set albedo color
-            aiColor4D albedo;
-            if (assimpMat->Get(AI_MATKEY_COLOR_DIFFUSE, albedo) == AI_SUCCESS)
-            {
-                // Set transparency flag
-                f32 opacity;
-                if (assimpMat->Get(AI_MATKEY_OPACITY, opacity) == AI_SUCCESS && opacity < 1.0f)
+                else
                 {
-                    materialAsset->SetFlag(MaterialFlags::Transparent, true);
-                    albedo.a = opacity;
+                    // Load the texture from filepath
+                    textureUUID = ContentTools::ImportTextureAsset(sourcePath.parent_path() / texture.Filepath, "Textures", textureImportSettings);
                 }
 
-                materialAsset->SetUniform("AlbedoColor", glm::vec4(albedo.r, albedo.g, albedo.b, albedo.a));
-            }
-
-            // Set roughness
-            f32 roughness;
-            if (assimpMat->Get(AI_MATKEY_ROUGHNESS_FACTOR, roughness) == AI_SUCCESS)
-            {
-                materialAsset->SetUniform("Roughness", roughness);
-            }
-
-            // Set metalness
-            f32 metalness;
-            if (assimpMat->Get(AI_MATKEY_REFLECTIVITY, metalness) == AI_SUCCESS)
-            {
-                materialAsset->SetUniform("Metalness", metalness);
-            }
-
-            // Set two sided flag
-            bool twoSided;
-            if (assimpMat->Get(AI_MATKEY_TWOSIDED, twoSided) == AI_SUCCESS && twoSided)
-            {
-                materialAsset->SetFlag(MaterialFlags::TwoSided, true);
+                materialAsset->SetTexture(texture.UniformName.c_str(), AssetManager::GetAsset<Texture2D>(textureUUID, true));
+                materialAsset->SetUniform(fmt::format("Use{}", texture.UniformName).c_str(), 1);
             }
 
-            // Set wireframe flag
-            bool wireframe;
-            if (assimpMat->Get(AI_MATKEY_ENABLE_WIREFRAME, wireframe) == AI_SUCCESS && wireframe)
+            // Meshes sharing a material parameter set reference the same material asset. Textures are deduplicated first, so materials
+            // using the same images compare equal.
+            UUID existingUUID = AssetManager::FindAssetByContentHash(AssetType::Material, materialAsset->ComputeContentHash());
+            if (existingUUID != 0)
             {
-                materialAsset->SetFlag(MaterialFlags::Wireframe, true);
+                meshDesc.MaterialTable->SetMaterial(materialIdx, AssetManager::GetAsset<Material>(existingUUID, true));
+                continue;
             }
 
-            // Set textures
-            auto SetMaterialTexture = [&](aiTextureType type, const char* uniformName)
-            {
-                aiString aiPath;
-                if (assimpMat->GetTexture(type, 0, &aiPath) == AI_SUCCESS)
-                {
-                    TextureImportSettings importSettings;
-                    importSettings.Format = type == aiTextureType_METALNESS || type == aiTextureType_SHININESS ? TextureFormat::R8 : TextureFormat::RGBA8;
-
-                    UUID textureUUID = 0;
-                    if (const aiTexture* aiTexture = scene->GetEmbeddedTexture(aiPath.C_Str()))
-                    {
-                        // Texture is embedded. Decode the data buffer.
-                        std::filesystem::path textureName = std::filesystem::path(aiTexture->mFilename.C_Str()).stem();
-                        textureUUID = ContentTools::ImportTextureAsset((byte*)aiTexture->pcData, aiTexture->mWidth, textureName.string(), "Textures", importSettings);
-                    }
-                    else
-                    {
-                        // Load the texture from filepath
-                        textureUUID = ContentTools::ImportTextureAsset(sourcePath.parent_path() / aiPath.C_Str(), "Textures", importSettings);
-                    }
-
-                    materialAsset->SetTexture(uniformName, AssetManager::GetAsset<Texture2D>(textureUUID, true));
-                    materialAsset->SetUniform(fmt::format("Use{}", uniformName).c_str(), 1);
-                }
-            };
+            // Save the material
+            String materialName = material.Name + Asset::AssetFileExtensions[(u32)AssetType::Material];
+            std::filesystem::path materialPath = Utils::GetUniqueAssetPath(AssetManager::GetAssetFullPath(std::filesystem::path("Materials") / materialName));
 
-            SetMaterialTexture(aiTextureType_DIFFUSE, "AlbedoMap");
-            SetMaterialTexture(aiTextureType_NORMALS, "NormalMap");
-            SetMaterialTexture(aiTextureType_METALNESS, "MetalnessMap");
-            SetMaterialTexture(aiTextureType_SHININESS, "RoughnessMap");
+            if (!std::filesystem::exists(materialPath.parent_path()))
+                std::filesystem::create_directories(materialPath.parent_path());
 
-            // Save the material
-            if (!AssetSerializer::Serialize(materialAsset->GetAssetFilepath(), materialAsset))
+            if (!AssetSerializer::Serialize(materialPath, materialAsset))
             {
-                ATOM_ERROR("Failed serializing material {}", materialAsset->GetAssetFilepath().string());
+                ATOM_ERROR("Failed serializing material {}", materialPath.string());
                 continue;
             }
 
+            AssetManager::RegisterAsset(materialAsset->m_MetaData);
             meshDesc.MaterialTable->SetMaterial(materialIdx, materialAsset);
         }
 
@@ -615,7 +1009,6 @@ namespace Atom
 
         AssetManager::RegisterAsset(asset->m_MetaData);
         return asset->m_MetaData.UUID;
-      
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
@@ -628,21 +1021,7 @@ namespace Atom
         if (!DecodeImage(sourcePath, format, width, height, decodedData))
             return nullptr;
 
-        TextureDescription textureDesc;
-        textureDesc.Format = format;
-        textureDesc.Width = width;
-        textureDesc.Height = height;
-        textureDesc.MipLevels = Texture::CalculateMaxMipCount(width, height);
-        textureDesc.Flags = TextureFlags::UnorderedAccess | TextureFlags::ShaderResource;
-
-        Ref<Texture> texture = CreateRef<Texture>(textureDesc, sourcePath.stem().string().c_str());
-        Renderer::UploadTextureData(texture, decodedData.data());
-        Renderer::GenerateMips(texture);
-
-        if (!importSettings.IsCubeMap)
-            return texture;
-
-        return Renderer::CreateEnvironmentMap(texture, importSettings.CubemapSize, sourcePath.stem().string().c_str());
+        return CreateTexture(decodedData, format, width, height, sourcePath.stem().string(), importSettings);
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
@@ -655,25 +1034,11 @@ namespace Atom
         if (!DecodeImage(compressedData, dataSize, format, width, height, decodedData))
             return nullptr;
 
-        TextureDescription textureDesc;
-        textureDesc.Format = format;
-        textureDesc.Width = width;
-        textureDesc.Height = height;
-        textureDesc.MipLevels = Texture::CalculateMaxMipCount(width, height);
-        textureDesc.Flags = TextureFlags::UnorderedAccess | TextureFlags::ShaderResource;
-
-        Ref<Texture> texture = CreateRef<Texture>(textureDesc, name.c_str());
-        Renderer::UploadTextureData(texture, decodedData.data());
-        Renderer::GenerateMips(texture);
-
-        if (!importSettings.IsCubeMap)
-            return texture;
-
-        return Renderer::CreateEnvironmentMap(texture, importSettings.CubemapSize, name.c_str());
+        return CreateTexture(decodedData, format, width, height, name, importSettings);
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    UUID ContentTools::CreateAnimationAsset(f32 duration, f32 ticksPerSecond, const Set<Animation::KeyFrame>& keyFrames, const std::filesystem::path& filepath)
+    UUID ContentTools::CreateAnimationAsset(f32 duration, f32 ticksPerSecond, const Vector<Animation::BoneTrack>& tracks, const std::filesystem::path& filepath, bool quantize)
     {
         std::filesystem::path assetFullPath = AssetManager::GetAssetFullPath(filepath);
 
@@ -686,7 +1051,7 @@ namespace Atom
         if (!std::filesystem::exists(assetFullPath.parent_path()))
             std::filesystem::create_directories(assetFullPath.parent_path());
 
-        Ref<Animation> asset = CreateRef<Animation>(duration, ticksPerSecond, keyFrames);
+        Ref<Animation> asset = CreateRef<Animation>(duration, ticksPerSecond, tracks, quantize);
 
         if (!AssetSerializer::Serialize(assetFullPath, asset))
         {
@@ -699,8 +1064,13 @@ namespace Atom
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    UUID ContentTools::CreateSkeletonAsset(const Vector<Skeleton::Bone>& bones, const std::filesystem::path& filepath)
+    UUID ContentTools::CreateSkeletonAsset(const Vector<Skeleton::Bone>& bones, const std::filesystem::path& filepath, Vector<u32>* boneIDRemap)
     {
+        // Sort before checking for an existing asset so that the caller always gets the remapping the stored skeleton was created with
+        Vector<Skeleton::Bone> sortedBones;
+        Vector<u32> localBoneIDRemap;
+        Utils::SortBonesTopologically(bones, sortedBones, boneIDRemap ? *boneIDRemap : localBoneIDRemap);
+
         std::filesystem::path assetFullPath = AssetManager::GetAssetFullPath(filepath);
 
         if (std::filesystem::exists(assetFullPath))
@@ -712,7 +1082,7 @@ namespace Atom
         if (!std::filesystem::exists(assetFullPath.parent_path()))
             std::filesystem::create_directories(assetFullPath.parent_path());
 
-        Ref<Skeleton> asset = CreateRef<Skeleton>(bones);
+        Ref<Skeleton> asset = CreateRef<Skeleton>(sortedBones);
 
         if (!AssetSerializer::Serialize(assetFullPath, asset))
         {
@@ -725,7 +1095,7 @@ namespace Atom
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
-    UUID ContentTools::CreateAnimationControllerAsset(const Vector<Ref<Animation>>& animationStates, u16 initialStateIdx, const std::filesystem::path& filepath)
+    UUID ContentTools::CreateAnimationControllerAsset(const Vector<AnimationState>& animationStates, u16 initialStateIdx, const std::filesystem::path& filepath, const BakedPaletteSettings& bakedPaletteSettings)
     {
         std::filesystem::path assetFullPath = AssetManager::GetAssetFullPath(filepath);
 
@@ -739,6 +1109,7 @@ namespace Atom
             std::filesystem::create_directories(assetFullPath.parent_path());
 
         Ref<AnimationController> asset = CreateRef<AnimationController>(animationStates, initialStateIdx);
+        asset->SetBakedPaletteSettings(bakedPaletteSettings);
 
         if (!AssetSerializer::Serialize(assetFullPath, asset))
         {
@@ -816,6 +1187,200 @@ namespace Atom
         return asset->m_MetaData.UUID;
     }
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool ContentTools::BuildAssetPack(const std::filesystem::path& packFilepath)
+    {
+        AssetPackBuilder builder;
+
+        for (auto& [uuid, metaData] : AssetManager::GetRegistry())
+        {
+            if ((metaData.Flags & AssetFlags::Serialized) == AssetFlags::None)
+                continue;
+
+            std::filesystem::path assetPath = metaData.AssetFilepath.lexically_relative(AssetManager::GetAssetsFolder());
+
+            if (!builder.AddAsset(metaData.AssetFilepath, assetPath))
+                return false;
+        }
+
+        return builder.Build(packFilepath);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    UUID ContentTools::CreateTextureAsset(const String& name, const std::filesystem::path& sourcePath, std::filesystem::path assetFullPath, const DerivedDataKey& cacheKey, const TextureImportSettings& importSettings, const DecodeImageFn& decodeImage)
+    {
+        AssetType assetType = importSettings.IsCubeMap ? AssetType::TextureCube : AssetType::Texture2D;
+
+        // Assets imported before content hashes were added can't be compared, so they are still matched by name
+        if (std::filesystem::exists(assetFullPath))
+        {
+            std::optional<AssetMetaData> existingMetaData = AssetManager::GetAssetMetaData(AssetManager::GetUUIDForAssetPath(assetFullPath));
+
+            if (existingMetaData && existingMetaData->ContentHash == 0)
+            {
+                ATOM_WARNING("Texture {} already exists", assetFullPath.string());
+                return existingMetaData->UUID;
+            }
+        }
+
+        s32 width = 0, height = 0;
+        Vector<byte> pixels;
+        TextureFormat format = importSettings.Format;
+
+        auto DecodeSource = [&]()
+        {
+            if (decodeImage(format, width, height, pixels))
+                return true;
+
+            ATOM_ERROR("Failed creating texture asset {}", assetFullPath);
+            return false;
+        };
+
+        // Decoding, mip generation and the environment map convolution are skipped if the same data was imported with the same settings before.
+        // The cached asset carries the content hash, so the pixels don't have to be decoded to find duplicates.
+        AssetMetaData cachedMetaData;
+        Scope<AssetFileReader> cachedAsset = DerivedDataCache::FindAsset(cacheKey, cachedMetaData);
+        u64 contentHash = 0;
+
+        if (cachedAsset)
+        {
+            contentHash = cachedMetaData.ContentHash;
+        }
+        else
+        {
+            if (!DecodeSource())
+                return 0;
+
+            contentHash = Utils::ComputeTextureContentHash(pixels, format, width, height, importSettings);
+        }
+
+        // Textures shared by several source files are only imported once
+        UUID existingUUID = AssetManager::FindAssetByContentHash(assetType, contentHash);
+        if (existingUUID != 0)
+        {
+            ATOM_INFO("Texture {} has the same content as {}, reusing it", name, AssetManager::GetAssetMetaData(existingUUID)->AssetFilepath);
+            return existingUUID;
+        }
+
+        // A different texture with the same name must not be overwritten
+        assetFullPath = Utils::GetUniqueAssetPath(assetFullPath);
+
+        if (!std::filesystem::exists(assetFullPath.parent_path()))
+            std::filesystem::create_directories(assetFullPath.parent_path());
+
+        if (cachedAsset)
+        {
+            AssetMetaData metaData;
+            metaData.UUID = UUID();
+            metaData.Type = assetType;
+            metaData.Flags = AssetFlags::Serialized;
+            metaData.SourceFilepath = sourcePath;
+            metaData.ContentHash = contentHash;
+
+            if (DerivedDataCache::CreateAsset(*cachedAsset, assetFullPath, metaData))
+            {
+                metaData.AssetFilepath = std::filesystem::canonical(assetFullPath);
+                AssetManager::RegisterAsset(metaData);
+                return metaData.UUID;
+            }
+
+            // The entry is replaced below
+            if (!DecodeSource())
+                return 0;
+        }
+
+        Ref<Texture> texture = CreateTexture(pixels, format, width, height, name, importSettings);
+
+        Ref<Asset> asset = nullptr;
+        if (importSettings.IsCubeMap)
+            asset = CreateRef<TextureCube>(texture, importSettings.IsReadable);
+        else
+            asset = CreateRef<Texture2D>(texture, importSettings.IsReadable);
+
+        asset->m_MetaData.SourceFilepath = sourcePath;
+        asset->m_MetaData.ContentHash = contentHash;
+
+        if (importSettings.IsReadable)
+        {
+            if (importSettings.IsCubeMap)
+            {
+                Ref<TextureCube> textureCube = std::static_pointer_cast<TextureCube>(asset);
+                textureCube->SetFilter(importSettings.Filter);
+                textureCube->SetWrap(importSettings.Wrap);
+
+                for (u32 face = 0; face < 6; face++)
+                {
+                    for (u32 mip = 0; mip < textureCube->GetMipLevels(); mip++)
+                    {
+                        Ref<ReadbackBuffer> buffer = Renderer::ReadbackTextureData(textureCube->GetResource(), mip, face);
+
+                        Vector<byte> pixelData(buffer->GetSize(), 0);
+                        void* mappedData = buffer->Map(0, 0);
+                        memcpy(pixelData.data(), mappedData, pixelData.size());
+                        buffer->Unmap();
+
+                        textureCube->SetPixels(pixelData, face, mip);
+                    }
+                }
+            }
+            else
+            {
+                Ref<Texture2D> texture2D = std::static_pointer_cast<Texture2D>(asset);
+                texture2D->SetFilter(importSettings.Filter);
+                texture2D->SetWrap(importSettings.Wrap);
+
+                for (u32 mip = 0; mip < texture2D->GetMipLevels(); mip++)
+                {
+                    Ref<ReadbackBuffer> buffer = Renderer::ReadbackTextureData(texture2D->GetResource(), mip);
+
+                    Vector<byte> pixelData(buffer->GetSize(), 0);
+                    void* mappedData = buffer->Map(0, 0);
+                    memcpy(pixelData.data(), mappedData, pixelData.size());
+                    buffer->Unmap();
+
+                    texture2D->SetPixels(pixelData, mip);
+                }
+            }
+        }
+
+        bool result = false;
+        if (importSettings.IsCubeMap)
+            result = AssetSerializer::Serialize(assetFullPath, std::static_pointer_cast<TextureCube>(asset));
+        else
+            result = AssetSerializer::Serialize(assetFullPath, std::static_pointer_cast<Texture2D>(asset));
+
+        if (!result)
+        {
+            ATOM_ERROR("Failed serializing texture asset {}", assetFullPath);
+            return 0;
+        }
+
+        DerivedDataCache::StoreAsset(cacheKey, assetFullPath);
+
+        AssetManager::RegisterAsset(asset->m_MetaData);
+        return asset->m_MetaData.UUID;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    Ref<Texture> ContentTools::CreateTexture(const Vector<byte>& pixels, TextureFormat format, s32 width, s32 height, const String& name, const TextureImportSettings& importSettings)
+    {
+        TextureDescription textureDesc;
+        textureDesc.Format = format;
+        textureDesc.Width = width;
+        textureDesc.Height = height;
+        textureDesc.MipLevels = Texture::CalculateMaxMipCount(width, height);
+        textureDesc.Flags = TextureFlags::UnorderedAccess | TextureFlags::ShaderResource;
+
+        Ref<Texture> texture = CreateRef<Texture>(textureDesc, name.c_str());
+        Renderer::UploadTextureData(texture, pixels.data());
+        Renderer::GenerateMips(texture);
+
+        if (!importSettings.IsCubeMap)
+            return texture;
+
+        return Renderer::CreateEnvironmentMap(texture, importSettings.CubemapSize, name.c_str());
+    }
+
     // -----------------------------------------------------------------------------------------------------------------------------
     bool ContentTools::DecodeImage(const std::filesystem::path& sourcePath, TextureFormat& format, s32& width, s32& height, Vector<byte>& pixels)
     {
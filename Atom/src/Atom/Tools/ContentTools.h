@@ -3,6 +3,7 @@
 #include "Atom/Core/Core.h"
 #include "Atom/Asset/TextureAsset.h"
 #include "Atom/Asset/AnimationAsset.h"
+#include "Atom/Asset/AnimationControllerAsset.h"
 #include "Atom/Asset/SkeletonAsset.h"
 
 struct aiAnimation;
@@ -10,6 +11,8 @@ struct aiNode;
 
 namespace Atom
 {
+    class DerivedDataKey;
+
     struct TextureImportSettings
     {
         bool          IsCubeMap = false;
@@ -25,22 +28,36 @@ namespace Atom
         bool IsReadable = false;
         bool SmoothNormals = true;
         bool ImportAnimations = true;
+        bool CompressAnimations = true;
+        f32  PositionTolerance = 0.001f; // Max distance in model units between the compressed and the source positions
+        f32  RotationTolerance = 0.05f;  // Max angle in degrees between the compressed and the source rotations
+        f32  ScaleTolerance = 0.001f;
     };
 
     class ContentTools
     {
     public:
+        // Bump whenever an importer changes its output, so stale entries of the derived data cache are no longer used
+        static constexpr u32 TextureImporterVersion = 2;
+        static constexpr u32 MeshImporterVersion = 1;
+
         static UUID ImportTextureAsset(const std::filesystem::path& sourcePath, const std::filesystem::path& destinationFolder, const TextureImportSettings& importSettings);
         static UUID ImportTextureAsset(const byte* compressedData, u32 dataSize, const String& assetName, const std::filesystem::path& destinationFolder, const TextureImportSettings& importSettings);
         static UUID ImportMeshAsset(const std::filesystem::path& sourcePath, const std::filesystem::path& destinationFolder, const MeshImportSettings& importSettings);
         static Ref<Texture> ImportTexture(const std::filesystem::path& sourcePath, const TextureImportSettings& importSettings);
         static Ref<Texture> ImportTexture(const byte* compressedData, u32 dataSize, const String& name, const TextureImportSettings& importSettings);
-        static UUID CreateAnimationAsset(f32 duration, f32 ticksPerSecond, const Set<Animation::KeyFrame>& keyFrames, const std::filesystem::path& filepath);
-        static UUID CreateSkeletonAsset(const Vector<Skeleton::Bone>& bones, const std::filesystem::path& filepath);
-        static UUID CreateAnimationControllerAsset(const Vector<Ref<Animation>>& animationStates, u16 initialStateIdx, const std::filesystem::path& filepath);
+        static UUID CreateAnimationAsset(f32 duration, f32 ticksPerSecond, const Vector<Animation::BoneTrack>& tracks, const std::filesystem::path& filepath, bool quantize = true);
+        static UUID CreateSkeletonAsset(const Vector<Skeleton::Bone>& bones, const std::filesystem::path& filepath, Vector<u32>* boneIDRemap = nullptr);
+        static UUID CreateAnimationControllerAsset(const Vector<AnimationState>& animationStates, u16 initialStateIdx, const std::filesystem::path& filepath, const BakedPaletteSettings& bakedPaletteSettings = {});
         static UUID CreateMaterialAsset(const String& shaderName, const std::filesystem::path& filepath = "");
         static UUID CreateSceneAsset(const String& sceneName = "Unnamed Scene", const std::filesystem::path& filepath = "");
+        static bool BuildAssetPack(const std::filesystem::path& packFilepath); // Packs all serialized assets in the registry of the asset manager
     private:
+        using DecodeImageFn = std::function<bool(TextureFormat& format, s32& width, s32& height, Vector<byte>& pixels)>;
+
+        // Reuses a registered texture with the same content and import settings instead of creating a duplicate
+        static UUID CreateTextureAsset(const String& name, const std::filesystem::path& sourcePath, std::filesystem::path assetFullPath, const DerivedDataKey& cacheKey, const TextureImportSettings& importSettings, const DecodeImageFn& decodeImage);
+        static Ref<Texture> CreateTexture(const Vector<byte>& pixels, TextureFormat format, s32 width, s32 height, const String& name, const TextureImportSettings& importSettings);
         static bool DecodeImage(const std::filesystem::path& sourcePath, TextureFormat& format, s32& width, s32& height, Vector<byte>& pixels);
         static bool DecodeImage(const byte* compressedData, u32 dataSize, TextureFormat& format, s32& width, s32& height, Vector<byte>& pixels);
     };
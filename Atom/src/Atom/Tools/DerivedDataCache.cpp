@@ -0,0 +1,254 @@
+#include "atompch.h"
+#include "DerivedDataCache.h"
+
+#include "Atom/Asset/AssetSerializer.h"
+#include "Atom/Core/MappedFile.h"
+
+namespace Atom
+{
+    // -----------------------------------------------------------------------------------------------------------------------------
+    DerivedDataKey::DerivedDataKey(const String& importerName, u32 importerVersion)
+    {
+        // Cached asset files are copied chunk by chunk, so they are only valid for the container version they were written with
+        Append(importerName);
+        Append(importerVersion);
+        Append(AssetFile::Version);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void DerivedDataKey::Append(const void* data, u64 size)
+    {
+        if (size)
+            m_Data.insert(m_Data.end(), (const byte*)data, (const byte*)data + size);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void DerivedDataKey::Append(const String& value)
+    {
+        u32 size = value.size();
+        Append(size);
+        Append(value.data(), size);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool DerivedDataKey::AppendFile(const std::filesystem::path& filepath)
+    {
+        MappedFile file(filepath);
+
+        if (!file.IsValid())
+            return false;
+
+        u64 size = file.GetSize();
+        Append(size);
+        Append(AssetFile::ComputeHash(file.GetData(), size));
+        return true;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void DerivedDataCache::SetDirectory(const std::filesystem::path& directory)
+    {
+        std::lock_guard<std::mutex> lock(ms_Mutex);
+        ms_Directory = directory;
+
+        if (!ms_Directory.empty())
+            ATOM_INFO("Using derived data cache {}", ms_Directory);
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    const std::filesystem::path& DerivedDataCache::GetDirectory()
+    {
+        return ms_Directory;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool DerivedDataCache::IsEnabled()
+    {
+        std::lock_guard<std::mutex> lock(ms_Mutex);
+        return !ms_Directory.empty();
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    Scope<AssetFileReader> DerivedDataCache::Find(const DerivedDataKey& key)
+    {
+        if (!IsEnabled())
+            return nullptr;
+
+        std::filesystem::path entryPath = GetEntryPath(key);
+
+        std::error_code error;
+        if (!std::filesystem::exists(entryPath, error))
+        {
+            ms_Misses++;
+            return nullptr;
+        }
+
+        Scope<AssetFileReader> entry = CreateScope<AssetFileReader>(entryPath);
+        AssetChunkReader keyChunk = entry->IsValid() ? entry->GetChunk(AssetChunkType::CacheKey) : AssetChunkReader();
+
+        if (!keyChunk.IsValid())
+        {
+            ATOM_WARNING("Derived data cache entry {} is corrupted", entryPath);
+            ms_Misses++;
+            return nullptr;
+        }
+
+        // Different keys with the same hash
+        if (keyChunk.GetSize() != key.GetData().size() || memcmp(keyChunk.GetData(), key.GetData().data(), keyChunk.GetSize()) != 0)
+        {
+            ms_Misses++;
+            return nullptr;
+        }
+
+        ms_Hits++;
+        ms_BytesRead += std::filesystem::file_size(entryPath, error);
+        return entry;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool DerivedDataCache::Store(const DerivedDataKey& key, const std::function<void(AssetFileWriter& writer)>& writeData, AssetCompression compression)
+    {
+        if (!IsEnabled())
+            return false;
+
+        std::filesystem::path entryPath = GetEntryPath(key);
+        std::filesystem::path temporaryPath = entryPath;
+        temporaryPath += fmt::format(".{}.tmp", (u64)UUID());
+
+        std::error_code error;
+        std::filesystem::create_directories(entryPath.parent_path(), error);
+
+        bool result = false;
+
+        {
+            AssetFileWriter writer(temporaryPath, compression);
+            writer.WriteChunk(AssetChunkType::CacheKey, 0, key.GetData().data(), key.GetData().size());
+            writeData(writer);
+            result = writer.Finalize();
+        }
+
+        // Another editor might have stored the same entry in the meantime, either version is fine
+        if (result)
+            std::filesystem::rename(temporaryPath, entryPath, error);
+
+        if (!result || error)
+        {
+            ATOM_WARNING("Failed storing derived data cache entry {}", entryPath);
+            std::filesystem::remove(temporaryPath, error);
+            return false;
+        }
+
+        ms_BytesWritten += std::filesystem::file_size(entryPath, error);
+        return true;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool DerivedDataCache::StoreAsset(const DerivedDataKey& key, const std::filesystem::path& assetFilepath)
+    {
+        if (!IsEnabled())
+            return false;
+
+        AssetFileReader asset(assetFilepath);
+
+        if (!asset.IsValid())
+            return false;
+
+        bool isValid = true;
+
+        bool result = Store(key, [&](AssetFileWriter& writer)
+        {
+            for (const AssetChunkEntry& chunk : asset.GetChunks())
+            {
+                const byte* storedData = asset.GetStoredChunkData(chunk);
+
+                if (!storedData)
+                {
+                    isValid = false;
+                    return;
+                }
+
+                writer.WriteStoredChunk(chunk, storedData);
+            }
+        });
+
+        // A corrupted asset file must not end up in the cache
+        if (result && !isValid)
+        {
+            std::error_code error;
+            std::filesystem::remove(GetEntryPath(key), error);
+            return false;
+        }
+
+        return result;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    Scope<AssetFileReader> DerivedDataCache::FindAsset(const DerivedDataKey& key, AssetMetaData& cachedMetaData)
+    {
+        Scope<AssetFileReader> entry = Find(key);
+
+        if (!entry || !AssetSerializer::DeserializeMetaData(*entry, cachedMetaData))
+            return nullptr;
+
+        return entry;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    bool DerivedDataCache::CreateAsset(const AssetFileReader& entry, const std::filesystem::path& assetFilepath, const AssetMetaData& metaData)
+    {
+        bool result = true;
+
+        {
+            AssetFileWriter writer(assetFilepath);
+            AssetSerializer::SerializeMetaData(writer, metaData);
+
+            for (const AssetChunkEntry& chunk : entry.GetChunks())
+            {
+                if (chunk.Type == AssetChunkType::CacheKey || chunk.Type == AssetChunkType::MetaData)
+                    continue;
+
+                const byte* storedData = entry.GetStoredChunkData(chunk);
+
+                if (!storedData)
+                {
+                    result = false;
+                    break;
+                }
+
+                writer.WriteStoredChunk(chunk, storedData);
+            }
+
+            result = result && writer.Finalize();
+        }
+
+        if (!result)
+        {
+            ATOM_WARNING("Failed creating asset {} from the derived data cache", assetFilepath);
+
+            std::error_code error;
+            std::filesystem::remove(assetFilepath, error);
+        }
+
+        return result;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    DerivedDataCacheStats DerivedDataCache::GetStats()
+    {
+        DerivedDataCacheStats stats;
+        stats.Hits = ms_Hits;
+        stats.Misses = ms_Misses;
+        stats.BytesRead = ms_BytesRead;
+        stats.BytesWritten = ms_BytesWritten;
+        return stats;
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------
+    std::filesystem::path DerivedDataCache::GetEntryPath(const DerivedDataKey& key)
+    {
+        // Entries are spread over subdirectories so that none of them gets too large
+        String hash = fmt::format("{:016x}", key.GetHash());
+
+        std::lock_guard<std::mutex> lock(ms_Mutex);
+        return ms_Directory / hash.substr(0, 2) / (hash + FileExtension);
+    }
+}
\ No newline at end of file
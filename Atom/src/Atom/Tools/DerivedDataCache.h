@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Atom/Core/Core.h"
+#include "Atom/Asset/Asset.h"
+#include "Atom/Asset/AssetFile.h"
+
+namespace Atom
+{
+    // Identifies the output of an importer. Built from everything the output depends on: the importer and its version, the contents of
+    // the source data and the import settings. Settings have to be appended field by field, since padding bytes are undefined.
+    class DerivedDataKey
+    {
+    public:
+        DerivedDataKey(const String& importerName, u32 importerVersion);
+
+        void Append(const void* data, u64 size);
+        void Append(const String& value);
+        bool AppendFile(const std::filesystem::path& filepath); // Appends a hash of the contents of the file, fails if it can't be read
+
+        template<typename T>
+        void Append(const T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            Append(&value, sizeof(T));
+        }
+
+        inline const Vector<byte>& GetData() const { return m_Data; }
+        inline u64 GetHash() const { return AssetFile::ComputeHash(m_Data.data(), m_Data.size()); }
+    private:
+        Vector<byte> m_Data;
+    };
+
+    struct DerivedDataCacheStats
+    {
+        u64 Hits = 0;
+        u64 Misses = 0;
+        u64 BytesRead = 0;    // Size of the entries that were found
+        u64 BytesWritten = 0;
+    };
+
+    // Stores the outputs of the importers, so importing the same source with the same settings again only has to copy the output.
+    // Entries are asset container files named after the hash of their key. The full key is stored in each entry and compared on lookup,
+    // so hash collisions can't return the wrong data. Entries are written to a temporary file first and renamed once they are complete,
+    // so a cache directory can be shared by several projects and machines.
+    class DerivedDataCache
+    {
+    public:
+        static constexpr const char* FileExtension = ".atmddc";
+
+        static void SetDirectory(const std::filesystem::path& directory); // An empty path disables the cache
+        static const std::filesystem::path& GetDirectory();
+        static bool IsEnabled();
+
+        // Returns the entry for the key, or nullptr if there is none. The data of the entry is stored in chunks of any type but CacheKey.
+        static Scope<AssetFileReader> Find(const DerivedDataKey& key);
+        static bool Store(const DerivedDataKey& key, const std::function<void(AssetFileWriter& writer)>& writeData, AssetCompression compression = AssetCompression::None);
+
+        // Caches a whole asset file. New asset files are created from the entries with the given metadata, the metadata of the cached
+        // asset only tells what the asset contains.
+        static bool StoreAsset(const DerivedDataKey& key, const std::filesystem::path& assetFilepath);
+        static Scope<AssetFileReader> FindAsset(const DerivedDataKey& key, AssetMetaData& cachedMetaData);
+        static bool CreateAsset(const AssetFileReader& entry, const std::filesystem::path& assetFilepath, const AssetMetaData& metaData);
+
+        static DerivedDataCacheStats GetStats();
+    private:
+        static std::filesystem::path GetEntryPath(const DerivedDataKey& key);
+    private:
+        inline static std::mutex            ms_Mutex;
+        inline static std::filesystem::path ms_Directory;
+        inline static std::atomic<u64>      ms_Hits = 0;
+        inline static std::atomic<u64>      ms_Misses = 0;
+        inline static std::atomic<u64>      ms_BytesRead = 0;
+        inline static std::atomic<u64>      ms_BytesWritten = 0;
+    };
+}
\ No newline at end of file
@@ -208,6 +208,60 @@ namespace Atom
                 ImGui::PopItemWidth();
                 ImGui::Columns(1);
             }
+
+            if (m_ImportSettings.ImportAnimations)
+            {
+                // CompressAnimations 
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableSetColumnIndex(0);
+                    ImGui::Text("Compress animations");
+                    ImGui::TableSetColumnIndex(1);
+                    ImGui::PushItemWidth(-1);
+                    ImGui::Checkbox("##CompressAnimations", &m_ImportSettings.CompressAnimations);
+                    ImGui::PopItemWidth();
+                    ImGui::Columns(1);
+                }
+
+                if (m_ImportSettings.CompressAnimations)
+                {
+                    // PositionTolerance 
+                    {
+                        ImGui::TableNextRow();
+                        ImGui::TableSetColumnIndex(0);
+                        ImGui::Text("Position tolerance");
+                        ImGui::TableSetColumnIndex(1);
+                        ImGui::PushItemWidth(-1);
+                        ImGui::DragFloat("##PositionTolerance", &m_ImportSettings.PositionTolerance, 0.0001f, 0.0f, 1.0f, "%.4f");
+                        ImGui::PopItemWidth();
+                        ImGui::Columns(1);
+                    }
+
+                    // RotationTolerance 
+                    {
+                        ImGui::TableNextRow();
+                        ImGui::TableSetColumnIndex(0);
+                        ImGui::Text("Rotation tolerance (deg)");
+                        ImGui::TableSetColumnIndex(1);
+                        ImGui::PushItemWidth(-1);
+                        ImGui::DragFloat("##RotationTolerance", &m_ImportSettings.RotationTolerance, 0.01f, 0.0f, 10.0f, "%.2f");
+                        ImGui::PopItemWidth();
+                        ImGui::Columns(1);
+                    }
+
+                    // ScaleTolerance 
+                    {
+                        ImGui::TableNextRow();
+                        ImGui::TableSetColumnIndex(0);
+                        ImGui::Text("Scale tolerance");
+                        ImGui::TableSetColumnIndex(1);
+                        ImGui::PushItemWidth(-1);
+                        ImGui::DragFloat("##ScaleTolerance", &m_ImportSettings.ScaleTolerance, 0.0001f, 0.0f, 1.0f, "%.4f");
+                        ImGui::PopItemWidth();
+                        ImGui::Columns(1);
+                    }
+                }
+            }
         });
     }
 }
\ No newline at end of file
@@ -13,6 +13,9 @@ namespace Atom
     {
         m_IsOpened = true;
         m_ControllerName = "NewAnimationController";
+        m_InitialStateIdx = 0;
+        m_States.clear();
+        m_BakedPaletteSettings = {};
     }
 
     // -----------------------------------------------------------------------------------------------------------------------------
@@ -64,49 +67,164 @@ namespace Atom
                         ImGui::Columns(1);
                     }
 
+                    // Baked palettes
+                    {
+                        ImGui::TableNextRow();
+                        ImGui::TableSetColumnIndex(0);
+                        ImGui::Text("Bake palettes");
+                        ImGui::TableSetColumnIndex(1);
+                        ImGui::PushItemWidth(-1);
+                        ImGui::Checkbox("##BakePalettes", &m_BakedPaletteSettings.Enabled);
+                        ImGui::PopItemWidth();
+                        ImGui::Columns(1);
+                    }
+
+                    if (m_BakedPaletteSettings.Enabled)
+                    {
+                        ImGui::TableNextRow();
+                        ImGui::TableSetColumnIndex(0);
+                        ImGui::Text("Bake sample rate");
+                        ImGui::TableSetColumnIndex(1);
+                        ImGui::PushItemWidth(-1);
+                        ImGui::InputScalar("##BakeSampleRate", ImGuiDataType_U32, &m_BakedPaletteSettings.SampleRate);
+                        ImGui::PopItemWidth();
+                        ImGui::Columns(1);
+
+                        ImGui::TableNextRow();
+                        ImGui::TableSetColumnIndex(0);
+                        ImGui::Text("Interpolate frames");
+                        ImGui::TableSetColumnIndex(1);
+                        ImGui::PushItemWidth(-1);
+                        ImGui::Checkbox("##InterpolateBakedFrames", &m_BakedPaletteSettings.Interpolate);
+                        ImGui::PopItemWidth();
+                        ImGui::Columns(1);
+                    }
+
                     ImGui::EndTable();
                 }
 
                 // ---------------------------------------------------------------------------------------------------------------
-                ImGui::Text("Animations");
-                if (ImGui::BeginTable("##AnimationsTable", 1, ImGuiTableFlags_BordersOuter | ImGuiTableFlags_ScrollY, ImVec2{ 0.0f, 180.0f }))
+                const char* fileFilter = "Aton Animation Files (*.atmanim)\0*.atmanim\0";
+
+                ImGui::Text("States");
+                if (ImGui::BeginTable("##StatesTable", 2, ImGuiTableFlags_BordersOuter | ImGuiTableFlags_ScrollY, ImVec2{ 0.0f, 240.0f }))
                 {
-                    for (auto& path : m_AnimationPaths)
+                    const char* stateTypeStr[] = { "Clip", "Blend 1D", "Blend 2D" };
+
+                    for (u32 stateIdx = 0; stateIdx < m_States.size(); stateIdx++)
                     {
-                        ImGui::TableNextRow();
-                        ImGui::TableSetColumnIndex(0);
-                        ImGui::Text("%s", path.string().c_str());
+                        StateEntry& state = m_States[stateIdx];
+                        ImGui::PushID(stateIdx);
+
+                        // Type
+                        {
+                            ImGui::TableNextRow();
+                            ImGui::TableSetColumnIndex(0);
+                            ImGui::Text("State %u", stateIdx);
+                            ImGui::TableSetColumnIndex(1);
+                            ImGui::PushItemWidth(-1);
+
+                            const char* currentType = stateTypeStr[(u32)state.Type];
+
+                            if (ImGui::BeginCombo("##StateType", currentType))
+                            {
+                                for (u32 i = 0; i < _countof(stateTypeStr); i++)
+                                {
+                                    bool isSelected = currentType == stateTypeStr[i];
+                                    if (ImGui::Selectable(stateTypeStr[i], isSelected))
+                                    {
+                                        currentType = stateTypeStr[i];
+                                        state.Type = (AnimationStateType)i;
+                                    }
+
+                                    if (isSelected)
+                                        ImGui::SetItemDefaultFocus();
+                                }
+
+                                ImGui::EndCombo();
+                            }
+
+                            ImGui::PopItemWidth();
+                        }
+
+                        // Animations. Clip states only play their first animation, blend states need a position for each one
+                        for (u32 animIdx = 0; animIdx < state.AnimationPaths.size(); animIdx++)
+                        {
+                            ImGui::PushID(animIdx);
+                            ImGui::TableNextRow();
+                            ImGui::TableSetColumnIndex(0);
+                            ImGui::Text("    %s", state.AnimationPaths[animIdx].stem().string().c_str());
+                            ImGui::TableSetColumnIndex(1);
+                            ImGui::PushItemWidth(-1);
+
+                            if (state.Type == AnimationStateType::Blend1D)
+                                ImGui::DragFloat("##BlendPosition", &state.BlendPositions[animIdx].x, 0.01f);
+                            else if (state.Type == AnimationStateType::Blend2D)
+                                ImGui::DragFloat2("##BlendPosition", &state.BlendPositions[animIdx].x, 0.01f);
+
+                            ImGui::PopItemWidth();
+                            ImGui::PopID();
+                        }
+
+                        if (state.Type != AnimationStateType::Clip)
+                        {
+                            ImGui::TableNextRow();
+                            ImGui::TableSetColumnIndex(1);
+
+                            if (ImGui::Button("Add Animation", ImVec2(-1.0f, 0.0f)))
+                            {
+                                std::filesystem::path path = FileDialog::OpenFile(fileFilter);
+
+                                if (!path.empty())
+                                {
+                                    state.AnimationPaths.push_back(path);
+                                    state.BlendPositions.push_back(glm::vec2(0.0f));
+                                }
+                            }
+                        }
+
+                        ImGui::PopID();
                     }
 
                     ImGui::EndTable();
                 }
 
                 f32 browseButtonWidth = ImGui::GetWindowContentRegionMax().x - ImGui::GetStyle().WindowPadding.x;
-                if (ImGui::Button("Browse Files", ImVec2(browseButtonWidth, 32.0f)))
+                if (ImGui::Button("Add State", ImVec2(browseButtonWidth, 32.0f)))
                 {
-                    const char* fileFilter = "Aton Animation Files (*.atmanim)\0*.atmanim\0";
                     std::filesystem::path path = FileDialog::OpenFile(fileFilter);
 
                     if (!path.empty())
-                        m_AnimationPaths.push_back(path);
+                    {
+                        StateEntry& state = m_States.emplace_back();
+                        state.AnimationPaths.push_back(path);
+                        state.BlendPositions.push_back(glm::vec2(0.0f));
+                    }
                 }
 
                 // ---------------------------------------------------------------------------------------------------------------
                 f32 createButtonWidth = (ImGui::GetWindowContentRegionMax().x - ImGui::GetStyle().WindowPadding.x * 2.0f) / 2.0f;
                 if (ImGui::Button("Create", ImVec2(createButtonWidth, 32)))
                 {
-                    if (!m_ControllerName.empty() && !m_AnimationPaths.empty() && m_InitialStateIdx < m_AnimationPaths.size())
+                    if (!m_ControllerName.empty() && !m_States.empty() && m_InitialStateIdx < m_States.size())
                     {
-                        Vector<Ref<Animation>> animationAssets;
-                        animationAssets.reserve(m_AnimationPaths.size());
+                        Vector<AnimationState> animationStates;
+                        animationStates.reserve(m_States.size());
 
-                        for (auto& path : m_AnimationPaths)
+                        for (auto& stateEntry : m_States)
                         {
-                            UUID animUUID = AssetManager::GetUUIDForAssetPath(path);
-                            animationAssets.push_back(AssetManager::GetAsset<Animation>(animUUID, true));
+                            AnimationState& state = animationStates.emplace_back();
+                            state.Type = stateEntry.Type;
+                            state.BlendPositions = stateEntry.BlendPositions;
+
+                            for (auto& path : stateEntry.AnimationPaths)
+                            {
+                                UUID animUUID = AssetManager::GetUUIDForAssetPath(path);
+                                state.Animations.push_back(AssetManager::GetAsset<Animation>(animUUID, true));
+                            }
                         }
 
-                        ContentTools::CreateAnimationControllerAsset(animationAssets, m_InitialStateIdx, std::filesystem::path("AnimationControllers") / (m_ControllerName + ".atmanimcontroller"));
+                        ContentTools::CreateAnimationControllerAsset(animationStates, m_InitialStateIdx, std::filesystem::path("AnimationControllers") / (m_ControllerName + ".atmanimcontroller"), m_BakedPaletteSettings);
                     }
 
                     ImGui::CloseCurrentPopup();
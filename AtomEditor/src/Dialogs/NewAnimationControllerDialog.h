@@ -12,9 +12,17 @@ namespace Atom
         void OnImGuiRender();
 
     protected:
-        bool                          m_IsOpened = false;
-        String                        m_ControllerName;
-        u32                           m_InitialStateIdx = 0;
-        Vector<std::filesystem::path> m_AnimationPaths;
+        struct StateEntry
+        {
+            AnimationStateType            Type = AnimationStateType::Clip;
+            Vector<std::filesystem::path> AnimationPaths;
+            Vector<glm::vec2>             BlendPositions;
+        };
+
+        bool                 m_IsOpened = false;
+        String               m_ControllerName;
+        u32                  m_InitialStateIdx = 0;
+        Vector<StateEntry>   m_States;
+        BakedPaletteSettings m_BakedPaletteSettings;
     };
 }
\ No newline at end of file
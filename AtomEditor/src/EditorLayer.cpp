@@ -147,6 +147,11 @@ namespace Atom
                     SaveProject();
                 }
 
+                if (ImGui::MenuItem("Build Asset Pack"))
+                {
+                    BuildAssetPack();
+                }
+
                 ImGui::Separator();
 
                 if (ImGui::MenuItem("Exit", "Alt+F4"))
@@ -189,6 +194,16 @@ namespace Atom
                 ImGui::EndMenu();
             }
 
+            if (ImGui::BeginMenu("Tools"))
+            {
+                if (ImGui::MenuItem("Run Pose Evaluation Benchmark", ""))
+                {
+                    PoseEvaluator::RunBenchmark();
+                }
+
+                ImGui::EndMenu();
+            }
+
             ImGui::EndMenuBar();
         }
 
@@ -267,6 +282,26 @@ namespace Atom
         ImGui::Text("FPS: %d", fps);
         ImGui::PopStyleColor();
 
+        const SceneAnimationStats& animationStats = m_ActiveScene->GetAnimationStats();
+        if (animationStats.AnimatedEntityCount > 0)
+        {
+            f32 timePerBone = animationStats.SampledBoneCount > 0 ? animationStats.UpdateTime * 1000000.0f / animationStats.SampledBoneCount : 0.0f;
+
+            ImGui::SetCursorPosX(fpsTextPos.x);
+            ImGui::Text("Animation: %u entities, %u bones, %.3f ms (%.1f ns/bone)", animationStats.AnimatedEntityCount, animationStats.SampledBoneCount, animationStats.UpdateTime, timePerBone);
+
+            const u32* tierCounts = animationStats.TierEntityCounts;
+            ImGui::SetCursorPosX(fpsTextPos.x);
+            ImGui::Text("Animation LOD: %u updated (%u baked), %u full, %u reduced, %u minimal, %u frozen", animationStats.UpdatedEntityCount, animationStats.BakedEntityCount,
+                tierCounts[(u32)AnimationLODTier::Full], tierCounts[(u32)AnimationLODTier::Reduced], tierCounts[(u32)AnimationLODTier::Minimal], tierCounts[(u32)AnimationLODTier::Frozen]);
+        }
+
+        if (u32 pendingLoadCount = AssetManager::GetPendingLoadCount())
+        {
+            ImGui::SetCursorPosX(fpsTextPos.x);
+            ImGui::Text("Loading %u assets...", pendingLoadCount);
+        }
+
         if (m_ActiveScene->GetSceneState() == SceneState::Running)
         {
             ImGui::SetCursorPos(prevPos);
@@ -446,6 +481,15 @@ namespace Atom
             ATOM_ERROR("Failed saving project \"{}\"", Project::GetActiveProject()->GetProjectDirectory());
     }
 
+    // -----------------------------------------------------------------------------------------------------------------------------
+    void EditorLayer::BuildAssetPack()
+    {
+        Ref<Project> project = Project::GetActiveProject();
+
+        if (!ContentTools::BuildAssetPack(project->GetAssetPackPath()))
+            ATOM_ERROR("Failed building asset pack for project \"{}\"", project->GetSettings().Name);
+    }
+
     // -----------------------------------------------------------------------------------------------------------------------------
     void EditorLayer::SaveScene()
     {
@@ -509,6 +553,9 @@ namespace Atom
         if (m_ActiveScene->GetSceneState() == SceneState::Running)
             return;
 
+        // The runtime copy would not receive the assets that are still streaming in
+        AssetManager::WaitForAsyncLoads();
+
         m_ActiveScene = m_EditorScene->Copy();
         m_ActiveScene->OnViewportResize(m_ViewportSize.x, m_ViewportSize.y);
         m_ActiveScene->OnStart();
@@ -29,6 +29,7 @@ namespace Atom
         void OpenProject();
         void OpenProject(const std::filesystem::path& filepath);
         void SaveProject();
+        void BuildAssetPack();
 
         void SaveScene();
         void NewScene();
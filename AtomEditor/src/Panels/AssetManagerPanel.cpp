@@ -1,6 +1,7 @@
 #include "AssetManagerPanel.h"
 
 #include "Atom/Asset/AssetManager.h"
+#include "Atom/Asset/AssetFile.h"
 #include <imgui.h>
 
 namespace Atom
@@ -81,6 +82,63 @@ namespace Atom
             ImGui::TreePop();
         }
 
+        if (ImGui::TreeNodeEx("Registry", flags))
+        {
+            const AssetRegistryStats& stats = AssetManager::GetRegistryStats();
+            ImGui::Text("Registered %u assets in %.2f ms (%s start)", stats.AssetCount, stats.RegistrationTime, stats.IsWarmStart ? "warm" : "cold");
+            ImGui::Text("From cache: %u, read from files: %u", stats.CachedAssetCount, stats.ReadAssetCount);
+            ImGui::TreePop();
+        }
+
+        if (ImGui::TreeNodeEx("Cache", flags))
+        {
+            AssetCacheStats totalStats = AssetManager::GetCacheStats();
+            ImGui::Text("Hits: %llu, misses: %llu (hit ratio %.2f), evictions: %llu", totalStats.Hits, totalStats.Misses, totalStats.GetHitRatio(), totalStats.Evictions);
+
+            for (u32 i = 0; i < (u32)AssetType::NumTypes; i++)
+            {
+                AssetCacheStats stats = AssetManager::GetCacheStats((AssetType)i);
+                ImGui::Text("%s: %u cached, %.1f / %.1f MB", AssetTypeToString((AssetType)i).c_str(), stats.CachedAssetCount, stats.CachedMemory / (1024.0f * 1024.0f), stats.Budget / (1024.0f * 1024.0f));
+            }
+
+            if (ImGui::Button("Reset"))
+                AssetManager::ResetCacheStats();
+
+            ImGui::SameLine();
+
+            if (ImGui::Button("Unload unused"))
+                AssetManager::UnloadUnusedAssets();
+
+            ImGui::TreePop();
+        }
+
+        if (ImGui::TreeNodeEx("Loading", flags))
+        {
+            for (u32 i = 0; i < (u32)AssetType::NumTypes; i++)
+            {
+                AssetLoadStats stats = AssetManager::GetLoadStats((AssetType)i);
+                ImGui::Text("%s: %llu loaded, %.1f MB, %.2f ms average", AssetTypeToString((AssetType)i).c_str(), stats.LoadCount, stats.LoadedMemory / (1024.0f * 1024.0f), stats.GetAverageLoadTime());
+            }
+
+            if (ImGui::Button("Reset"))
+                AssetManager::ResetLoadStats();
+
+            ImGui::TreePop();
+        }
+
+        if (ImGui::TreeNodeEx("Compression", flags))
+        {
+            AssetCompressionStats stats = AssetFile::GetCompressionStats();
+            ImGui::Text("Written: %.1f MB -> %.1f MB (ratio %.2f)", stats.UncompressedBytesWritten / (1024.0f * 1024.0f), stats.CompressedBytesWritten / (1024.0f * 1024.0f), stats.GetCompressionRatio());
+            ImGui::Text("Decompressed: %.1f MB from %.1f MB", stats.DecompressedBytes / (1024.0f * 1024.0f), stats.CompressedBytesRead / (1024.0f * 1024.0f));
+            ImGui::Text("Decompression throughput: %.0f MB/s", stats.GetDecompressionThroughput());
+
+            if (ImGui::Button("Reset"))
+                AssetFile::ResetCompressionStats();
+
+            ImGui::TreePop();
+        }
+
         ImGui::End();
     }
 }
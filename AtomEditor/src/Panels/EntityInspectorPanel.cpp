@@ -437,8 +437,7 @@ namespace Atom
 					ImGui::Text("Current time");
 					ImGui::NextColumn();
 					ImGui::PushItemWidth(-1);
-					Ref<Animation> currentAnimState = component.AnimationController ? component.AnimationController->GetCurrentState() : nullptr;
-					ImGui::DragFloat("##CurrentTime", &component.CurrentTime, 0.01f, 0.0f, currentAnimState ? currentAnimState->GetDuration() : 0.0f, "%.2f");
+					ImGui::DragFloat("##CurrentTime", &component.CurrentTime, 0.01f, 0.0f, 1.0f, "%.2f");
 					ImGui::PopItemWidth();
 					ImGui::Columns(1);
 
@@ -922,7 +921,7 @@ namespace Atom
 								}
 								else if (varType == ScriptVariableType::Material)
 								{
-									const AssetMetaData* metaData = AssetManager::GetAssetMetaData(var.GetValue<UUID>());
+									std::optional<AssetMetaData> metaData = AssetManager::GetAssetMetaData(var.GetValue<UUID>());
 
 									ImGui::InputText(imguiID.c_str(), metaData ? (char*)metaData->AssetFilepath.stem().string().c_str() : "None", 50, ImGuiInputTextFlags_ReadOnly);
 
@@ -938,7 +937,7 @@ namespace Atom
 								}
 								else if (varType == ScriptVariableType::Mesh)
 								{
-									const AssetMetaData* metaData = AssetManager::GetAssetMetaData(var.GetValue<UUID>());
+									std::optional<AssetMetaData> metaData = AssetManager::GetAssetMetaData(var.GetValue<UUID>());
 
 									ImGui::InputText(imguiID.c_str(), metaData ? (char*)metaData->AssetFilepath.stem().string().c_str() : "None", 50, ImGuiInputTextFlags_ReadOnly);
 
@@ -954,7 +953,7 @@ namespace Atom
 								}
 								else if (varType == ScriptVariableType::Texture2D)
 								{
-									const AssetMetaData* metaData = AssetManager::GetAssetMetaData(var.GetValue<UUID>());
+									std::optional<AssetMetaData> metaData = AssetManager::GetAssetMetaData(var.GetValue<UUID>());
 
 									ImGui::InputText(imguiID.c_str(), metaData ? (char*)metaData->AssetFilepath.stem().string().c_str() : "None", 50, ImGuiInputTextFlags_ReadOnly);
 
@@ -970,7 +969,7 @@ namespace Atom
 								}
 								else if (varType == ScriptVariableType::TextureCube)
 								{
-									const AssetMetaData* metaData = AssetManager::GetAssetMetaData(var.GetValue<UUID>());
+									std::optional<AssetMetaData> metaData = AssetManager::GetAssetMetaData(var.GetValue<UUID>());
 
 									ImGui::InputText(imguiID.c_str(), metaData ? (char*)metaData->AssetFilepath.stem().string().c_str() : "None", 50, ImGuiInputTextFlags_ReadOnly);
 
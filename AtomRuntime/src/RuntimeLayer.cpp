@@ -96,7 +96,7 @@ namespace Atom
     // -----------------------------------------------------------------------------------------------------------------------------
     void RuntimeLayer::OpenProject(const std::filesystem::path& filepath)
     {
-        if (!Project::OpenProject(filepath))
+        if (!Project::OpenProject(filepath, true))
         {
             ATOM_ERROR("Failed opening project \"{}\"", filepath);
             return;